@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "benchmark-utils.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+
+// INTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+
+namespace Benchmark
+{
+
+namespace
+{
+
+/**
+ * Escapes the quotes and the backslashes of a string written in a JSON document.
+ */
+std::string EscapeJson( const std::string& text )
+{
+  std::string escaped;
+  escaped.reserve( text.size() );
+  for( char character : text )
+  {
+    if( character == '"' || character == '\\' )
+    {
+      escaped.push_back( '\\' );
+    }
+    escaped.push_back( character );
+  }
+  return escaped;
+}
+
+} // unnamed namespace
+
+const char* const RESULTS_ENVIRONMENT_VARIABLE = "DALI_BENCHMARK_RESULTS";
+
+void Report( const std::string& name, std::vector< double > durations )
+{
+  if( durations.empty() )
+  {
+    return;
+  }
+
+  std::sort( durations.begin(), durations.end() );
+
+  const size_t count = durations.size();
+  const double mean = std::accumulate( durations.begin(), durations.end(), 0.0 ) / count;
+  const double median = ( count % 2u ) ? durations[ count / 2u ] : ( durations[ count / 2u - 1u ] + durations[ count / 2u ] ) * 0.5;
+
+  tet_printf( "%s: %zu iterations, mean %.2fus, median %.2fus, min %.2fus, max %.2fus\n",
+              name.c_str(), count, mean, median, durations.front(), durations.back() );
+
+  const char* resultsFile = getenv( RESULTS_ENVIRONMENT_VARIABLE );
+  if( resultsFile )
+  {
+    FILE* fp = fopen( resultsFile, "a" );
+    if( fp != NULL )
+    {
+      fprintf( fp, "{\"name\":\"%s\",\"iterations\":%zu,\"unit\":\"us\",\"mean\":%.3f,\"median\":%.3f,\"min\":%.3f,\"max\":%.3f}\n",
+               EscapeJson( name ).c_str(), count, mean, median, durations.front(), durations.back() );
+      fclose( fp );
+    }
+  }
+}
+
+bool WriteResults( const char* resultsFile, const char* outputFile )
+{
+  std::ifstream results( resultsFile );
+  std::ofstream output( outputFile, std::ios::out | std::ios::trunc );
+  if( !output.is_open() )
+  {
+    printf( "Can't open %s to write the benchmark results\n", outputFile );
+    return false;
+  }
+
+  output << "{\"benchmarks\":[";
+
+  bool first = true;
+  std::string line;
+  while( std::getline( results, line ) )
+  {
+    if( !line.empty() )
+    {
+      output << ( first ? "\n  " : ",\n  " ) << line;
+      first = false;
+    }
+  }
+
+  output << "\n]}\n";
+  return output.good();
+}
+
+} // namespace Benchmark
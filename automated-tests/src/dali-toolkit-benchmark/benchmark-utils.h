@@ -0,0 +1,110 @@
+#ifndef DALI_TOOLKIT_BENCHMARK_UTILS_H
+#define DALI_TOOLKIT_BENCHMARK_UTILS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+/**
+ * @brief The environment variable holding the file the results of the test cases are appended to.
+ *
+ * Each test case runs in its own process, so the results are written one JSON object per line,
+ * and gathered into a single document by WriteResults() once all the test cases have run.
+ */
+extern const char* const RESULTS_ENVIRONMENT_VARIABLE;
+
+/**
+ * @brief Measures the time elapsed since it was created.
+ */
+class Timer
+{
+public:
+  /**
+   * @brief Starts the timer.
+   */
+  Timer()
+  : mStart( std::chrono::steady_clock::now() )
+  {
+  }
+
+  /**
+   * @brief Retrieves the time elapsed since the timer was started.
+   * @return The elapsed time in microseconds
+   */
+  double GetElapsedMicroseconds() const
+  {
+    return std::chrono::duration< double, std::micro >( std::chrono::steady_clock::now() - mStart ).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point mStart;
+};
+
+/**
+ * @brief Reports the durations of the iterations of a benchmark.
+ *
+ * The mean, the median, the minimum and the maximum are printed and appended to the results file, if any.
+ * @param[in] name The name of the benchmark, e.g. "VisualFactory.CreateVisual/COLOR"
+ * @param[in] durations The duration of each iteration in microseconds
+ */
+void Report( const std::string& name, std::vector< double > durations );
+
+/**
+ * @brief Measures the iterations of a function and reports them.
+ *
+ * The function is called once more beforehand to warm up the caches, which is not measured.
+ * @param[in] name The name of the benchmark
+ * @param[in] iterations The number of measured iterations
+ * @param[in] function The function measured, called with the index of the iteration
+ */
+template< typename Function >
+void Measure( const std::string& name, uint32_t iterations, Function&& function )
+{
+  function( iterations );
+
+  std::vector< double > durations;
+  durations.reserve( iterations );
+  for( uint32_t i = 0u; i < iterations; ++i )
+  {
+    Timer timer;
+    function( i );
+    durations.push_back( timer.GetElapsedMicroseconds() );
+  }
+
+  Report( name, std::move( durations ) );
+}
+
+/**
+ * @brief Gathers the results appended by the test cases into a JSON document.
+ *
+ * The document is {"benchmarks":[...]} with an object per benchmark.
+ * @param[in] resultsFile The file the test cases have appended their results to
+ * @param[in] outputFile The JSON document to write
+ * @return true if the document is written
+ */
+bool WriteResults( const char* resultsFile, const char* outputFile );
+
+} // namespace Benchmark
+
+#endif // DALI_TOOLKIT_BENCHMARK_UTILS_H
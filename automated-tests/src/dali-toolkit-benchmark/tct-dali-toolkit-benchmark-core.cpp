@@ -0,0 +1,65 @@
+#include <string.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <test-harness.h>
+#include "benchmark-utils.h"
+#include "tct-dali-toolkit-benchmark-core.h"
+
+int main(int argc, char * const argv[])
+{
+  int result = TestHarness::EXIT_STATUS_BAD_ARGUMENT;
+
+  // The parallel options of the other test suites are accepted, but the benchmarks always run serially,
+  // so they do not compete for the CPU.
+  const char* optString = "sfo:";
+  const char* outputFile = "tct-dali-toolkit-benchmark-results.json";
+
+  int nextOpt = 0;
+  do
+  {
+    nextOpt = getopt( argc, argv, optString );
+    switch(nextOpt)
+    {
+      case 'f':
+      case 's':
+        break;
+      case 'o':
+        outputFile = optarg;
+        break;
+      case '?':
+        TestHarness::Usage(argv[0]);
+        exit(TestHarness::EXIT_STATUS_BAD_ARGUMENT);
+        break;
+    }
+  } while( nextOpt != -1 );
+
+  // Each test case appends its results to this file from its own process
+  char resultsFile[] = "/tmp/dali-toolkit-benchmark-XXXXXX";
+  int resultsFd = mkstemp( resultsFile );
+  if( resultsFd == -1 )
+  {
+    perror( "mkstemp" );
+    exit( TestHarness::EXIT_STATUS_BAD_ARGUMENT );
+  }
+  close( resultsFd );
+  setenv( Benchmark::RESULTS_ENVIRONMENT_VARIABLE, resultsFile, 1 );
+
+  if( optind == argc ) // no testcase name in argument list
+  {
+    result = TestHarness::RunAll( argv[0], tc_array );
+  }
+  else
+  {
+    // optind is index of next argument - interpret as testcase name
+    result = TestHarness::FindAndRunTestCase(tc_array, argv[optind]);
+  }
+
+  if( Benchmark::WriteResults( resultsFile, outputFile ) )
+  {
+    printf( "Benchmark results written to %s\n", outputFile );
+  }
+  unlink( resultsFile );
+
+  return result;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include "benchmark-utils.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void dali_item_view_benchmark_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void dali_item_view_benchmark_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int TOTAL_ITEM_NUMBER = 1000u;
+const uint32_t FRAMES_PER_FLING = 30u;
+const uint32_t FLING_COUNT = 10u;
+const float FLING_DURATION = 0.5f;
+const uint32_t FRAME_INTERVAL = 16u;
+
+// Implementation of ItemFactory creating list items with a background and a label
+class BenchmarkItemFactory : public ItemFactory
+{
+public:
+
+  BenchmarkItemFactory()
+  {
+  }
+
+public: // From ItemFactory
+
+  unsigned int GetNumberOfItems() override
+  {
+    return TOTAL_ITEM_NUMBER;
+  }
+
+  Actor NewItem( unsigned int itemId ) override
+  {
+    Control item = Control::New();
+    item.SetProperty( Control::Property::BACKGROUND, ( itemId % 2u ) ? Color::WHITE : Color::CYAN );
+
+    TextLabel label = TextLabel::New( "Item " + std::to_string( itemId ) );
+    label.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+    label.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
+    item.Add( label );
+
+    return item;
+  }
+};
+
+} // unnamed namespace
+
+int UtcDaliBenchmarkItemViewFling(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the frames of an item view flung back and forth through its items" );
+
+  BenchmarkItemFactory factory;
+  ItemView view = ItemView::New( factory );
+  view.SetProperty( Actor::Property::SIZE, Vector2( 480.f, 800.f ) );
+  view.AddLayout( *DefaultItemLayout::New( DefaultItemLayout::LIST ) );
+  application.GetScene().Add( view );
+
+  view.ActivateLayout( 0, Vector3( 480.f, 800.f, 0.f ), 0.f );
+  application.SendNotification();
+  application.Render();
+
+  // Each fling scrolls to the other end of a range wide enough to replace all the visible items
+  Benchmark::Measure( "ItemView.FlingFrame", FRAMES_PER_FLING * FLING_COUNT, [&]( uint32_t frame )
+  {
+    if( frame % FRAMES_PER_FLING == 0u )
+    {
+      const ItemId targetItem = ( frame / FRAMES_PER_FLING ) % 2u ? 0u : TOTAL_ITEM_NUMBER / 2u;
+      view.ScrollToItem( targetItem, FLING_DURATION );
+    }
+
+    application.SendNotification();
+    application.Render( FRAME_INTERVAL );
+  } );
+
+  DALI_TEST_CHECK( view.GetChildCount() > 0u );
+
+  END_TEST;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <sstream>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/builder/builder.h>
+#include <toolkit-style-monitor.h>
+#include "benchmark-utils.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void dali_style_benchmark_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void dali_style_benchmark_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const uint32_t THEME_ITERATIONS = 50u;
+const uint32_t THEMED_CONTROL_COUNT = 200u;
+const uint32_t BUILDER_ITERATIONS = 50u;
+const uint32_t BUILDER_TEMPLATE_COUNT = 200u;
+
+/**
+ * Creates a theme styling the controls of the benchmark, in the given text color.
+ */
+std::string CreateTheme( const char* textColor, float pointSize )
+{
+  std::ostringstream theme;
+  theme << "{\n"
+           "  \"styles\":\n"
+           "  {\n"
+           "    \"TextLabel\":\n"
+           "    {\n"
+           "      \"textColor\":" << textColor << ",\n"
+           "      \"pointSize\":" << pointSize << ",\n"
+           "      \"horizontalAlignment\":\"CENTER\"\n"
+           "    },\n"
+           "    \"PushButton\":\n"
+           "    {\n"
+           "      \"label\":{ \"textColor\":" << textColor << ", \"pointSize\":" << pointSize << " },\n"
+           "      \"backgroundColor\":[0.2,0.2,0.2,1.0]\n"
+           "    },\n"
+           "    \"CheckBoxButton\":\n"
+           "    {\n"
+           "      \"label\":{ \"textColor\":" << textColor << " }\n"
+           "    }\n"
+           "  }\n"
+           "}\n";
+  return theme.str();
+}
+
+/**
+ * Creates a JSON document with many templates of small actor trees, and a stage section using some of them.
+ */
+std::string CreateBuilderDocument()
+{
+  std::ostringstream document;
+  document << "{\n  \"constants\": { \"ITEM_COLOR\": [0.5,0.5,1.0,1.0] },\n  \"templates\":\n  {\n";
+  for( uint32_t i = 0u; i < BUILDER_TEMPLATE_COUNT; ++i )
+  {
+    document << ( i ? ",\n" : "" )
+             << "    \"item" << i << "\":\n"
+             << "    {\n"
+             << "      \"type\":\"Control\",\n"
+             << "      \"size\":[" << 100 + i << ",50,0],\n"
+             << "      \"background\":{ \"visualType\":\"COLOR\", \"mixColor\":\"{ITEM_COLOR}\" },\n"
+             << "      \"actors\":\n"
+             << "      [\n"
+             << "        { \"type\":\"TextLabel\", \"text\":\"Item " << i << "\", \"parentOrigin\":\"CENTER\", \"anchorPoint\":\"CENTER\" },\n"
+             << "        { \"type\":\"ImageView\", \"parentOrigin\":\"CENTER_LEFT\", \"anchorPoint\":\"CENTER_LEFT\", \"size\":[40,40,0] }\n"
+             << "      ]\n"
+             << "    }";
+  }
+  document << "\n  },\n  \"stage\":\n  [\n";
+  for( uint32_t i = 0u; i < BUILDER_TEMPLATE_COUNT; i += 10u )
+  {
+    document << ( i ? ",\n" : "" ) << "    { \"type\":\"item" << i << "\" }";
+  }
+  document << "\n  ]\n}\n";
+  return document.str();
+}
+
+} // unnamed namespace
+
+int UtcDaliBenchmarkApplyTheme(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the application of a theme to the controls on the scene" );
+
+  Integration::Scene scene = application.GetScene();
+  for( uint32_t i = 0u; i < THEMED_CONTROL_COUNT; ++i )
+  {
+    switch( i % 3u )
+    {
+      case 0u:
+      {
+        scene.Add( TextLabel::New( "Label" ) );
+        break;
+      }
+      case 1u:
+      {
+        PushButton button = PushButton::New();
+        button.SetProperty( Button::Property::LABEL, "Button" );
+        scene.Add( button );
+        break;
+      }
+      default:
+      {
+        scene.Add( CheckBoxButton::New() );
+        break;
+      }
+    }
+  }
+  application.SendNotification();
+  application.Render();
+
+  const std::string themeNames[] = { "BenchmarkThemeOne", "BenchmarkThemeTwo" };
+  Test::StyleMonitor::SetThemeFileOutput( themeNames[ 0 ], CreateTheme( "[1.0,0.0,0.0,1.0]", 10.f ) );
+  Test::StyleMonitor::SetThemeFileOutput( themeNames[ 1 ], CreateTheme( "[0.0,0.0,1.0,1.0]", 12.f ) );
+
+  StyleManager styleManager = StyleManager::Get();
+  Benchmark::Measure( "StyleManager.ApplyTheme", THEME_ITERATIONS, [&]( uint32_t iteration )
+  {
+    styleManager.ApplyTheme( themeNames[ iteration % 2u ] );
+
+    application.SendNotification();
+    application.Render();
+  } );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkBuilderLoad(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the loading of a large JSON document, and the creation of its templates" );
+
+  const std::string document = CreateBuilderDocument();
+
+  Benchmark::Measure( "Builder.LoadFromString", BUILDER_ITERATIONS, [&]( uint32_t )
+  {
+    Builder builder = Builder::New();
+    builder.LoadFromString( document );
+  } );
+
+  Builder builder = Builder::New();
+  builder.LoadFromString( document );
+
+  Benchmark::Measure( "Builder.Create", BUILDER_ITERATIONS, [&]( uint32_t iteration )
+  {
+    Actor actor = Actor::DownCast( builder.Create( "item" + std::to_string( iteration % BUILDER_TEMPLATE_COUNT ) ) );
+    DALI_TEST_CHECK( actor );
+  } );
+
+  END_TEST;
+}
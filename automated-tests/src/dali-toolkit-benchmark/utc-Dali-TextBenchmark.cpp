@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/text-controls/text-field-devel.h>
+#include <dali-toolkit/devel-api/text/rendering-backend.h>
+#include "benchmark-utils.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void dali_text_benchmark_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void dali_text_benchmark_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const uint32_t CREATE_ITERATIONS = 200u;
+const uint32_t UPDATE_ITERATIONS = 200u;
+const uint32_t ATLAS_ITERATIONS = 48u;
+
+const char* const LATIN_TEXT = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.";
+const char* const CJK_TEXT = "漢字と仮名の混じった日本語の文章です。中文的句子也在这里。한국어 문장도 있습니다.";
+const char* const ARABIC_TEXT = "نص عربي يكتب من اليمين إلى اليسار مع بعض الأرقام ١٢٣ والكلمات المتصلة.";
+
+const char* const ATLAS_TEXT = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+/**
+ * Measures the creation of a multi-line label showing the text, and the update of its text, both rendered.
+ */
+void MeasureTextLabel( ToolkitTestApplication& application, const std::string& scriptName, const std::string& text )
+{
+  Integration::Scene scene = application.GetScene();
+
+  Benchmark::Measure( "TextLabel.Create/" + scriptName, CREATE_ITERATIONS, [&]( uint32_t )
+  {
+    TextLabel label = TextLabel::New( text );
+    label.SetProperty( TextLabel::Property::MULTI_LINE, true );
+    label.SetProperty( Actor::Property::SIZE, Vector2( 300.f, 200.f ) );
+    scene.Add( label );
+
+    application.SendNotification();
+    application.Render();
+
+    label.Unparent();
+  } );
+
+  TextLabel label = TextLabel::New();
+  label.SetProperty( TextLabel::Property::MULTI_LINE, true );
+  label.SetProperty( Actor::Property::SIZE, Vector2( 300.f, 200.f ) );
+  scene.Add( label );
+
+  // Alternate between two texts, so every update has to shape and lay out the text again
+  const std::string texts[] = { text, text + " " + text };
+  Benchmark::Measure( "TextLabel.Update/" + scriptName, UPDATE_ITERATIONS, [&]( uint32_t iteration )
+  {
+    label.SetProperty( TextLabel::Property::TEXT, texts[ iteration % 2u ] );
+
+    application.SendNotification();
+    application.Render();
+  } );
+}
+
+} // unnamed namespace
+
+int UtcDaliBenchmarkTextLabelLatin(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation and the update of the labels showing latin text" );
+
+  MeasureTextLabel( application, "Latin", LATIN_TEXT );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkTextLabelCJK(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation and the update of the labels showing CJK text" );
+
+  MeasureTextLabel( application, "CJK", CJK_TEXT );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkTextLabelArabic(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation and the update of the labels showing arabic text" );
+
+  MeasureTextLabel( application, "Arabic", ARABIC_TEXT );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkGlyphAtlasFill(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the caching of new glyphs into the shared glyph atlas" );
+
+  // The text field renders its glyphs with the atlas renderer
+  TextField field = TextField::New();
+  field.SetProperty( DevelTextField::Property::RENDERING_BACKEND, DevelText::RENDERING_SHARED_ATLAS );
+  field.SetProperty( TextField::Property::TEXT, ATLAS_TEXT );
+  field.SetProperty( Actor::Property::SIZE, Vector2( 1000.f, 100.f ) );
+  application.GetScene().Add( field );
+
+  // Every point size rasterizes and uploads the glyphs again, until the atlases are full and new ones are created
+  Benchmark::Measure( "GlyphAtlas.Fill", ATLAS_ITERATIONS, [&]( uint32_t iteration )
+  {
+    field.SetProperty( TextField::Property::POINT_SIZE, 8.f + static_cast< float >( iteration ) );
+
+    application.SendNotification();
+    application.Render();
+  } );
+
+  END_TEST;
+}
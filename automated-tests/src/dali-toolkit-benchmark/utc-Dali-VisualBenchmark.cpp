@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dummy-control.h>
+#include "benchmark-utils.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void dali_visual_benchmark_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void dali_visual_benchmark_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+const char* TEST_NPATCH_FILE_NAME = TEST_RESOURCE_DIR "/button-up.9.png";
+
+const uint32_t CREATE_ITERATIONS = 1000u;
+const uint32_t STAGE_ITERATIONS = 200u;
+const uint32_t TEXTURE_ITERATIONS = 200u;
+const uint32_t CACHED_TEXTURE_COUNTS[] = { 0u, 64u, 512u };
+
+/**
+ * Measures the creation of a visual, and registering it to a control on the scene, which creates its renderer.
+ */
+void MeasureVisual( ToolkitTestApplication& application, const std::string& typeName, const Property::Map& propertyMap )
+{
+  VisualFactory factory = VisualFactory::Get();
+
+  Benchmark::Measure( "VisualFactory.CreateVisual/" + typeName, CREATE_ITERATIONS, [&]( uint32_t )
+  {
+    Visual::Base visual = factory.CreateVisual( propertyMap );
+  } );
+
+  DummyControl control = DummyControl::New( true );
+  DummyControlImpl& controlImpl = static_cast< DummyControlImpl& >( control.GetImplementation() );
+  control.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( control );
+
+  Benchmark::Measure( "Control.RegisterVisual/" + typeName, STAGE_ITERATIONS, [&]( uint32_t )
+  {
+    controlImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, factory.CreateVisual( propertyMap ) );
+    controlImpl.UnregisterVisual( DummyControl::Property::TEST_VISUAL );
+  } );
+
+  control.Unparent();
+  application.SendNotification();
+  application.Render();
+}
+
+/**
+ * Creates an image view loading the test image synchronously at the given size, so each size is a distinct texture.
+ */
+ImageView CreateImageView( uint32_t size )
+{
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::IMAGE;
+  propertyMap[ ImageVisual::Property::URL ] = TEST_IMAGE_FILE_NAME;
+  propertyMap[ ImageVisual::Property::DESIRED_WIDTH ] = static_cast< int >( size );
+  propertyMap[ ImageVisual::Property::DESIRED_HEIGHT ] = static_cast< int >( size );
+  propertyMap[ ImageVisual::Property::SYNCHRONOUS_LOADING ] = true;
+
+  ImageView imageView = ImageView::New();
+  imageView.SetProperty( ImageView::Property::IMAGE, propertyMap );
+  imageView.SetProperty( Actor::Property::SIZE, Vector2( 10.f, 10.f ) );
+  return imageView;
+}
+
+} // unnamed namespace
+
+int UtcDaliBenchmarkColorVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the color visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::COLOR;
+  propertyMap[ ColorVisual::Property::MIX_COLOR ] = Color::RED;
+  MeasureVisual( application, "COLOR", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkBorderVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the border visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::BORDER;
+  propertyMap[ BorderVisual::Property::COLOR ] = Color::BLUE;
+  propertyMap[ BorderVisual::Property::SIZE ] = 5.f;
+  MeasureVisual( application, "BORDER", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkGradientVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the gradient visuals" );
+
+  Property::Array stopOffsets;
+  stopOffsets.PushBack( 0.f );
+  stopOffsets.PushBack( 1.f );
+  Property::Array stopColors;
+  stopColors.PushBack( Color::RED );
+  stopColors.PushBack( Color::GREEN );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::GRADIENT;
+  propertyMap[ GradientVisual::Property::START_POSITION ] = Vector2( -0.5f, -0.5f );
+  propertyMap[ GradientVisual::Property::END_POSITION ] = Vector2( 0.5f, 0.5f );
+  propertyMap[ GradientVisual::Property::STOP_OFFSET ] = stopOffsets;
+  propertyMap[ GradientVisual::Property::STOP_COLOR ] = stopColors;
+  MeasureVisual( application, "GRADIENT", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkImageVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the image visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::IMAGE;
+  propertyMap[ ImageVisual::Property::URL ] = TEST_IMAGE_FILE_NAME;
+  MeasureVisual( application, "IMAGE", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkNPatchVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the n-patch visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::N_PATCH;
+  propertyMap[ ImageVisual::Property::URL ] = TEST_NPATCH_FILE_NAME;
+  MeasureVisual( application, "N_PATCH", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkTextVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the text visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::TEXT;
+  propertyMap[ TextVisual::Property::TEXT ] = "Hello world";
+  propertyMap[ TextVisual::Property::POINT_SIZE ] = 12.f;
+  MeasureVisual( application, "TEXT", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkPrimitiveVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the primitive visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::PRIMITIVE;
+  propertyMap[ PrimitiveVisual::Property::SHAPE ] = PrimitiveVisual::Shape::SPHERE;
+  MeasureVisual( application, "PRIMITIVE", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkWireframeVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the creation of the wireframe visuals" );
+
+  Property::Map propertyMap;
+  propertyMap[ Visual::Property::TYPE ] = Visual::WIREFRAME;
+  MeasureVisual( application, "WIREFRAME", propertyMap );
+
+  END_TEST;
+}
+
+int UtcDaliBenchmarkTextureRequestRemove(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Measure the texture requests and removals while textures are cached" );
+
+  std::vector< ImageView > cachedImageViews;
+  uint32_t cachedCount = 0u;
+
+  for( uint32_t targetCount : CACHED_TEXTURE_COUNTS )
+  {
+    // Keep the textures cached by keeping their image views on the scene
+    for( ; cachedCount < targetCount; ++cachedCount )
+    {
+      cachedImageViews.push_back( CreateImageView( cachedCount + 1u ) );
+      application.GetScene().Add( cachedImageViews.back() );
+    }
+    application.SendNotification();
+    application.Render();
+
+    const std::string suffix = "/cached=" + std::to_string( targetCount );
+
+    // A texture which is not cached yet, which is loaded by the request and removed with the image view
+    ImageView missImageView = CreateImageView( 4096u );
+    Benchmark::Measure( "TextureManager.RequestRemove/miss" + suffix, TEXTURE_ITERATIONS, [&]( uint32_t )
+    {
+      application.GetScene().Add( missImageView );
+      missImageView.Unparent();
+    } );
+
+    // A texture which is already cached, which is only referenced by the request
+    if( targetCount > 0u )
+    {
+      ImageView hitImageView = CreateImageView( targetCount / 2u );
+      Benchmark::Measure( "TextureManager.RequestRemove/hit" + suffix, TEXTURE_ITERATIONS, [&]( uint32_t )
+      {
+        application.GetScene().Add( hitImageView );
+        hitImageView.Unparent();
+      } );
+    }
+  }
+
+  DALI_TEST_EQUALS( cachedImageViews.size(), static_cast< size_t >( cachedCount ), TEST_LOCATION );
+
+  END_TEST;
+}
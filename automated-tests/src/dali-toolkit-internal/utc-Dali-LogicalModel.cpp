@@ -20,6 +20,9 @@
 #include <unistd.h>
 
 #include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/text/color-run.h>
+#include <dali-toolkit/internal/text/line-run.h>
+#include <dali-toolkit/internal/text/script-run.h>
 #include <dali-toolkit/internal/text/text-run-container.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
@@ -39,6 +42,9 @@ using namespace Text;
 // bool FetchBidirectionalLineInfo( CharacterIndex characterIndex )
 // CharacterIndex GetLogicalCharacterIndex( CharacterIndex visualCharacterIndex ) const;
 // CharacterIndex GetLogicalCursorIndex( CharacterIndex visualCursorIndex ) const;
+// void ClearCharacterRuns( CharacterIndex startIndex, CharacterIndex endIndex, Vector<T>& runs );
+// void ClearGlyphRuns( GlyphIndex startIndex, GlyphIndex endIndex, Vector<T>& runs );
+// void UpdateCharacterRuns( CharacterIndex index, int numberOfCharacters, Length totalNumberOfCharacters, Vector<T>& runs, Vector<T>& removedRuns );
 
 //////////////////////////////////////////////////////////
 
@@ -1187,3 +1193,102 @@ int UtcDaliGetLogicalCursorIndex(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliClearCharacterRuns(void)
+{
+  tet_infoline(" UtcDaliClearCharacterRuns");
+
+  Vector<ScriptRun> scriptRuns;
+  scriptRuns.Resize( 3u );
+  for( unsigned int index = 0u; index < 3u; ++index )
+  {
+    ScriptRun& run = *( scriptRuns.Begin() + index );
+    run.characterRun.characterIndex = 5u * index;
+    run.characterRun.numberOfCharacters = 5u;
+  }
+
+  // Removes the characters 6 and 7 of the second run.
+  ClearCharacterRuns( 6u, 7u, scriptRuns );
+
+  DALI_TEST_EQUALS( scriptRuns.Count(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scriptRuns[0u].characterRun.characterIndex, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scriptRuns[0u].characterRun.numberOfCharacters, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scriptRuns[1u].characterRun.characterIndex, 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scriptRuns[1u].characterRun.numberOfCharacters, 5u, TEST_LOCATION );
+
+  // Removes characters after the last run.
+  ClearCharacterRuns( 20u, 21u, scriptRuns );
+
+  DALI_TEST_EQUALS( scriptRuns.Count(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scriptRuns[1u].characterRun.characterIndex, 8u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliClearGlyphRuns(void)
+{
+  tet_infoline(" UtcDaliClearGlyphRuns");
+
+  Vector<LineRun> lines;
+  lines.Resize( 4u );
+  for( unsigned int index = 0u; index < 4u; ++index )
+  {
+    LineRun& line = *( lines.Begin() + index );
+    line.glyphRun.glyphIndex = 4u * index;
+    line.glyphRun.numberOfGlyphs = 4u;
+  }
+
+  // Removes the glyphs of the second line.
+  uint32_t startRemoveIndex = lines.Count();
+  uint32_t endRemoveIndex = startRemoveIndex;
+  ClearGlyphRuns( 4u, 7u, lines, startRemoveIndex, endRemoveIndex );
+
+  DALI_TEST_EQUALS( startRemoveIndex, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( endRemoveIndex, 2u, TEST_LOCATION );
+
+  // All the lines after the removed glyphs are updated.
+  DALI_TEST_EQUALS( lines[0u].glyphRun.glyphIndex, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( lines[2u].glyphRun.glyphIndex, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( lines[3u].glyphRun.glyphIndex, 8u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliUpdateCharacterRuns(void)
+{
+  tet_infoline(" UtcDaliUpdateCharacterRuns");
+
+  Vector<ColorRun> colorRuns;
+  colorRuns.Resize( 3u );
+  for( unsigned int index = 0u; index < 3u; ++index )
+  {
+    ColorRun& run = *( colorRuns.Begin() + index );
+    run.characterRun.characterIndex = 3u * index;
+    run.characterRun.numberOfCharacters = 3u;
+    run.color = Color::RED;
+  }
+
+  // Removes the characters from 3 to 6, i.e. the second run and the first character of the third one.
+  Vector<ColorRun> removedColorRuns;
+  UpdateCharacterRuns<ColorRun>( 3u, -4, 9u, colorRuns, removedColorRuns );
+
+  DALI_TEST_EQUALS( colorRuns.Count(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[0u].characterRun.characterIndex, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[0u].characterRun.numberOfCharacters, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[1u].characterRun.characterIndex, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[1u].characterRun.numberOfCharacters, 2u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( removedColorRuns.Count(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( removedColorRuns[0u].characterRun.characterIndex, 3u, TEST_LOCATION );
+
+  // Inserts two characters within the first run.
+  removedColorRuns.Clear();
+  UpdateCharacterRuns<ColorRun>( 1u, 2, 5u, colorRuns, removedColorRuns );
+
+  DALI_TEST_EQUALS( colorRuns.Count(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[0u].characterRun.numberOfCharacters, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( colorRuns[1u].characterRun.characterIndex, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( removedColorRuns.Count(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/controls/model3d-view/obj-loader.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+
+const int ALL_OBJECT_PROPERTIES = ObjLoader::TEXTURE_COORDINATES | ObjLoader::TANGENTS | ObjLoader::BINORMALS;
+
+// Creates a grid of quads with texture coordinates in the range [0,1]
+std::string CreateGridObject( unsigned int quadsPerSide )
+{
+  std::ostringstream stream;
+  stream << "# grid\n";
+
+  const unsigned int pointsPerSide = quadsPerSide + 1u;
+  for( unsigned int y = 0u; y < pointsPerSide; ++y )
+  {
+    for( unsigned int x = 0u; x < pointsPerSide; ++x )
+    {
+      stream << "v " << x << " " << y << " " << ( ( x * y ) % 7u ) * 0.125f << "\n";
+    }
+  }
+  for( unsigned int y = 0u; y < pointsPerSide; ++y )
+  {
+    for( unsigned int x = 0u; x < pointsPerSide; ++x )
+    {
+      stream << "vt " << static_cast<float>( x ) / quadsPerSide << " " << static_cast<float>( y ) / quadsPerSide << "\n";
+    }
+  }
+  for( unsigned int y = 0u; y < quadsPerSide; ++y )
+  {
+    for( unsigned int x = 0u; x < quadsPerSide; ++x )
+    {
+      const unsigned int index = y * pointsPerSide + x + 1u;
+      stream << "f " << index << "/" << index << " "
+             << index + 1u << "/" << index + 1u << " "
+             << index + pointsPerSide + 1u << "/" << index + pointsPerSide + 1u << " "
+             << index + pointsPerSide << "/" << index + pointsPerSide << "\n";
+    }
+  }
+
+  return stream.str();
+}
+
+} // unnamed namespace
+
+int UtcDaliObjLoaderLoadObjectFaceFormats(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliObjLoaderLoadObjectFaceFormats" );
+
+  // Points only, with tabs, carriage returns and an exponent
+  {
+    std::string object( "# header\nv 0 0 0\nv\t1 0 0\r\nv 1 2.0e0 0\nv 0 2 -0.5\nf 1 2 3 4\n" );
+    ObjLoader objLoader;
+    DALI_TEST_CHECK( objLoader.LoadObject( &object[0], object.size() ) );
+    DALI_TEST_CHECK( objLoader.IsSceneLoaded() );
+    DALI_TEST_CHECK( !objLoader.IsTexturePresent() );
+    // The scene is scaled so its largest dimension is one
+    DALI_TEST_EQUALS( objLoader.GetSize(), Vector3( 0.5f, 1.0f, 0.25f ), TEST_LOCATION );
+
+    Geometry geometry = objLoader.CreateGeometry( 0, false );
+    DALI_TEST_CHECK( geometry );
+  }
+
+  // Points and normals
+  {
+    std::string object( "# header\nv 0 0 0\nv 1 0 0\nv 1 1 0\nvn 0 0 1\nf 1//1 2//1 3//1\n" );
+    ObjLoader objLoader;
+    DALI_TEST_CHECK( objLoader.LoadObject( &object[0], object.size() ) );
+    DALI_TEST_CHECK( !objLoader.IsTexturePresent() );
+    DALI_TEST_CHECK( objLoader.CreateGeometry( 0, true ) );
+  }
+
+  // Points and texture coordinates
+  {
+    std::string object( "# header\nv 0 0 0\nv 1 0 0\nv 1 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nf 1/1 2/2 3/3\n" );
+    ObjLoader objLoader;
+    DALI_TEST_CHECK( objLoader.LoadObject( &object[0], object.size() ) );
+    DALI_TEST_CHECK( objLoader.IsTexturePresent() );
+    DALI_TEST_CHECK( objLoader.CreateGeometry( ALL_OBJECT_PROPERTIES, true ) );
+  }
+
+  // Points, texture coordinates and normals
+  {
+    std::string object( "# header\nv 0 0 0\nv 1 0 0\nv 1 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nvn 0 0 1\nf 1/1/1 2/2/1 3/3/1\n" );
+    ObjLoader objLoader;
+    DALI_TEST_CHECK( objLoader.LoadObject( &object[0], object.size() ) );
+    DALI_TEST_CHECK( objLoader.IsTexturePresent() );
+    DALI_TEST_CHECK( objLoader.CreateGeometry( ALL_OBJECT_PROPERTIES, false ) );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliObjLoaderLoadMaterial(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliObjLoaderLoadMaterial" );
+
+  std::string material( "# header\nnewmtl material\nKd 1.0 1.0 1.0\nmap_Kd diffuse.png\r\nbump\tnormal.png\nmap_Ks gloss.png" );
+  std::string diffuseTextureUrl;
+  std::string normalTextureUrl;
+  std::string glossTextureUrl;
+
+  ObjLoader objLoader;
+  objLoader.LoadMaterial( &material[0], material.size(), diffuseTextureUrl, normalTextureUrl, glossTextureUrl );
+
+  DALI_TEST_CHECK( objLoader.IsMaterialLoaded() );
+  DALI_TEST_CHECK( objLoader.IsDiffuseMapPresent() );
+  DALI_TEST_CHECK( objLoader.IsNormalMapPresent() );
+  DALI_TEST_CHECK( objLoader.IsSpecularMapPresent() );
+  DALI_TEST_EQUALS( diffuseTextureUrl, std::string( "diffuse.png" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( normalTextureUrl, std::string( "normal.png" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( glossTextureUrl, std::string( "gloss.png" ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliObjLoaderLoadLargeObject(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliObjLoaderLoadLargeObject - Measures the time to load a large object and create its geometry" );
+
+  // The indices of the geometry are 16 bits, so keep the number of points below 65536
+  const unsigned int quadsPerSide = 250u;
+  std::string object = CreateGridObject( quadsPerSide );
+
+  ObjLoader objLoader;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  DALI_TEST_CHECK( objLoader.LoadObject( &object[0], object.size() ) );
+  std::chrono::steady_clock::time_point loaded = std::chrono::steady_clock::now();
+  Geometry geometry = objLoader.CreateGeometry( ALL_OBJECT_PROPERTIES, true );
+  std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now();
+
+  DALI_TEST_CHECK( geometry );
+  DALI_TEST_CHECK( objLoader.IsTexturePresent() );
+  DALI_TEST_EQUALS( objLoader.GetSize().x, 1.0f, Math::MACHINE_EPSILON_100, TEST_LOCATION );
+  DALI_TEST_EQUALS( objLoader.GetSize().y, 1.0f, Math::MACHINE_EPSILON_100, TEST_LOCATION );
+
+  tet_printf( "Loaded %u bytes in %lld ms, created the geometry in %lld ms\n",
+              static_cast<unsigned int>( object.size() ),
+              static_cast<long long>( std::chrono::duration_cast<std::chrono::milliseconds>( loaded - start ).count() ),
+              static_cast<long long>( std::chrono::duration_cast<std::chrono::milliseconds>( created - loaded ).count() ) );
+
+  END_TEST;
+}
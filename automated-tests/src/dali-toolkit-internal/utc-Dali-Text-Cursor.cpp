@@ -308,6 +308,7 @@ bool FindSelectionIndicesTest( const FindSelectionIndicesData& data )
 //////////////////////////////////////////////////////////
 //
 // UtcDaliGetClosestLine
+// UtcDaliGetClosestLineManyLines
 // UtcDaliGetClosestCursorIndex
 //
 //////////////////////////////////////////////////////////
@@ -375,6 +376,70 @@ int UtcDaliGetClosestLine(void)
   END_TEST;
 }
 
+int UtcDaliGetClosestLineManyLines(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliGetClosestLineManyLines");
+
+  const unsigned int numberOfParagraphs = 1000u;
+
+  std::string text;
+  for( unsigned int index = 0u; index < numberOfParagraphs; ++index )
+  {
+    text += "hello\n";
+  }
+  text += "world";
+
+  ModelPtr textModel;
+  MetricsPtr metrics;
+  Size textArea( 400.f, 600.f );
+  Size layoutSize;
+
+  Vector<FontDescriptionRun> fontDescriptionRuns;
+  LayoutOptions options;
+  CreateTextModel( text,
+                   textArea,
+                   fontDescriptionRuns,
+                   options,
+                   layoutSize,
+                   textModel,
+                   metrics,
+                   false );
+
+  VisualModelPtr visualModel = textModel->mVisualModel;
+  const Vector<LineRun>& lines = visualModel->mLines;
+  const Length numberOfLines = lines.Count();
+  DALI_TEST_EQUALS( numberOfLines, numberOfParagraphs + 1u, TEST_LOCATION );
+
+  // Traverse the lines backwards to miss the cached line.
+  for( LineIndex lineIndex = numberOfLines; lineIndex > 0u; --lineIndex )
+  {
+    const LineIndex index = lineIndex - 1u;
+    const LineRun& line = *( lines.Begin() + index );
+
+    const float lineOffset = CalculateLineOffset( visualModel, index );
+    DALI_TEST_EQUALS( lineOffset, CalculateLineOffset( lines, index ), Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+    bool isLineHit = false;
+    DALI_TEST_EQUALS( GetClosestLine( visualModel, lineOffset + 1.f, isLineHit ), index, TEST_LOCATION );
+    DALI_TEST_CHECK( isLineHit );
+
+    DALI_TEST_EQUALS( visualModel->GetLineOfCharacter( line.characterRun.characterIndex ), index, TEST_LOCATION );
+  }
+
+  // A point below the text matches the last line.
+  bool isLineHit = true;
+  DALI_TEST_EQUALS( GetClosestLine( visualModel, layoutSize.height + 100.f, isLineHit ), numberOfLines - 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( !isLineHit );
+
+  // The accumulated heights are updated when the lines change.
+  visualModel->mLines.Resize( 10u );
+  DALI_TEST_EQUALS( visualModel->GetLineOffsets().Count(), 10u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetClosestLine( visualModel, layoutSize.height, isLineHit ), 9u, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliGetClosestCursorIndex(void)
 {
   tet_infoline(" UtcDaliGetClosestCursorIndex");
@@ -25,6 +25,7 @@
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 #include <dali-toolkit/internal/visuals/texture-upload-observer.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/adaptor-framework/animated-image-loading.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 
 using namespace Dali::Toolkit::Internal;
@@ -45,6 +46,7 @@ namespace
 {
 
 const char* TEST_IMAGE_FILE_NAME =  TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+const char* TEST_GIF_FILE_NAME =  TEST_RESOURCE_DIR "/anim.gif";
 
 }
 
@@ -272,3 +274,52 @@ int UtcTextureManagerUseInvalidMask(void)
 
   END_TEST;
 }
+
+int UtcTextureManagerAnimatedImageFrameCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcTextureManagerAnimatedImageFrameCache" );
+
+  TextureManager textureManager; // Create new texture manager
+  textureManager.SetAnimatedImageFrameCacheBudget( 1024u * 1024u );
+
+  TestObserver observer1;
+  TextureManager::TextureId textureId1 = TextureManager::INVALID_TEXTURE_ID;
+  Dali::AnimatedImageLoading animatedImageLoading1 = Dali::AnimatedImageLoading::New( TEST_GIF_FILE_NAME, true );
+  textureManager.LoadAnimatedImageTexture( animatedImageLoading1, 0u, SamplingMode::BOX_THEN_LINEAR, false, textureId1,
+                                           WrapMode::DEFAULT, WrapMode::DEFAULT, &observer1 );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( observer1.mLoaded, true, TEST_LOCATION );
+
+  // The frame stays cached after its last user removed it
+  textureManager.Remove( textureId1, &observer1 );
+  DALI_TEST_EQUALS( textureManager.GetTextureState( textureId1 ), TextureManager::UPLOADED, TEST_LOCATION );
+
+  // Another visual showing the same frame gets the retained texture without decoding it again
+  TestObserver observer2;
+  TextureManager::TextureId textureId2 = TextureManager::INVALID_TEXTURE_ID;
+  Dali::AnimatedImageLoading animatedImageLoading2 = Dali::AnimatedImageLoading::New( TEST_GIF_FILE_NAME, true );
+  TextureSet textureSet = textureManager.LoadAnimatedImageTexture( animatedImageLoading2, 0u, SamplingMode::BOX_THEN_LINEAR, false, textureId2,
+                                                                   WrapMode::DEFAULT, WrapMode::DEFAULT, &observer2 );
+
+  DALI_TEST_EQUALS( textureId2, textureId1, TEST_LOCATION );
+  DALI_TEST_CHECK( textureSet );
+  DALI_TEST_EQUALS( observer2.mLoaded, true, TEST_LOCATION );
+
+  // Disabling the cache drops the retained frames
+  textureManager.Remove( textureId2, &observer2 );
+  DALI_TEST_EQUALS( textureManager.GetTextureState( textureId2 ), TextureManager::UPLOADED, TEST_LOCATION );
+
+  textureManager.SetAnimatedImageFrameCacheBudget( 0u );
+  DALI_TEST_EQUALS( textureManager.GetTextureState( textureId2 ), TextureManager::NOT_STARTED, TEST_LOCATION );
+
+  END_TEST;
+}
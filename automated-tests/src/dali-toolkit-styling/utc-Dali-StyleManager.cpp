@@ -309,6 +309,130 @@ int UtcDaliStyleManagerApplyTheme(void)
 }
 
 
+int UtcDaliStyleManagerApplyThemeChangesOnly(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline( "Testing StyleManager ApplyTheme only applies the style changed by the new theme" );
+
+  const char* json1 =
+    "{\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"testbutton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[1.0,1.0,0.0,1.0],\n"
+    "      \"foregroundColor\":[0.0,0.0,1.0,1.0],\n"
+    "      \"visuals\":\n"
+    "      {\n"
+    "        \"background\":\n"
+    "        {\n"
+    "          \"visualType\":\"COLOR\",\n"
+    "          \"mixColor\":[1.0,1.0,1.0,1.0]\n"
+    "        }\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  const char* json2 =
+    "{\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"testbutton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[1.0,0.0,0.0,1.0],\n"
+    "      \"foregroundColor\":[0.0,0.0,1.0,1.0],\n"
+    "      \"visuals\":\n"
+    "      {\n"
+    "        \"background\":\n"
+    "        {\n"
+    "          \"visualType\":\"COLOR\",\n"
+    "          \"mixColor\":[0.0,0.0,0.0,1.0]\n"
+    "        }\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  Test::TestButton testButton = Test::TestButton::New();
+  application.GetScene().Add( testButton );
+
+  std::string themeFile("ThemeOne");
+  Test::StyleMonitor::SetThemeFileOutput(themeFile, json1);
+  StyleManager::Get().ApplyTheme(themeFile);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( testButton.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::YELLOW), 0.001, TEST_LOCATION );
+  DALI_TEST_EQUALS( testButton.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR), Property::Value(Color::BLUE), 0.001, TEST_LOCATION );
+
+  Visual::Base backgroundVisual = DevelControl::GetVisual( Toolkit::Internal::GetImplementation( testButton ), Control::Property::BACKGROUND );
+  DALI_TEST_CHECK( backgroundVisual );
+
+  tet_infoline("Override the foreground property, which is unchanged by the new theme");
+  testButton.SetProperty( Test::TestButton::Property::FOREGROUND_COLOR, Color::GREEN );
+
+  std::string themeFile2("ThemeTwo");
+  Test::StyleMonitor::SetThemeFileOutput(themeFile2, json2);
+  StyleManager::Get().ApplyTheme(themeFile2);
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("Check that the changed property is applied and the overridden property is styled again");
+  DALI_TEST_EQUALS( testButton.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR), Property::Value(Color::RED), 0.001, TEST_LOCATION );
+  DALI_TEST_EQUALS( testButton.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR), Property::Value(Color::BLUE), 0.001, TEST_LOCATION );
+
+  tet_infoline("Check that the color visual is updated instead of replaced");
+  Visual::Base newBackgroundVisual = DevelControl::GetVisual( Toolkit::Internal::GetImplementation( testButton ), Control::Property::BACKGROUND );
+  DALI_TEST_CHECK( newBackgroundVisual == backgroundVisual );
+
+  Property::Map map;
+  newBackgroundVisual.CreatePropertyMap( map );
+  Property::Value* mixColor = map.Find( ColorVisual::Property::MIX_COLOR );
+  DALI_TEST_CHECK( mixColor );
+  DALI_TEST_EQUALS( mixColor->Get<Vector4>(), Color::BLACK, 0.001, TEST_LOCATION );
+
+  tet_infoline("Replace the background visual, which is changed by the next theme");
+  Property::Map appBackground;
+  appBackground.Insert( Visual::Property::TYPE, Visual::COLOR );
+  appBackground.Insert( ColorVisual::Property::MIX_COLOR, Color::GREEN );
+  testButton.SetProperty( Control::Property::BACKGROUND, appBackground );
+  Visual::Base appBackgroundVisual = DevelControl::GetVisual( Toolkit::Internal::GetImplementation( testButton ), Control::Property::BACKGROUND );
+
+  StyleManager::Get().ApplyTheme(themeFile);
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("Check that the replaced visual is styled again instead of updated");
+  newBackgroundVisual = DevelControl::GetVisual( Toolkit::Internal::GetImplementation( testButton ), Control::Property::BACKGROUND );
+  DALI_TEST_CHECK( newBackgroundVisual );
+  DALI_TEST_CHECK( newBackgroundVisual != appBackgroundVisual );
+
+  map.Clear();
+  newBackgroundVisual.CreatePropertyMap( map );
+  mixColor = map.Find( ColorVisual::Property::MIX_COLOR );
+  DALI_TEST_CHECK( mixColor );
+  DALI_TEST_EQUALS( mixColor->Get<Vector4>(), Color::WHITE, 0.001, TEST_LOCATION );
+
+  map.Clear();
+  appBackgroundVisual.CreatePropertyMap( map );
+  mixColor = map.Find( ColorVisual::Property::MIX_COLOR );
+  DALI_TEST_CHECK( mixColor );
+  DALI_TEST_EQUALS( mixColor->Get<Vector4>(), Color::GREEN, 0.001, TEST_LOCATION );
+
+  tet_infoline("Applying the same theme again styles the control entirely");
+  testButton.SetProperty( Test::TestButton::Property::FOREGROUND_COLOR, Color::GREEN );
+  StyleManager::Get().ApplyTheme(themeFile);
+  DALI_TEST_EQUALS( testButton.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR), Property::Value(Color::BLUE), 0.001, TEST_LOCATION );
+
+  END_TEST;
+}
+
+
 int UtcDaliStyleManagerApplyDefaultTheme(void)
 {
   tet_infoline( "Testing StyleManager ApplyTheme" );
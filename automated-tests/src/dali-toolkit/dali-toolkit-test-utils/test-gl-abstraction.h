@@ -233,11 +233,27 @@ public:
   inline void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) override
   {
     mBufferDataCalls.push_back(size);
+    if(target == GL_ARRAY_BUFFER)
+    {
+      mLastArrayBufferData.assign(size, 0u);
+      if(data)
+      {
+        memcpy(&mLastArrayBufferData[0], data, size);
+      }
+    }
   }
 
   inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) override
   {
     mBufferSubDataCalls.push_back(size);
+    if(target == GL_ARRAY_BUFFER && data)
+    {
+      if(mLastArrayBufferData.size() < static_cast<size_t>(offset + size))
+      {
+        mLastArrayBufferData.resize(offset + size, 0u);
+      }
+      memcpy(&mLastArrayBufferData[offset], data, size);
+    }
   }
 
   inline GLenum CheckFramebufferStatus(GLenum target) override
@@ -2351,11 +2367,20 @@ public: // TEST FUNCTIONS
     mBufferSubDataCalls.clear();
   }
 
+  /**
+   * @brief Gets the data of the last vertex buffer uploaded.
+   */
+  inline const std::vector<uint8_t>& GetLastArrayBufferData() const
+  {
+    return mLastArrayBufferData;
+  }
+
 private:
   GLuint                                mCurrentProgram;
   GLuint                                mCompileStatus;
   BufferDataCalls                       mBufferDataCalls;
   BufferSubDataCalls                    mBufferSubDataCalls;
+  std::vector<uint8_t>                  mLastArrayBufferData;
   GLuint                                mLinkStatus;
   GLint                                 mNumberOfActiveUniforms;
   GLint                                 mGetAttribLocationResult;
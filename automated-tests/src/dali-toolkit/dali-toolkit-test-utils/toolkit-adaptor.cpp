@@ -104,14 +104,32 @@ Integration::Scene Adaptor::GetScene( Dali::Window window )
 
 bool Adaptor::AddIdle( CallbackBase* callback, bool hasReturnValue )
 {
-  mCallbacks.PushBack( callback );
+  if( hasReturnValue )
+  {
+    mReturnCallbacks.PushBack( callback );
+  }
+  else
+  {
+    mCallbacks.PushBack( callback );
+  }
   return true;
 }
 
 void Adaptor::RemoveIdle( CallbackBase* callback )
 {
-  mCallbacks.Erase( std::find_if( mCallbacks.Begin(), mCallbacks.End(),
-                                  [ &callback ] ( CallbackBase* current ) { return callback == current; } ) );
+  auto it = std::find_if( mCallbacks.Begin(), mCallbacks.End(),
+                          [ &callback ] ( CallbackBase* current ) { return callback == current; } );
+  if( it != mCallbacks.End() )
+  {
+    mCallbacks.Erase( it );
+  }
+
+  it = std::find_if( mReturnCallbacks.Begin(), mReturnCallbacks.End(),
+                     [ &callback ] ( CallbackBase* current ) { return callback == current; } );
+  if( it != mReturnCallbacks.End() )
+  {
+    mReturnCallbacks.Erase( it );
+  }
 }
 
 void Adaptor::RunIdles()
@@ -122,6 +140,19 @@ void Adaptor::RunIdles()
   }
 
   mCallbacks.Clear();
+
+  // The callbacks with a return value are called again in the next run if they return true.
+  for( auto it = mReturnCallbacks.Begin(); it != mReturnCallbacks.End(); )
+  {
+    if( CallbackBase::ExecuteReturn< bool >( **it ) )
+    {
+      ++it;
+    }
+    else
+    {
+      it = mReturnCallbacks.Erase( it );
+    }
+  }
 }
 
 Dali::RenderSurfaceInterface& Adaptor::GetSurface()
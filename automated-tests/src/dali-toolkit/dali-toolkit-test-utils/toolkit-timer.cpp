@@ -36,6 +36,7 @@ typedef IntrusivePtr<Timer> TimerPtr;
 
 Dali::Timer::TimerSignalType gTickSignal;
 int gTimerCount = 0;
+int gRunningTimerCount = 0;
 bool gKeepTimersRunning = false;
 
 /**
@@ -108,15 +109,24 @@ Timer::Timer( unsigned int milliSec )
 Timer::~Timer()
 {
   --gTimerCount;
+  Stop();
 }
 
 void Timer::Start()
 {
+  if( !mRunning )
+  {
+    ++gRunningTimerCount;
+  }
   mRunning = true;
 }
 
 void Timer::Stop()
 {
+  if( mRunning )
+  {
+    --gRunningTimerCount;
+  }
   mRunning = false;
 }
 
@@ -248,6 +258,11 @@ int GetTimerCount()
   return Dali::Internal::Adaptor::gTimerCount;
 }
 
+int GetRunningTimerCount()
+{
+  return Dali::Internal::Adaptor::gRunningTimerCount;
+}
+
 void EmitGlobalTimerSignal()
 {
   // @todo Multiplex timers properly.
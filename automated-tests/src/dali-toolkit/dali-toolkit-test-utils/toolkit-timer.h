@@ -65,6 +65,7 @@ private:
 namespace Test
 {
 int GetTimerCount();
+int GetRunningTimerCount();
 void EmitGlobalTimerSignal();
 bool AreTimersRunning();
 }
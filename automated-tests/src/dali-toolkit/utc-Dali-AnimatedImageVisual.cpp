@@ -17,6 +17,8 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <chrono>
+#include <thread>
 #include <dali-toolkit-test-suite-utils.h>
 #include <toolkit-timer.h>
 #include <toolkit-event-thread-callback.h>
@@ -87,6 +89,10 @@ int UtcDaliAnimatedImageVisualGetPropertyMap01(void)
   DALI_TEST_CHECK( value );
   DALI_TEST_CHECK( value->Get<std::string>() == TEST_GIF_FILE_NAME );
 
+  value = resultMap.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT, Property::INTEGER );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_CHECK( value->Get<int>() == 0 );
+
   // request AnimatedImageVisual with an URL
   Visual::Base animatedImageVisual2 = factory.CreateVisual( TEST_GIF_FILE_NAME, ImageDimensions() );
   resultMap.Clear();
@@ -1135,4 +1141,246 @@ int UtcDaliAnimatedImageVisualPlayback(void)
   }
 
   END_TEST;
-}
\ No newline at end of file
+}
+void TestSuspendedFrameTimer( ToolkitTestApplication& application, Property::Index index, const Property::Value& hiddenValue, const Property::Value& shownValue, const char* location )
+{
+  Visual::Base animatedImageVisual = VisualFactory::Get().CreateVisual(
+    Property::Map()
+    .Add( Toolkit::Visual::Property::TYPE, Visual::ANIMATED_IMAGE )
+    .Add( ImageVisual::Property::URL, TEST_GIF_FILE_NAME )
+    .Add( DevelImageVisual::Property::LOOP_COUNT, -1 ));
+
+  DummyControl dummyControl = DummyControl::New(true);
+  Impl::DummyControl& dummyImpl = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, animatedImageVisual );
+  dummyControl.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS );
+
+  application.GetScene().Add( dummyControl );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_INNER_LOCATION( location ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::GetTimerCount(), 1, TEST_INNER_LOCATION( location ) );
+  DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 1, TEST_INNER_LOCATION( location ) );
+
+  tet_infoline( "Test that the frame timer stops while the actor is hidden" );
+  dummyControl.SetProperty( index, hiddenValue );
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 0, TEST_INNER_LOCATION( location ) );
+
+  tet_infoline( "Test that the frame timer restarts when the actor is shown again" );
+  dummyControl.SetProperty( index, shownValue );
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 1, TEST_INNER_LOCATION( location ) );
+
+  dummyControl.Unparent();
+}
+
+int UtcDaliAnimatedImageVisualSuspendWhenTransparent(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageVisualSuspendWhenTransparent" );
+
+  TestSuspendedFrameTimer( application, Actor::Property::OPACITY, 0.0f, 1.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageVisualSuspendWhenCulled(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageVisualSuspendWhenCulled" );
+
+  // Move the actor out of the view and back
+  TestSuspendedFrameTimer( application, Actor::Property::POSITION, Vector3( 2000.0f, 2000.0f, 0.0f ), Vector3::ZERO, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageVisualSkipFrames(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageVisualSkipFrames - Test the frames are skipped when the animation is resumed" );
+
+  Property::Array urls;
+  CopyUrlsIntoArray( urls );
+  const int frameCount = static_cast<int>( urls.Count() );
+
+  {
+    // All the frames are loaded at once and displayed every millisecond, and the animation is played once
+    Visual::Base visual = VisualFactory::Get().CreateVisual(
+      Property::Map()
+      .Add( Toolkit::Visual::Property::TYPE, Visual::IMAGE )
+      .Add( ImageVisual::Property::URL, Property::Value( urls ) )
+      .Add( ImageVisual::Property::BATCH_SIZE, frameCount )
+      .Add( ImageVisual::Property::CACHE_SIZE, frameCount )
+      .Add( ImageVisual::Property::FRAME_DELAY, 1 )
+      .Add( DevelImageVisual::Property::LOOP_COUNT, 1 ));
+
+    DummyControl dummyControl = DummyControl::New(true);
+    Impl::DummyControl& dummyImpl = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    dummyControl.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS );
+
+    application.GetScene().Add( dummyControl );
+    application.SendNotification();
+    application.Render(16);
+
+    DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( frameCount ), true, TEST_LOCATION );
+
+    application.SendNotification();
+    application.Render(16);
+
+    DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 1, TEST_LOCATION );
+
+    dummyControl.SetProperty( Actor::Property::OPACITY, 0.0f );
+    application.SendNotification();
+    application.Render(16);
+    application.SendNotification();
+
+    DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 0, TEST_LOCATION );
+
+    // Longer than the whole animation
+    std::this_thread::sleep_for( std::chrono::milliseconds( frameCount * 2 ) );
+
+    dummyControl.SetProperty( Actor::Property::OPACITY, 1.0f );
+    application.SendNotification();
+    application.Render(16);
+    application.SendNotification();
+
+    tet_infoline( "Test that all the frames are skipped and the animation is finished" );
+    Property::Map map = dummyControl.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+    Property::Value* value = map.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get<int>(), frameCount, TEST_LOCATION );
+    DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 0, TEST_LOCATION );
+
+    dummyControl.Unparent();
+  }
+
+  {
+    // The same animation played forever
+    Visual::Base visual = VisualFactory::Get().CreateVisual(
+      Property::Map()
+      .Add( Toolkit::Visual::Property::TYPE, Visual::IMAGE )
+      .Add( ImageVisual::Property::URL, Property::Value( urls ) )
+      .Add( ImageVisual::Property::BATCH_SIZE, frameCount )
+      .Add( ImageVisual::Property::CACHE_SIZE, frameCount )
+      .Add( ImageVisual::Property::FRAME_DELAY, 1 )
+      .Add( DevelImageVisual::Property::LOOP_COUNT, -1 ));
+
+    DummyControl dummyControl = DummyControl::New(true);
+    Impl::DummyControl& dummyImpl = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    dummyControl.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS );
+
+    application.GetScene().Add( dummyControl );
+    application.SendNotification();
+    application.Render(16);
+
+    DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( frameCount ), true, TEST_LOCATION );
+
+    application.SendNotification();
+    application.Render(16);
+
+    dummyControl.SetProperty( Actor::Property::OPACITY, 0.0f );
+    application.SendNotification();
+    application.Render(16);
+    application.SendNotification();
+
+    DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 0, TEST_LOCATION );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( frameCount * 2 ) );
+
+    dummyControl.SetProperty( Actor::Property::OPACITY, 1.0f );
+    application.SendNotification();
+    application.Render(16);
+    application.SendNotification();
+
+    tet_infoline( "Test that the frames of the whole loops are skipped and the animation goes on" );
+    Property::Map map = dummyControl.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+    Property::Value* value = map.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_CHECK( value->Get<int>() >= frameCount * 2 );
+    DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 1, TEST_LOCATION );
+
+    dummyControl.Unparent();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageVisualSkipFramesOnlyWhilePlaying(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageVisualSkipFramesOnlyWhilePlaying - Test the time the animation is paused while suspended is not skipped" );
+
+  Property::Array urls;
+  CopyUrlsIntoArray( urls );
+  const int frameCount = static_cast<int>( urls.Count() );
+
+  // The frames are displayed every 100 milliseconds, forever
+  Visual::Base visual = VisualFactory::Get().CreateVisual(
+    Property::Map()
+    .Add( Toolkit::Visual::Property::TYPE, Visual::IMAGE )
+    .Add( ImageVisual::Property::URL, Property::Value( urls ) )
+    .Add( ImageVisual::Property::BATCH_SIZE, frameCount )
+    .Add( ImageVisual::Property::CACHE_SIZE, frameCount )
+    .Add( ImageVisual::Property::FRAME_DELAY, 100 )
+    .Add( DevelImageVisual::Property::LOOP_COUNT, -1 ));
+
+  DummyControl dummyControl = DummyControl::New(true);
+  Impl::DummyControl& dummyImpl = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+  dummyControl.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS );
+
+  application.GetScene().Add( dummyControl );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( frameCount ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render(16);
+
+  dummyControl.SetProperty( Actor::Property::OPACITY, 0.0f );
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 0, TEST_LOCATION );
+
+  tet_infoline( "Pause the suspended animation for longer than several frames, then play it and resume it" );
+  Property::Map attributes;
+  DevelControl::DoAction( dummyControl, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedImageVisual::Action::PAUSE, attributes );
+
+  std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+
+  DevelControl::DoAction( dummyControl, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedImageVisual::Action::PLAY, attributes );
+
+  dummyControl.SetProperty( Actor::Property::OPACITY, 1.0f );
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  tet_infoline( "Test that no frame is skipped for the time the animation was paused" );
+  Property::Map map = dummyControl.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  Property::Value* value = map.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_EQUALS( value->Get<int>(), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( Test::GetRunningTimerCount(), 1, TEST_LOCATION );
+
+  dummyControl.Unparent();
+
+  END_TEST;
+}
@@ -61,6 +61,95 @@ void VisualEventSignal( Control control, Dali::Property::Index visualIndex, Dali
   }
 }
 
+void UnparentOnAnimationFinished( Control control, Dali::Property::Index visualIndex, Dali::Property::Index signalId )
+{
+  if( visualIndex == DummyControl::Property::TEST_VISUAL && signalId == DevelAnimatedVectorImageVisual::Signal::ANIMATION_FINISHED )
+  {
+    gAnimationFinishedSignalFired = true;
+    control.Unparent();
+  }
+}
+
+/**
+ * Plays the animation while the actor is hidden by setting the property to the hidden value,
+ * and checks that the frames are skipped instead of being rasterized until the property is set to the shown value.
+ */
+void TestSuspendedPlayback( ToolkitTestApplication& application, Property::Index index, const Property::Value& hiddenValue, const Property::Value& shownValue, const char* location )
+{
+  Property::Map propertyMap;
+  propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+             .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+             .Add( DevelImageVisual::Property::LOOP_COUNT, 1 );
+
+  Visual::Base visual = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  DummyControl actor = DummyControl::New( true );
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+
+  Vector2 controlSize( 20.f, 30.f );
+  actor.SetProperty( Actor::Property::SIZE, controlSize );
+
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetRendererCount(), 1u, TEST_INNER_LOCATION( location ) );
+  Renderer renderer = actor.GetRendererAt( 0u );
+
+  // Hide the actor before playing, so that no frame is rasterized
+  actor.SetProperty( index, hiddenValue );
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+
+  DevelControl::DoAction( actor, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( renderer.GetProperty< int >( DevelRenderer::Property::RENDERING_BEHAVIOR ), static_cast< int >( DevelRenderer::Rendering::IF_REQUIRED ), TEST_INNER_LOCATION( location ) );
+
+  // The whole animation would have been played in the meantime
+  std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+
+  // The animation is still playing but the current frame does not advance
+  Property::Map map = actor.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  Property::Value* value = map.Find( DevelImageVisual::Property::PLAY_STATE );
+  DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::PlayState::PLAYING ), TEST_INNER_LOCATION( location ) );
+
+  value = map.Find( DevelImageVisual::Property::CURRENT_FRAME_NUMBER );
+  DALI_TEST_EQUALS( value->Get< int >(), 0, TEST_INNER_LOCATION( location ) );
+
+  value = map.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT );
+  DALI_TEST_EQUALS( value->Get< int >(), 0, TEST_INNER_LOCATION( location ) );
+
+  // Show the actor again
+  actor.SetProperty( index, shownValue );
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( renderer.GetProperty< int >( DevelRenderer::Property::RENDERING_BEHAVIOR ), static_cast< int >( DevelRenderer::Rendering::CONTINUOUSLY ), TEST_INNER_LOCATION( location ) );
+
+  // The animation jumps to the last frame and finishes - the first trigger is the rasterization of the renderer
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_INNER_LOCATION( location ) );
+
+  map = actor.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  value = map.Find( DevelImageVisual::Property::PLAY_STATE );
+  DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::PlayState::STOPPED ), TEST_INNER_LOCATION( location ) );
+
+  value = map.Find( DevelImageVisual::Property::CURRENT_FRAME_NUMBER );
+  DALI_TEST_EQUALS( value->Get< int >(), VECTOR_ANIMATION_TOTAL_FRAME_NUMBER - 1, TEST_INNER_LOCATION( location ) );
+
+  value = map.Find( DevelImageVisual::Property::SKIPPED_FRAME_COUNT );
+  DALI_TEST_CHECK( value->Get< int >() > 0 );
+}
+
 }
 
 int UtcDaliVisualFactoryGetAnimatedVectorImageVisual01(void)
@@ -1366,6 +1455,264 @@ int UtcDaliAnimatedVectorImageVisualMultipleInstances(void)
   END_TEST;
 }
 
+int UtcDaliAnimatedVectorImageVisualSharedRasterization(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualSharedRasterization" );
+
+  Property::Map propertyMap;
+  propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+             .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+             .Add( DevelImageVisual::Property::SHARED_RASTERIZATION, true );
+
+  Visual::Base visual1 = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual1 );
+
+  Property::Map resultMap;
+  visual1.CreatePropertyMap( resultMap );
+
+  Property::Value* value = resultMap.Find( DevelImageVisual::Property::SHARED_RASTERIZATION );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_EQUALS( value->Get< bool >(), true, TEST_LOCATION );
+
+  Visual::Base visual2 = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual2 );
+
+  DummyControl actor1 = DummyControl::New( true );
+  DummyControlImpl& dummyImpl1 = static_cast< DummyControlImpl& >( actor1.GetImplementation() );
+  dummyImpl1.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual1 );
+
+  DummyControl actor2 = DummyControl::New( true );
+  DummyControlImpl& dummyImpl2 = static_cast< DummyControlImpl& >( actor2.GetImplementation() );
+  dummyImpl2.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual2 );
+
+  Vector2 controlSize( 20.f, 30.f );
+  actor1.SetProperty( Actor::Property::SIZE, controlSize );
+  actor2.SetProperty( Actor::Property::SIZE, controlSize );
+
+  // The first visual creates the shared task
+  application.GetScene().Add( actor1 );
+
+  application.SendNotification();
+  application.Render();
+
+  application.GetScene().Add( actor2 );
+
+  DevelControl::DoAction( actor1, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+  DevelControl::DoAction( actor2, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+
+  application.SendNotification();
+  application.Render();
+
+  // Both renderers display the same rasterized result
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+
+  Renderer renderer1 = actor1.GetRendererAt( 0u );
+  Renderer renderer2 = actor2.GetRendererAt( 0u );
+  DALI_TEST_CHECK( renderer1 != renderer2 );
+  DALI_TEST_CHECK( renderer1.GetTextures() == renderer2.GetTextures() );
+
+  // Stopping one visual doesn't stop the shared animation
+  DevelControl::DoAction( actor1, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::STOP, Property::Map() );
+
+  application.SendNotification();
+  application.Render();
+
+  Property::Map map = actor2.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  value = map.Find( DevelImageVisual::Property::PLAY_STATE );
+  DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::PlayState::PLAYING ), TEST_LOCATION );
+
+  // The renderer of the released visual doesn't display the shared result any more
+  TextureSet sharedTextures = renderer2.GetTextures();
+  Texture sharedTexture = sharedTextures.GetTexture( 0u );
+  DALI_TEST_CHECK( sharedTexture );
+
+  actor1.Unparent();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 0u );
+  DALI_TEST_CHECK( renderer1.GetTextures() != sharedTextures );
+
+  // The renderer of the remaining visual displays the result instead
+  DALI_TEST_CHECK( actor2.GetRendererAt( 0u ).GetTextures() == sharedTextures );
+  DALI_TEST_CHECK( sharedTextures.GetTexture( 0u ) != sharedTexture );
+
+  // Another size doesn't share the result
+  actor2.SetProperty( Actor::Property::SIZE, Vector2( 50.0f, 50.0f ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( sharedTextures != actor2.GetRendererAt( 0u ).GetTextures() );
+
+  actor2.Unparent();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 0u );
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 0u );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualSharedRasterizationSettings(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualSharedRasterizationSettings" );
+
+  Property::Map propertyMap;
+  propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+             .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+             .Add( DevelImageVisual::Property::SHARED_RASTERIZATION, true );
+
+  Visual::Base visual1 = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual1 );
+
+  // The visual reports its own state before a task loads the file
+  Property::Map resultMap;
+  visual1.CreatePropertyMap( resultMap );
+
+  Property::Value* value = resultMap.Find( DevelImageVisual::Property::TOTAL_FRAME_NUMBER );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_EQUALS( value->Get< int >(), 0, TEST_LOCATION );
+  DALI_TEST_CHECK( resultMap.Find( DevelImageVisual::Property::PLAY_RANGE ) );
+  DALI_TEST_CHECK( resultMap.Find( DevelImageVisual::Property::CONTENT_INFO ) );
+
+  propertyMap.Add( DevelImageVisual::Property::LOOP_COUNT, 2 );
+  Visual::Base visual2 = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual2 );
+
+  DummyControl actor1 = DummyControl::New( true );
+  DummyControlImpl& dummyImpl1 = static_cast< DummyControlImpl& >( actor1.GetImplementation() );
+  dummyImpl1.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual1 );
+
+  DummyControl actor2 = DummyControl::New( true );
+  DummyControlImpl& dummyImpl2 = static_cast< DummyControlImpl& >( actor2.GetImplementation() );
+  dummyImpl2.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual2 );
+
+  Vector2 controlSize( 20.f, 30.f );
+  actor1.SetProperty( Actor::Property::SIZE, controlSize );
+  actor2.SetProperty( Actor::Property::SIZE, controlSize );
+
+  application.GetScene().Add( actor1 );
+  application.GetScene().Add( actor2 );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+
+  // The visuals with different loop counts don't share the result
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ).GetTextures() != actor2.GetRendererAt( 0u ).GetTextures() );
+
+  // The visuals share the result once they have the same playback settings
+  Property::Map attributes;
+  attributes.Add( DevelImageVisual::Property::LOOP_COUNT, 2 );
+  DevelControl::DoAction( actor1, DummyControl::Property::TEST_VISUAL, DevelAnimatedVectorImageVisual::Action::UPDATE_PROPERTY, attributes );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ).GetTextures() == actor2.GetRendererAt( 0u ).GetTextures() );
+
+  // A visual which jumps to another frame doesn't share the result any more
+  DevelControl::DoAction( actor2, DummyControl::Property::TEST_VISUAL, DevelAnimatedVectorImageVisual::Action::JUMP_TO, 2 );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( actor1.GetRendererAt( 0u ).GetTextures() != actor2.GetRendererAt( 0u ).GetTextures() );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualSharedRasterizationReleaseOnFinished(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualSharedRasterizationReleaseOnFinished" );
+
+  // The second renderer instance of the test adaptor is slow, so let another visual create it
+  Property::Map propertyMap;
+  propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+             .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME );
+
+  Visual::Base unsharedVisual = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( unsharedVisual );
+
+  propertyMap.Add( DevelImageVisual::Property::SHARED_RASTERIZATION, true )
+             .Add( DevelImageVisual::Property::LOOP_COUNT, 1 );
+
+  Visual::Base visual = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  Vector2 naturalSize;
+  visual.GetNaturalSize( naturalSize );
+
+  DummyControl actor = DummyControl::New( true );
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+
+  gAnimationFinishedSignalFired = false;
+  DevelControl::VisualEventSignal( actor ).Connect( &UnparentOnAnimationFinished );
+
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 20.0f, 30.0f ) );
+  application.GetScene().Add( actor );
+
+  DevelControl::DoAction( actor, DummyControl::Property::TEST_VISUAL, DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor.GetRendererCount() == 1u );
+
+  // The last owner releases the shared task while it is notified
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( gAnimationFinishedSignalFired, true, TEST_LOCATION );
+  DALI_TEST_CHECK( actor.GetRendererCount() == 0u );
+
+  // The released task is finalized in the next event processing
+  application.SendNotification();
+  application.Render();
+
+  // The visual can share a new task
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( actor.GetRendererCount() == 1u );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualSuspendWhenTransparent(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualSuspendWhenTransparent" );
+
+  TestSuspendedPlayback( application, Actor::Property::OPACITY, 0.0f, 1.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualSuspendWhenCulled(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualSuspendWhenCulled" );
+
+  // Move the actor out of the view and back
+  TestSuspendedPlayback( application, Actor::Property::POSITION, Vector3( 2000.0f, 2000.0f, 0.0f ), Vector3::ZERO, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliAnimatedVectorImageVisualControlVisibilityChanged(void)
 {
   ToolkitTestApplication application;
@@ -264,6 +264,35 @@ int UtcDaliBubbleEmitterSetBubbleDensity02(void)
   END_TEST;
 }
 
+int UtcDaliBubbleEmitterSetBubbleDensity03(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( " UtcDaliBubbleEmitterSetBubbleDensity03 - the density changes the rendered index range of the geometry" );
+
+  Texture shapeImage = CreateSolidColorTexture( application, Color::GREEN, 5, 5 );
+  BubbleEmitter emitter = BubbleEmitter::New( Vector2(50.f,50.f),shapeImage, 200, Vector2( 5.f, 10.f ));
+
+  // 200 bubbles are shared by two renderers; six indices per bubble patch; default density is five
+  Actor root = emitter.GetRootActor();
+  DALI_TEST_EQUALS( root.GetRendererCount(), 2u, TEST_LOCATION );
+  Renderer bubbleRenderer = root.GetRendererAt( 0 );
+  Geometry geometry = bubbleRenderer.GetGeometry();
+  DALI_TEST_EQUALS( bubbleRenderer.GetProperty<int>( Renderer::Property::INDEX_RANGE_COUNT ), 100 * 5 * 6, TEST_LOCATION );
+
+  emitter.SetBubbleDensity( 3 );
+  DALI_TEST_EQUALS( bubbleRenderer.GetProperty<int>( Renderer::Property::INDEX_RANGE_COUNT ), 100 * 3 * 6, TEST_LOCATION );
+  DALI_TEST_EQUALS( root.GetRendererAt( 1 ).GetProperty<int>( Renderer::Property::INDEX_RANGE_COUNT ), 100 * 3 * 6, TEST_LOCATION );
+
+  // The geometry is not recreated
+  DALI_TEST_CHECK( bubbleRenderer.GetGeometry() == geometry );
+
+  application.GetScene().Add( root );
+  application.SendNotification();
+  application.Render();
+
+  END_TEST;
+}
+
 int UtcDaliBubbleEmitterEmitBubble(void)
 {
   ToolkitTestApplication application;
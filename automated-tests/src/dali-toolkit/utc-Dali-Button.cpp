@@ -27,6 +27,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/buttons/button-devel.h>
 
 using namespace Dali;
@@ -1047,3 +1048,95 @@ int UtcDaliButtonMultiTouch(void)
 
   END_TEST;
 }
+
+int UtcDaliButtonStateVisualsCreatedWhenRequired(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliButtonStateVisualsCreatedWhenRequired");
+
+  PushButton button = PushButton::New();
+  button.SetProperty( Button::Property::TOGGLABLE, true );
+  Toolkit::Internal::Control& controlImpl = Toolkit::Internal::GetImplementation( button );
+
+  Property::Map unselectedMap;
+  unselectedMap[ Visual::Property::TYPE ] = Visual::COLOR;
+  unselectedMap[ ColorVisual::Property::MIX_COLOR ] = Color::BLUE;
+  Property::Map selectedMap;
+  selectedMap[ Visual::Property::TYPE ] = Visual::COLOR;
+  selectedMap[ ColorVisual::Property::MIX_COLOR ] = Color::RED;
+
+  button.SetProperty( Button::Property::UNSELECTED_BACKGROUND_VISUAL, unselectedMap );
+  button.SetProperty( Button::Property::SELECTED_BACKGROUND_VISUAL, selectedMap );
+
+  tet_infoline(" No state visual is created while the button is off scene");
+  DALI_TEST_CHECK( !DevelControl::GetVisual( controlImpl, Button::Property::UNSELECTED_BACKGROUND_VISUAL ) );
+  DALI_TEST_CHECK( !DevelControl::GetVisual( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+
+  button.SetProperty( Actor::Property::SIZE, Vector2( 100.f, 100.f ) );
+  application.GetScene().Add( button );
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline(" Only the visual of the current state is created on scene");
+  DALI_TEST_CHECK( DevelControl::GetVisual( controlImpl, Button::Property::UNSELECTED_BACKGROUND_VISUAL ) );
+  DALI_TEST_CHECK( !DevelControl::GetVisual( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+
+  button.SetProperty( Button::Property::SELECTED, true );
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline(" The visual is created when its state is entered");
+  DALI_TEST_CHECK( DevelControl::GetVisual( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+  DALI_TEST_CHECK( DevelControl::IsVisualEnabled( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+
+  tet_infoline(" The property map of a deferred visual is still returned");
+  button.SetProperty( Button::Property::DISABLED_UNSELECTED_BACKGROUND_VISUAL, unselectedMap );
+  DALI_TEST_CHECK( !DevelControl::GetVisual( controlImpl, Button::Property::DISABLED_UNSELECTED_BACKGROUND_VISUAL ) );
+
+  Property::Map* resultMap = button.GetProperty( Button::Property::DISABLED_UNSELECTED_BACKGROUND_VISUAL ).GetMap();
+  DALI_TEST_CHECK( resultMap );
+  Property::Value* mixColor = resultMap->Find( ColorVisual::Property::MIX_COLOR );
+  DALI_TEST_CHECK( mixColor );
+  DALI_TEST_EQUALS( mixColor->Get< Vector4 >(), Color::BLUE, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliButtonPrefetchStateVisuals(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliButtonPrefetchStateVisuals");
+
+  PushButton button = PushButton::New();
+  Toolkit::Internal::Control& controlImpl = Toolkit::Internal::GetImplementation( button );
+  DALI_TEST_EQUALS( button.GetProperty< bool >( DevelButton::Property::PREFETCH_STATE_VISUALS ), false, TEST_LOCATION );
+
+  button.SetProperty( DevelButton::Property::PREFETCH_STATE_VISUALS, true );
+  DALI_TEST_EQUALS( button.GetProperty< bool >( DevelButton::Property::PREFETCH_STATE_VISUALS ), true, TEST_LOCATION );
+
+  Property::Map colorMap;
+  colorMap[ Visual::Property::TYPE ] = Visual::COLOR;
+  colorMap[ ColorVisual::Property::MIX_COLOR ] = Color::RED;
+  button.SetProperty( Button::Property::SELECTED_BACKGROUND_VISUAL, colorMap );
+  button.SetProperty( Button::Property::DISABLED_UNSELECTED_BACKGROUND_VISUAL, colorMap );
+
+  tet_infoline(" The state visuals are not prefetched while the button is off scene");
+  application.RunIdles();
+  DALI_TEST_CHECK( !DevelControl::GetVisual( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+
+  button.SetProperty( Actor::Property::SIZE, Vector2( 100.f, 100.f ) );
+  application.GetScene().Add( button );
+  application.SendNotification();
+  application.Render();
+
+  // One visual is created per idle callback
+  application.RunIdles();
+  application.RunIdles();
+
+  tet_infoline(" The state visuals are created at idle, but not enabled");
+  DALI_TEST_CHECK( DevelControl::GetVisual( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+  DALI_TEST_CHECK( DevelControl::GetVisual( controlImpl, Button::Property::DISABLED_UNSELECTED_BACKGROUND_VISUAL ) );
+  DALI_TEST_CHECK( !DevelControl::IsVisualEnabled( controlImpl, Button::Property::SELECTED_BACKGROUND_VISUAL ) );
+
+  END_TEST;
+}
@@ -26,7 +26,10 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/public-api/align-enumerations.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/controls/control-pool.h>
 #include <dali-toolkit/devel-api/controls/alignment/alignment.h>
+#include <dali-toolkit/devel-api/controls/popup/popup.h>
+#include <dali-toolkit/devel-api/visual-factory/transition-data.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-actions-devel.h>
 
@@ -1244,3 +1247,262 @@ int UtcDaliControlDoActionWhenNotStage(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+// The position, local position, half size, color and shape of a vertex of the batch renderers
+const size_t BATCH_VERTEX_FLOATS = 14u;
+const size_t BATCH_VERTEX_SIZE = BATCH_VERTEX_FLOATS * sizeof( float );
+
+const float* GetBatchVertex( TestGlAbstraction& gl, size_t vertex )
+{
+  return reinterpret_cast< const float* >( &gl.GetLastArrayBufferData()[0] ) + vertex * BATCH_VERTEX_FLOATS;
+}
+
+Vector2 GetBatchVertexPosition( TestGlAbstraction& gl, size_t vertex )
+{
+  const float* data = GetBatchVertex( gl, vertex );
+  return Vector2( data[0], data[1] );
+}
+
+Vector4 GetBatchVertexColor( TestGlAbstraction& gl, size_t vertex )
+{
+  const float* data = GetBatchVertex( gl, vertex );
+  return Vector4( data[6], data[7], data[8], data[9] );
+}
+
+// The changes of the actors are notified after the update, then the batch is rebuilt and uploaded in the next frame
+void RenderBatch( ToolkitTestApplication& application )
+{
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+}
+
+} // unnamed namespace
+
+int UtcDaliControlBatchParentProperty(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the color visuals under a batch parent are drawn by the renderer of the batch parent" );
+
+  Control parent = Control::New();
+  parent.SetProperty( DevelControl::Property::BATCH_PARENT, true );
+  parent.SetProperty( Actor::Property::SIZE, Vector2( 400.f, 400.f ) );
+  DALI_TEST_EQUALS( parent.GetProperty< bool >( DevelControl::Property::BATCH_PARENT ), true, TEST_LOCATION );
+
+  std::vector< Control > children;
+  for( int i = 0; i < 10; ++i )
+  {
+    Control child = Control::New();
+    child.SetProperty( Control::Property::BACKGROUND, Color::RED );
+    child.SetProperty( Actor::Property::SIZE, Vector2( 20.f, 20.f ) );
+    child.SetProperty( Actor::Property::POSITION, Vector2( i * 20.f, 0.f ) );
+    child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+    child.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
+    parent.Add( child );
+    children.push_back( child );
+  }
+  application.GetScene().Add( parent );
+
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline( "The backgrounds of the children are drawn by one renderer of the batch parent" );
+  DALI_TEST_EQUALS( parent.GetRendererCount(), 1u, TEST_LOCATION );
+  for( auto&& child : children )
+  {
+    DALI_TEST_EQUALS( child.GetRendererCount(), 0u, TEST_LOCATION );
+  }
+
+  tet_infoline( "The quads are laid out at the positions of the children, relative to the centre of the batch parent" );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 10u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 5u * 4u ), Vector2( 90.f, -10.f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 5u * 4u + 3u ), Vector2( 110.f, 10.f ), TEST_LOCATION );
+
+  tet_infoline( "The quad of a child follows it when it moves" );
+  children[5].SetProperty( Actor::Property::POSITION, Vector2( 100.f, 50.f ) );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 10u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 5u * 4u ), Vector2( 90.f, 40.f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 4u * 4u ), Vector2( 70.f, -10.f ), TEST_LOCATION );
+
+  tet_infoline( "The quad of a child follows its animated position" );
+  Animation animation = Animation::New( 1.0f );
+  animation.AnimateTo( Property( children[6], Actor::Property::POSITION ), Vector3( 0.f, 100.f, 0.f ), AlphaFunction::LINEAR );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 500 ); // Half way through the animation
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 6u * 4u ), Vector2( 50.f, 40.f ), 0.01f, TEST_LOCATION );
+
+  application.Render( 600 ); // The end of the animation
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 6u * 4u ), Vector2( -10.f, 90.f ), TEST_LOCATION );
+
+  tet_infoline( "The quad of a hidden child is removed" );
+  children[7].SetProperty( Actor::Property::VISIBLE, false );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 9u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetBatchVertexPosition( gl, 7u * 4u ), Vector2( 150.f, -10.f ), TEST_LOCATION );
+
+  tet_infoline( "The quad of a child is drawn with its color" );
+  children[8].SetProperty( Actor::Property::COLOR, Vector4( 1.f, 1.f, 1.f, 0.5f ) );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( GetBatchVertexColor( gl, 7u * 4u ), Vector4( 1.f, 0.f, 0.f, 0.5f ), TEST_LOCATION );
+
+  tet_infoline( "A child whose background is animated draws its own background" );
+  Property::Map transitionMap;
+  transitionMap["target"] = "background";
+  transitionMap["property"] = "mixColor";
+  transitionMap["targetValue"] = Color::BLUE;
+  transitionMap["animator"] = Property::Map().Add( "timePeriod", Property::Map().Add( "duration", 1.0f ) );
+  Animation transition = DevelControl::CreateTransition( Toolkit::Internal::GetImplementation( children[9] ), TransitionData::New( transitionMap ) );
+  DALI_TEST_CHECK( transition );
+  transition.Play();
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( children[9].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 8u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+
+  tet_infoline( "A child moved out of the batch parent draws its own background" );
+  application.GetScene().Add( children[0] );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( children[0].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( parent.GetRendererCount(), 1u, TEST_LOCATION );
+
+  tet_infoline( "The children draw their own backgrounds when the control is not a batch parent any more" );
+  parent.SetProperty( DevelControl::Property::BATCH_PARENT, false );
+  DALI_TEST_EQUALS( parent.GetProperty< bool >( DevelControl::Property::BATCH_PARENT ), false, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( parent.GetRendererCount(), 0u, TEST_LOCATION );
+  for( auto&& child : children )
+  {
+    DALI_TEST_EQUALS( child.GetRendererCount(), 1u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliControlBatchParentDrawOrder(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the visuals under a batch parent are only batched when this does not change what is drawn" );
+
+  Control parent = Control::New();
+  parent.SetProperty( DevelControl::Property::BATCH_PARENT, true );
+  parent.SetProperty( Actor::Property::SIZE, Vector2( 400.f, 400.f ) );
+
+  std::vector< Control > children;
+  for( int i = 0; i < 3; ++i )
+  {
+    Control child = Control::New();
+    child.SetProperty( Control::Property::BACKGROUND, Color::RED );
+    child.SetProperty( Actor::Property::SIZE, Vector2( 20.f, 20.f ) );
+    child.SetProperty( Actor::Property::POSITION, Vector2( i * 20.f, 0.f ) );
+    parent.Add( child );
+    children.push_back( child );
+  }
+  application.GetScene().Add( parent );
+
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  DALI_TEST_EQUALS( parent.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 3u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+
+  tet_infoline( "A scaled child draws its own background" );
+  children[2].SetProperty( Actor::Property::SCALE, Vector3( 0.5f, 0.5f, 1.0f ) );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( children[2].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 2u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+
+  tet_infoline( "A child drawn after a renderer which is not batched draws its own background" );
+  Actor content = Actor::New();
+  content.AddRenderer( Renderer::New( Geometry::New(), Shader::New( "vertexSrc", "fragmentSrc" ) ) );
+  parent.Add( content );
+  content.LowerBelow( children[1] );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( children[0].GetRendererCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( children[1].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), 1u * 4u * BATCH_VERTEX_SIZE, TEST_LOCATION );
+
+  tet_infoline( "The batched backgrounds of the children are drawn after the renderers of the batch parent" );
+  Renderer parentRenderer = Renderer::New( Geometry::New(), Shader::New( "vertexSrc", "fragmentSrc" ) );
+  parentRenderer.SetProperty( Renderer::Property::DEPTH_INDEX, 10 );
+  parent.AddRenderer( parentRenderer );
+  RenderBatch( application );
+
+  DALI_TEST_EQUALS( children[0].GetRendererCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( parent.GetRendererCount(), 2u, TEST_LOCATION );
+  Renderer batchRenderer = ( parent.GetRendererAt( 0u ) == parentRenderer ) ? parent.GetRendererAt( 1u ) : parent.GetRendererAt( 0u );
+  DALI_TEST_EQUALS( batchRenderer.GetProperty< int >( Renderer::Property::DEPTH_INDEX ), 11, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliControlPoolReserveAndAcquire(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test the control pool creates the reserved controls when idle" );
+
+  ControlPool pool = ControlPool::Get();
+  DALI_TEST_CHECK( pool );
+
+  pool.Reserve( "Popup", 2u );
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 0u, TEST_LOCATION );
+
+  tet_infoline( "One control is created per idle callback" );
+  application.RunIdles();
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 1u, TEST_LOCATION );
+  application.RunIdles();
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 2u, TEST_LOCATION );
+
+  tet_infoline( "Acquire a pooled control, the pool is refilled when idle" );
+  Popup popup = Popup::DownCast( pool.Acquire( "Popup" ) );
+  DALI_TEST_CHECK( popup );
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 1u, TEST_LOCATION );
+  application.RunIdles();
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 2u, TEST_LOCATION );
+
+  tet_infoline( "Lowering the budget releases the pooled controls" );
+  pool.Reserve( "Popup", 0u );
+  DALI_TEST_EQUALS( pool.GetPooledCount( "Popup" ), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliControlPoolAcquireN(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test the control pool doesn't create unknown types" );
+
+  ControlPool pool = ControlPool::Get();
+  pool.Reserve( "NotAType", 1u );
+  application.RunIdles();
+  DALI_TEST_EQUALS( pool.GetPooledCount( "NotAType" ), 0u, TEST_LOCATION );
+
+  Control control = pool.Acquire( "NotAType" );
+  DALI_TEST_CHECK( !control );
+
+  END_TEST;
+}
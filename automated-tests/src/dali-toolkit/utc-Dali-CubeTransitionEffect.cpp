@@ -42,12 +42,31 @@ const Vector2 PAN_POSITION1( VIEW_AREA_SIZE.x * 0.75f, VIEW_AREA_SIZE.y * 0.25f
 const Vector2 PAN_DISPLACEMENT1( -5.f, 5.f );
 const Vector2 PAN_POSITION2( VIEW_AREA_SIZE.x * 0.25f, VIEW_AREA_SIZE.y * 0.75f );
 const Vector2 PAN_DISPLACEMENT2( 5.f, 5.f );
-const Vector4 FULL_BRIGHTNESS(1.f,1.f,1.f,1.f);
-const Vector4 HALF_BRIGHTNESS(0.5f, 0.5f, 0.5f, 1.f);
 const int RENDER_FRAME_INTERVAL = 16;
-static const float FLT_EPISILON = 0.0001f;
 static const float EPISILON = 0.05f;
-const float TRANSITION_BEFORE_END_DURATION = TRANSITION_DURATION - 0.05f;
+static const float FLT_EPISILON = 0.0001f;
+const unsigned int HALF_TRANSITION_INTERVAL = static_cast< unsigned int >( TRANSITION_DURATION * 500.f );
+const float THIRD = 1.f / 3.f;
+
+const float FULL_BRIGHTNESS = 1.f;
+const float HALF_BRIGHTNESS = 0.5f;
+const float MIDDLE_BRIGHTNESS = 0.5625f; // the brightness of both faces when a cube is half way through its rotation
+
+// The vertices of the cubes: position, texCoord, boxCentre, rotation, displacement, timing and target
+const unsigned int TILE_VERTEX_FLOATS = 18u;
+const unsigned int TILE_TEXCOORD = 3u;
+const unsigned int TILE_ROTATION = 8u;
+const unsigned int TILE_TIMING = 15u;
+const unsigned int TILE_TARGET = 17u;
+const unsigned int VERTICES_PER_FACE = 4u;
+const unsigned int VERTICES_PER_TILE = 2u * VERTICES_PER_FACE;
+
+// The centre of the target face of a cube, relative to the centre of the cube
+const Vector2 TILE_SIZE( VIEW_AREA_SIZE.x / NUM_COLUMNS, VIEW_AREA_SIZE.y / NUM_ROWS );
+const Vector3 RIGHT_FACE( TILE_SIZE.x * 0.5f, 0.f, 0.f );
+const Vector3 LEFT_FACE( -TILE_SIZE.x * 0.5f, 0.f, 0.f );
+const Vector3 TOP_FACE( 0.f, TILE_SIZE.y * 0.5f, 0.f );
+const Vector3 BOTTOM_FACE( 0.f, -TILE_SIZE.y * 0.5f, 0.f );
 
 static bool gObjectCreatedCallBackCalled;
 static void TestCallback(BaseHandle handle)
@@ -104,6 +123,134 @@ public:
   Texture&               mActorTransitTo;
 };
 
+/**
+ * Check that the cubes of a running transition are drawn by a single renderer of the effect
+ * @param[in] effect The effect
+ * @param[in] progress The expected progress of the transition
+ * @param[in] epsilon The tolerance of the progress
+ * @param[in] location The location of the test
+ */
+void CheckTransitionProgress( CubeTransitionEffect& effect, float progress, float epsilon, const char* location )
+{
+  DALI_TEST_EQUALS( effect.GetChildCount(), 0u, location );
+  DALI_TEST_EQUALS( effect.GetRendererCount(), 1u, location );
+
+  Renderer renderer = effect.GetRendererAt( 0u );
+  Property::Index progressIndex = renderer.GetPropertyIndex( "uProgress" );
+  DALI_TEST_CHECK( progressIndex != Property::INVALID_INDEX );
+  DALI_TEST_EQUALS( renderer.GetCurrentProperty< float >( progressIndex ), progress, epsilon, location );
+}
+
+/**
+ * Check that a stopped effect draws the current texture with a single quad, and that its cubes are back to their initial state
+ * @param[in] effect The effect
+ * @param[in] tileRenderer The renderer of the cubes while the effect was transitioning, if any
+ * @param[in] texture The expected current texture
+ * @param[in] location The location of the test
+ */
+void CheckTransitionStopped( CubeTransitionEffect& effect, Renderer tileRenderer, Texture texture, const char* location )
+{
+  DALI_TEST_CHECK( !effect.IsTransitioning() );
+  DALI_TEST_EQUALS( effect.GetChildCount(), 0u, location );
+  DALI_TEST_EQUALS( effect.GetRendererCount(), 1u, location );
+
+  Renderer renderer = effect.GetRendererAt( 0u );
+  DALI_TEST_CHECK( renderer.GetPropertyIndex( "uProgress" ) == Property::INVALID_INDEX );
+  DALI_TEST_CHECK( renderer.GetTextures().GetTexture( 0u ) == texture );
+
+  if( tileRenderer )
+  {
+    // the rotation and the brightness of the cubes are computed from the progress, so they are reset with it
+    DALI_TEST_CHECK( renderer != tileRenderer );
+    DALI_TEST_EQUALS( tileRenderer.GetCurrentProperty< float >( tileRenderer.GetPropertyIndex( "uProgress" ) ), 0.f, FLT_EPISILON, location );
+  }
+}
+
+/**
+ * Advance the transition by the given time and render it
+ * @param[in] application Test application instance
+ * @param[in] interval The time to pass in milliseconds
+ */
+void RenderTransition( ToolkitTestApplication& application, unsigned int interval )
+{
+  application.SendNotification();
+  application.Render( interval );
+}
+
+const float* GetTileVertex( TestGlAbstraction& gl, unsigned int tile, unsigned int vertex )
+{
+  return reinterpret_cast< const float* >( &gl.GetLastArrayBufferData()[0] ) + ( tile * VERTICES_PER_TILE + vertex ) * TILE_VERTEX_FLOATS;
+}
+
+/**
+ * Check the rotation and the target face baked into the vertices of a cube
+ * @param[in] gl The gl abstraction holding the last uploaded vertices
+ * @param[in] tile The index of the cube
+ * @param[in] axis The expected rotation axis
+ * @param[in] angle The expected final angle of the rotation
+ * @param[in] targetFace The expected centre of the target face, relative to the centre of the cube
+ * @param[in] location The location of the test
+ */
+void CheckTileRotation( TestGlAbstraction& gl, unsigned int tile, const Vector3& axis, float angle, const Vector3& targetFace, const char* location )
+{
+  DALI_TEST_EQUALS( gl.GetLastArrayBufferData().size(), NUM_ROWS * NUM_COLUMNS * VERTICES_PER_TILE * TILE_VERTEX_FLOATS * sizeof( float ), location );
+
+  Vector3 targetFaceCentre;
+  for( unsigned int i = 0u; i < VERTICES_PER_TILE; ++i )
+  {
+    const float* vertex = GetTileVertex( gl, tile, i );
+    DALI_TEST_EQUALS( Vector4( vertex[TILE_ROTATION], vertex[TILE_ROTATION + 1], vertex[TILE_ROTATION + 2], vertex[TILE_ROTATION + 3] ), Vector4( axis.x, axis.y, axis.z, angle ), FLT_EPISILON, location );
+
+    // the first face of a cube shows the current texture, the second one the target texture
+    const bool isTarget = i >= VERTICES_PER_FACE;
+    DALI_TEST_EQUALS( vertex[TILE_TARGET], isTarget ? 1.f : 0.f, FLT_EPISILON, location );
+    if( isTarget )
+    {
+      targetFaceCentre += Vector3( vertex[0], vertex[1], vertex[2] ) / static_cast< float >( VERTICES_PER_FACE );
+    }
+  }
+  DALI_TEST_EQUALS( targetFaceCentre, targetFace, EPISILON, location );
+}
+
+/**
+ * Check the delay and the duration of the rotation of a cube, as fractions of the transition
+ * @param[in] gl The gl abstraction holding the last uploaded vertices
+ * @param[in] tile The index of the cube
+ * @param[in] delay The expected delay
+ * @param[in] duration The expected duration
+ * @param[in] location The location of the test
+ */
+void CheckTileTiming( TestGlAbstraction& gl, unsigned int tile, float delay, float duration, const char* location )
+{
+  const float* vertex = GetTileVertex( gl, tile, 0u );
+  DALI_TEST_EQUALS( vertex[TILE_TIMING], delay, FLT_EPISILON, location );
+  DALI_TEST_EQUALS( vertex[TILE_TIMING + 1], duration, FLT_EPISILON, location );
+}
+
+/**
+ * Check the brightness of the faces of a cube, computed like the shader of the effect does
+ * from the progress of the transition and the timing of the cube
+ * @param[in] effect The effect
+ * @param[in] gl The gl abstraction holding the last uploaded vertices
+ * @param[in] tile The index of the cube
+ * @param[in] progress The expected progress of the transition
+ * @param[in] currentBrightness The expected brightness of the current face
+ * @param[in] targetBrightness The expected brightness of the target face
+ * @param[in] location The location of the test
+ */
+void CheckTileBrightness( CubeTransitionEffect& effect, TestGlAbstraction& gl, unsigned int tile, float progress, float currentBrightness, float targetBrightness, const char* location )
+{
+  CheckTransitionProgress( effect, progress, FLT_EPISILON, location );
+
+  const float* vertex = GetTileVertex( gl, tile, 0u );
+  const float tileProgress = Clamp( ( progress - vertex[TILE_TIMING] ) / vertex[TILE_TIMING + 1], 0.f, 1.f );
+  float easeOut = tileProgress - 1.f;
+  easeOut = easeOut * easeOut * easeOut + 1.f;
+
+  DALI_TEST_EQUALS( 1.f - 0.5f * easeOut, currentBrightness, FLT_EPISILON, location );
+  DALI_TEST_EQUALS( 0.5f + 0.5f * tileProgress * tileProgress * tileProgress, targetBrightness, FLT_EPISILON, location );
+}
+
 } // namespace
 
 
@@ -250,12 +397,10 @@ int UtcDaliCubeTransitionEffectSetGetCubeDisplacement(void)
 }
 
 //Test common codes in base class
-int UtcDaliCubeTransitionEffectGetRoot(void)
+int UtcDaliCubeTransitionEffectSingleRenderer(void)
 {
   ToolkitTestApplication application;
-  tet_infoline(" UtcDaliCubeTransitionEffectGetRoot ");
-
-  unsigned int totalNum = NUM_ROWS*NUM_COLUMNS;
+  tet_infoline(" UtcDaliCubeTransitionEffectSingleRenderer ");
 
   Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 40, 40 );
 
@@ -272,14 +417,20 @@ int UtcDaliCubeTransitionEffectGetRoot(void)
 
   Wait( application, TRANSITION_DURATION * 0.5f );
 
-  // check that we have a total of NUM_ROWS*NUM_COLUMNS cubes;
-  Actor boxesRoot = waveEffect.GetChildAt(0);
-  DALI_TEST_CHECK( totalNum == boxesRoot.GetChildCount() );
+  // check that the NUM_ROWS*NUM_COLUMNS cubes are drawn by the effect itself, without any child actor
+  CheckTransitionProgress( waveEffect, 0.5f, 0.5f, TEST_LOCATION );
+
+  // check that all the cubes are drawn with a single draw call
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  gl.EnableDrawCallTrace( true );
+  drawTrace.Reset();
 
-  // check that every cube has two children
-  DALI_TEST_CHECK( 2 == boxesRoot.GetChildAt(0).GetChildCount() );
-  DALI_TEST_CHECK( 2 == boxesRoot.GetChildAt(totalNum/2).GetChildCount() );
-  DALI_TEST_CHECK( 2 == boxesRoot.GetChildAt(totalNum-1).GetChildCount() );
+  application.SendNotification();
+  application.Render( RENDER_FRAME_INTERVAL );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 0, TEST_LOCATION );
   END_TEST;
 }
 
@@ -362,23 +513,15 @@ int UtcDaliCubeTransitionEffectSetCurrentTexture(void)
   application.SendNotification();
   application.Render();
 
+  // the current image is drawn by the effect before the transition
+  CheckTransitionStopped( waveEffect, Renderer(), texture, TEST_LOCATION );
+
   waveEffect.StartTransition();
 
   // the current image content is set to the tiles facing the camera
-  Actor currentTile = waveEffect.GetChildAt(0).GetChildAt(0).GetChildAt(0);
-  Actor targetTile = waveEffect.GetChildAt(0).GetChildAt(0).GetChildAt(1);
-
-  //check the pixel area set to the cube
-  Vector4 pixelAreaDef( 0.f, 0.f, 1.f / NUM_COLUMNS, 1.f / NUM_ROWS);
-
-  Property::Index textureRectIndex = currentTile.GetPropertyIndex( "uTextureRect" );
-  DALI_TEST_CHECK( textureRectIndex != Property::INVALID_INDEX );
-  Property::Value textureRectValue = currentTile.GetProperty( textureRectIndex );
-  DALI_TEST_CHECK( textureRectValue.GetType() == Property::VECTOR4 );
-  Vector4 pixelArea;
-  DALI_TEST_CHECK( textureRectValue.Get( pixelArea ) );
-
-  DALI_TEST_EQUALS( pixelAreaDef, pixelArea, FLT_EPISILON, TEST_LOCATION );
+  Renderer renderer = waveEffect.GetRendererAt( 0u );
+  DALI_TEST_CHECK( renderer.GetPropertyIndex( "uProgress" ) != Property::INVALID_INDEX );
+  DALI_TEST_CHECK( renderer.GetTextures().GetTexture( 0u ) == texture );
 
   END_TEST;
 }
@@ -390,15 +533,15 @@ int UtcDaliCubeTransitionEffectSetTargetTexture(void)
   tet_infoline(" UtcDaliCubeTransitionEffectSetTargetTexture ");
 
   application.GetGlAbstraction().SetCheckFramebufferStatusResult(GL_FRAMEBUFFER_COMPLETE );
-  Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 40, 40 );
+  Texture firstTexture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 40, 40 );
+  Texture secondTexture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 20, 20 );
   CubeTransitionEffect waveEffect = CubeTransitionWaveEffect::New( NUM_ROWS, NUM_COLUMNS );
   waveEffect.SetProperty( Actor::Property::SIZE, Vector2( VIEW_AREA_SIZE ) );
+  waveEffect.SetTransitionDuration( TRANSITION_DURATION );
   application.GetScene().Add( waveEffect );
 
-  waveEffect.SetCurrentTexture( texture );
-  waveEffect.SetTargetTexture( texture );
-
-  application.GetScene().Add( waveEffect );
+  waveEffect.SetCurrentTexture( firstTexture );
+  waveEffect.SetTargetTexture( secondTexture );
 
   application.SendNotification();
   application.Render();
@@ -406,19 +549,13 @@ int UtcDaliCubeTransitionEffectSetTargetTexture(void)
   waveEffect.StartTransition();
 
   // the target image content is set to the tiles currently invisible to the camera
-  Actor tile = waveEffect.GetChildAt(0).GetChildAt(0).GetChildAt(1);
-
-  //check the pixel area set to the cube
-  Vector4 pixelAreaDef( 0.f, 0.f, 1.f / NUM_COLUMNS, 1.f / NUM_ROWS);
-
-  Property::Index textureRectIndex = tile.GetPropertyIndex( "uTextureRect" );
-  DALI_TEST_CHECK( textureRectIndex != -1 );
-  Property::Value textureRectValue = tile.GetProperty( textureRectIndex );
-  DALI_TEST_CHECK( textureRectValue.GetType() == Property::VECTOR4 );
-  Vector4 pixelArea;
-  DALI_TEST_CHECK( textureRectValue.Get( pixelArea ) );
+  Renderer renderer = waveEffect.GetRendererAt( 0u );
+  DALI_TEST_CHECK( renderer.GetTextures().GetTexture( 0u ) == firstTexture );
+  DALI_TEST_CHECK( renderer.GetTextures().GetTexture( 1u ) == secondTexture );
 
-  DALI_TEST_EQUALS( pixelAreaDef, pixelArea, FLT_EPISILON, TEST_LOCATION );
+  // the target image becomes the current image at the end of the transition
+  Wait( application, TRANSITION_DURATION );
+  CheckTransitionStopped( waveEffect, renderer, secondTexture, TEST_LOCATION );
 
   END_TEST;
 }
@@ -446,37 +583,57 @@ int UtcDaliCubeTransitionWaveEffectStartTransition(void)
   application.SendNotification();
   application.Render();
 
-  waveEffect.StartTransition( true );
-
-  Actor cube = waveEffect.GetChildAt(0).GetChildAt(0);
+  TestGlAbstraction& gl = application.GetGlAbstraction();
 
-  //check the cube rotation value and color values just before the end of different transitions
+  //check the rotation, the target face and the brightness of the cubes at the start, in the middle and at the end of different transitions
   waveEffect.SetTargetTexture( texture );
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  waveEffect.StartTransition( true );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileTiming( gl, 0u, 2.f * THIRD, THIRD, TEST_LOCATION );
+  CheckTileBrightness( waveEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  // the wave reaches the first cube last when transitioning to the next image
+  CheckTileBrightness( waveEffect, gl, 0u, 0.5f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( waveEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !waveEffect.IsTransitioning() );
 
   waveEffect.SetTargetTexture( texture );
-  waveEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  waveEffect.StartTransition( PAN_POSITION1, PAN_DISPLACEMENT1 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileBrightness( waveEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTransitionProgress( waveEffect, 0.5f, FLT_EPISILON, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( waveEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !waveEffect.IsTransitioning() );
 
   waveEffect.SetTargetTexture( texture );
-  waveEffect.StartTransition(false);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  waveEffect.StartTransition( false );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileTiming( gl, 0u, THIRD, THIRD, TEST_LOCATION );
+  CheckTileBrightness( waveEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( waveEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( waveEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !waveEffect.IsTransitioning() );
 
   waveEffect.SetTargetTexture( texture );
-  waveEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  waveEffect.StartTransition( PAN_POSITION2, PAN_DISPLACEMENT2 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileBrightness( waveEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTransitionProgress( waveEffect, 0.5f, FLT_EPISILON, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( waveEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
   END_TEST;
 }
 
@@ -504,43 +661,60 @@ int UtcDaliCubeTransitionCrossEffectStartTransition(void)
   application.SendNotification();
   application.Render();
 
-  crossEffect.StartTransition(true);
-
-  Actor cube0 = crossEffect.GetChildAt(0).GetChildAt(0);
-  Actor cube1 = crossEffect.GetChildAt(0).GetChildAt(1);
-
-  //check the cube rotation value and color values just before the end of different transitions
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::XAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
-
+  TestGlAbstraction& gl = application.GetGlAbstraction();
 
+  //check the rotation, the target face and the brightness of the cubes at the start, in the middle and at the end of different transitions
   crossEffect.SetTargetTexture( texture );
-  crossEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::XAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  crossEffect.StartTransition( true );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::XAXIS, Math::PI_2, TOP_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileTiming( gl, 0u, 0.f, 1.f, TEST_LOCATION );
+  CheckTileTiming( gl, 1u, 0.f, 1.f, TEST_LOCATION );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !crossEffect.IsTransitioning() );
 
+  crossEffect.SetTargetTexture( texture );
+  crossEffect.StartTransition( PAN_POSITION1, PAN_DISPLACEMENT1 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::XAXIS, Math::PI_2, TOP_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !crossEffect.IsTransitioning() );
 
   crossEffect.SetTargetTexture( texture );
-  crossEffect.StartTransition(false);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::XAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  crossEffect.StartTransition( false );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::XAXIS, -Math::PI_2, BOTTOM_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !crossEffect.IsTransitioning() );
 
   crossEffect.SetTargetTexture( texture );
-  crossEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::XAXIS), EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  crossEffect.StartTransition( PAN_POSITION2, PAN_DISPLACEMENT2 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::XAXIS, -Math::PI_2, BOTTOM_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( crossEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
   END_TEST;
 }
 
@@ -562,42 +736,60 @@ int UtcDaliCubeTransitionFoldEffectStartTransition(void)
   application.SendNotification();
   application.Render();
 
-  foldEffect.StartTransition(true);
-
-  Actor cube0 = foldEffect.GetChildAt(0).GetChildAt(0);
-  Actor cube1 = foldEffect.GetChildAt(0).GetChildAt(1);
-
-  //check the cube rotation value and color values just before the end of different transitions
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
 
+  //check the rotation, the target face and the brightness of the cubes at the start, in the middle and at the end of different transitions
   foldEffect.SetTargetTexture( texture );
-  foldEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  foldEffect.StartTransition( true );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileTiming( gl, 0u, 0.f, 1.f, TEST_LOCATION );
+  CheckTileTiming( gl, 1u, 0.f, 1.f, TEST_LOCATION );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !foldEffect.IsTransitioning() );
 
+  foldEffect.SetTargetTexture( texture );
+  foldEffect.StartTransition( PAN_POSITION1, PAN_DISPLACEMENT1 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !foldEffect.IsTransitioning() );
 
   foldEffect.SetTargetTexture( texture );
-  foldEffect.StartTransition(false);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ),FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  foldEffect.StartTransition( false );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, RENDER_FRAME_INTERVAL );
+  DALI_TEST_CHECK( !foldEffect.IsTransitioning() );
 
   foldEffect.SetTargetTexture( texture );
-  foldEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
-  Wait( application, TRANSITION_BEFORE_END_DURATION );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( -Dali::ANGLE_90,  Vector3::YAXIS), EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, EPISILON, TEST_LOCATION );
+  foldEffect.StartTransition( PAN_POSITION2, PAN_DISPLACEMENT2 );
+  RenderTransition( application, 0u );
+  CheckTileRotation( gl, 0u, Vector3::YAXIS, -Math::PI_2, RIGHT_FACE, TEST_LOCATION );
+  CheckTileRotation( gl, 1u, Vector3::YAXIS, Math::PI_2, LEFT_FACE, TEST_LOCATION );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.f, FULL_BRIGHTNESS, HALF_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 0.5f, MIDDLE_BRIGHTNESS, MIDDLE_BRIGHTNESS, TEST_LOCATION );
+  RenderTransition( application, HALF_TRANSITION_INTERVAL );
+  CheckTileBrightness( foldEffect, gl, 0u, 1.f, HALF_BRIGHTNESS, FULL_BRIGHTNESS, TEST_LOCATION );
   END_TEST;
 }
 
@@ -821,46 +1013,41 @@ int UtcDaliCubeTransitionWaveEffectStopTransition(void)
 
   waveEffect.StartTransition(true);
 
-  Actor cube = waveEffect.GetChildAt(0).GetChildAt(0);
-
-  //check the cube rotation value and color values reset after stopping different transitions in the middle
+  //check the effect draws the current image again and resets the cubes after stopping different transitions in the middle
+  Renderer tileRenderer;
   Wait( application, TRANSITION_DURATION*0.2f );
+  tileRenderer = waveEffect.GetRendererAt( 0u );
   waveEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( waveEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   waveEffect.SetTargetTexture( firstTexture );
   waveEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
   Wait( application, TRANSITION_DURATION*0.4f );
+  tileRenderer = waveEffect.GetRendererAt( 0u );
   waveEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( waveEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   waveEffect.SetTargetTexture( secondTexture );
   waveEffect.StartTransition(false);
   Wait( application, TRANSITION_DURATION*0.6f );
+  tileRenderer = waveEffect.GetRendererAt( 0u );
   waveEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( waveEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   waveEffect.SetTargetTexture( firstTexture );
   waveEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
   Wait( application, TRANSITION_DURATION*0.8f );
+  tileRenderer = waveEffect.GetRendererAt( 0u );
   waveEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( waveEffect, tileRenderer, firstTexture, TEST_LOCATION );
   END_TEST;
 }
 
@@ -887,51 +1074,41 @@ int UtcDaliCubeTransitionCrossEffectStopTransition(void)
 
   crossEffect.StartTransition(true);
 
-  Actor cube0 = crossEffect.GetChildAt(0).GetChildAt(0);
-  Actor cube1 = crossEffect.GetChildAt(0).GetChildAt(1);
-
-  //check the cube rotation values and color values reset after stop the different transitions in the middle
+  //check the effect draws the current image again and resets the cubes after stopping different transitions in the middle
+  Renderer tileRenderer;
   Wait( application, TRANSITION_DURATION*0.2f );
+  tileRenderer = crossEffect.GetRendererAt( 0u );
   crossEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( crossEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   crossEffect.SetTargetTexture( firstTexture );
   crossEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
   Wait( application, TRANSITION_DURATION*0.4f );
+  tileRenderer = crossEffect.GetRendererAt( 0u );
   crossEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( crossEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   crossEffect.SetTargetTexture( secondTexture );
   crossEffect.StartTransition(false);
   Wait( application, TRANSITION_DURATION*0.6f );
+  tileRenderer = crossEffect.GetRendererAt( 0u );
   crossEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::ZERO), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( crossEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   crossEffect.SetTargetTexture( firstTexture );
   crossEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
   Wait( application, TRANSITION_DURATION*0.8f );
+  tileRenderer = crossEffect.GetRendererAt( 0u );
   crossEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::XAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( crossEffect, tileRenderer, firstTexture, TEST_LOCATION );
   END_TEST;
 }
 
@@ -957,51 +1134,41 @@ int UtcDaliCubeTransitionFoldEffectStopTransition(void)
 
   foldEffect.StartTransition(true);
 
-  Actor cube0 = foldEffect.GetChildAt(0).GetChildAt(0);
-  Actor cube1 = foldEffect.GetChildAt(0).GetChildAt(1);
-
-  //check the cube rotation values and color values after stop the different transitions in the middle
+  //check the effect draws the current image again and resets the cubes after stopping different transitions in the middle
+  Renderer tileRenderer;
   Wait( application, TRANSITION_DURATION*0.2f );
+  tileRenderer = foldEffect.GetRendererAt( 0u );
   foldEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
 
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::XAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( foldEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   foldEffect.SetTargetTexture( firstTexture );
   foldEffect.StartTransition(PAN_POSITION1, PAN_DISPLACEMENT1);
   Wait( application, TRANSITION_DURATION*0.4f );
+  tileRenderer = foldEffect.GetRendererAt( 0u );
   foldEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::XAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( foldEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   foldEffect.SetTargetTexture( secondTexture );
   foldEffect.StartTransition(false);
   Wait( application, TRANSITION_DURATION*0.6f );
+  tileRenderer = foldEffect.GetRendererAt( 0u );
   foldEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::XAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( foldEffect, tileRenderer, firstTexture, TEST_LOCATION );
 
   foldEffect.SetTargetTexture( firstTexture );
   foldEffect.StartTransition(PAN_POSITION2, PAN_DISPLACEMENT2);
   Wait( application, TRANSITION_DURATION*0.8f );
+  tileRenderer = foldEffect.GetRendererAt( 0u );
   foldEffect.StopTransition();
   application.SendNotification();
   application.Render(RENDER_FRAME_INTERVAL);
-  DALI_TEST_EQUALS( cube1.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ), Quaternion( Dali::ANGLE_0,  Vector3::YAXIS), FLT_EPISILON, TEST_LOCATION  );
-  DALI_TEST_EQUALS( cube0.GetChildAt(0).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), FULL_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
-  DALI_TEST_EQUALS( cube0.GetChildAt(1).GetCurrentProperty< Vector4 >( Actor::Property::COLOR ), HALF_BRIGHTNESS, FLT_EPISILON, TEST_LOCATION );
+  CheckTransitionStopped( foldEffect, tileRenderer, firstTexture, TEST_LOCATION );
   END_TEST;
 }
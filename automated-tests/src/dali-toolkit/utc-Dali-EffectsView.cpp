@@ -476,6 +476,44 @@ int UtcDaliEffectsViewSetRefreshOnDemandP(void)
   END_TEST;
 }
 
+int UtcDaliEffectsViewSetRefreshOnDemandFilters(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliEffectsViewSetRefreshOnDemandFilters: The render tasks of the filters refresh on demand too" );
+
+  EffectsView view = EffectsView::New(EffectsView::DROP_SHADOW);
+  view.SetRefreshOnDemand( true );
+  view.SetProperty( Actor::Property::SIZE, Vector2(100.f, 100.f) );
+
+  Integration::Scene stage = application.GetScene();
+  stage.Add( view );
+  application.SendNotification();
+  application.Render();
+
+  // The children task and the tasks of the spread and blur filters
+  RenderTaskList renderTaskList = stage.GetRenderTaskList();
+  const unsigned int taskCount = renderTaskList.GetTaskCount();
+  DALI_TEST_CHECK( taskCount > 2u );
+  for( unsigned int i = 1u; i < taskCount; ++i )
+  {
+    DALI_TEST_EQUALS( renderTaskList.GetTask( i ).GetRefreshRate(), static_cast<unsigned int>( RenderTask::REFRESH_ONCE ), TEST_LOCATION );
+  }
+
+  // Setting the same size keeps the render tasks
+  RenderTask lastTask = renderTaskList.GetTask( taskCount - 1u );
+  view.SetProperty( Actor::Property::SIZE, Vector2(100.f, 100.f) );
+  DALI_TEST_EQUALS( renderTaskList.GetTaskCount(), taskCount, TEST_LOCATION );
+  DALI_TEST_CHECK( renderTaskList.GetTask( taskCount - 1u ) == lastTask );
+
+  view.SetRefreshOnDemand( false );
+  for( unsigned int i = 1u; i < taskCount; ++i )
+  {
+    DALI_TEST_EQUALS( renderTaskList.GetTask( i ).GetRefreshRate(), static_cast<unsigned int>( RenderTask::REFRESH_ALWAYS ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
 int UtcDaliEffectsViewSetRefreshOnDemandN(void)
 {
   ToolkitTestApplication application;
@@ -595,3 +595,44 @@ int UtcDaliToolkitFlexContainerRTLSupportP(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexContainerChildPropertyChangeRelayoutP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitFlexContainerChildPropertyChangeRelayoutP");
+  FlexContainer flexContainer = FlexContainer::New();
+  DALI_TEST_CHECK( flexContainer );
+
+  flexContainer.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add( flexContainer );
+
+  // Add a large number of children to the container
+  const unsigned int CHILD_COUNT = 1000u;
+  const float CHILD_SIZE = 20.0f;
+  std::vector< Actor > children;
+  for( unsigned int i = 0; i < CHILD_COUNT; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty( Actor::Property::SIZE, Vector2( CHILD_SIZE, CHILD_SIZE ) );
+    flexContainer.Add( actor );
+    children.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( children[0].GetProperty< Vector3 >( Actor::Property::POSITION ).y, 0.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( children[CHILD_COUNT - 1].GetProperty< Vector3 >( Actor::Property::POSITION ).y, CHILD_SIZE * ( CHILD_COUNT - 1 ), TEST_LOCATION );
+
+  // Changing a child property after the layout should move the following children
+  children[0].SetProperty( FlexContainer::ChildProperty::FLEX_MARGIN, Vector4( 0.0f, 10.0f, 0.0f, 0.0f ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( children[0].GetProperty< Vector3 >( Actor::Property::POSITION ).y, 10.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( children[1].GetProperty< Vector3 >( Actor::Property::POSITION ).y, CHILD_SIZE + 10.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( children[CHILD_COUNT - 1].GetProperty< Vector3 >( Actor::Property::POSITION ).y, CHILD_SIZE * ( CHILD_COUNT - 1 ) + 10.0f, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -229,6 +229,99 @@ int UtcDaliGaussianBlurActivateDeactivateRepeat(void)
   END_TEST;
 }
 
+int UtcDaliGaussianBlurViewSizeSetKeepsRenderTargets(void)
+{
+  ToolkitTestApplication application;
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  tet_infoline("UtcDaliGaussianBlurViewSizeSetKeepsRenderTargets");
+
+  Toolkit::GaussianBlurView view = Toolkit::GaussianBlurView::New();
+  view.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+  view.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize());
+  view.Add(Actor::New());
+  application.GetScene().Add(view);
+  view.Activate();
+
+  application.SendNotification();
+  application.Render(20);
+
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 3 );
+  FrameBuffer renderTarget = view.GetBlurredRenderTarget();
+
+  // The same size does not reallocate the render targets
+  view.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize());
+
+  application.SendNotification();
+  application.Render(20);
+
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 3 );
+  DALI_TEST_CHECK( view.GetBlurredRenderTarget() == renderTarget );
+
+  // A new size does
+  view.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+
+  application.SendNotification();
+  application.Render(20);
+
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 6 );
+  DALI_TEST_CHECK( view.GetBlurredRenderTarget() != renderTarget );
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurViewSetRefreshOnDemand(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliGaussianBlurViewSetRefreshOnDemand");
+
+  Toolkit::GaussianBlurView view = Toolkit::GaussianBlurView::New();
+  view.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+  view.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize());
+  view.Add(Actor::New());
+  application.GetScene().Add(view);
+  view.SetRefreshOnDemand( true );
+  view.Activate();
+
+  TestCallback callback( view );
+  callback.Connect();
+
+  RenderTaskList taskList = application.GetScene().GetRenderTaskList();
+  const unsigned int taskCount = taskList.GetTaskCount();
+  DALI_TEST_EQUALS( taskCount, 5u, TEST_LOCATION );
+  for( unsigned int i = 1u; i < taskCount; ++i )
+  {
+    DALI_TEST_EQUALS( taskList.GetTask( i ).GetRefreshRate(), static_cast<unsigned int>( RenderTask::REFRESH_ONCE ), TEST_LOCATION );
+  }
+
+  application.SendNotification();
+  application.Render(1000);
+  application.SendNotification();
+  application.Render(1000);
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( callback.mFinished, true, TEST_LOCATION );
+
+  // Refresh renders the blur once more
+  callback.mFinished = false;
+  view.Refresh();
+
+  application.SendNotification();
+  application.Render(1000);
+  application.SendNotification();
+  application.Render(1000);
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( callback.mFinished, true, TEST_LOCATION );
+
+  view.SetRefreshOnDemand( false );
+  for( unsigned int i = 1u; i < taskCount; ++i )
+  {
+    DALI_TEST_EQUALS( taskList.GetTask( i ).GetRefreshRate(), static_cast<unsigned int>( RenderTask::REFRESH_ALWAYS ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
 // Positive test case for a method
 int UtcDaliGaussianBlurViewSetGetBackgroundColor(void)
 {
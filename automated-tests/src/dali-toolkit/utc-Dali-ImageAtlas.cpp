@@ -383,6 +383,43 @@ int UtcDaliImageAtlasRemove(void)
   END_TEST;
 }
 
+int UtcDaliImageAtlasSetPackingPolicy(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliImageAtlasSetPackingPolicy - Test the best fit policy packs into the free area left the least" );
+
+  unsigned int size = 100;
+  Rect<int> pixelArea[2];
+  ImageAtlas::PackingPolicy policies[2] = { ImageAtlas::FIRST_FIT, ImageAtlas::BEST_FIT };
+  for( unsigned int i = 0; i < 2; ++i )
+  {
+    ImageAtlas atlas = ImageAtlas::New( size, size );
+    atlas.SetPackingPolicy( policies[i] );
+
+    // Leave a free area of 100x70 at the top and a free area of 50x30 at the bottom right
+    Vector4 textureRect1;
+    atlas.Upload( textureRect1, CreatePixelData( 100, 70 ) );
+    Vector4 textureRect2;
+    atlas.Upload( textureRect2, CreatePixelData( 50, 30 ) );
+    atlas.Remove( textureRect1 );
+
+    Vector4 textureRect3;
+    DALI_TEST_CHECK( atlas.Upload( textureRect3, CreatePixelData( 50, 30 ) ) );
+    pixelArea[i] = TextureCoordinateToPixelArea( textureRect3, size );
+    DALI_TEST_CHECK( !IsOverlap( pixelArea[i], TextureCoordinateToPixelArea( textureRect2, size ) ) );
+  }
+
+  // The first fit takes the first free area found, splitting the top area
+  DALI_TEST_EQUALS( pixelArea[0].x, 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelArea[0].y, 0, TEST_LOCATION );
+
+  // The best fit takes the free area of the same size as the image
+  DALI_TEST_EQUALS( pixelArea[1].x, 50, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelArea[1].y, 70, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliImageAtlasImageView(void)
 {
   ToolkitTestApplication application;
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/utility/profiler.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void dali_profiler_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void dali_profiler_cleanup(void)
+{
+  Profiler::Enable( false );
+  Profiler::SetCapacity( 4096u );
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+void CreateControls( ToolkitTestApplication& application )
+{
+  for( int i = 0; i < 3; ++i )
+  {
+    Control control = Control::New();
+    control.SetProperty( Control::Property::BACKGROUND, Color::RED );
+    control.SetProperty( Actor::Property::SIZE, Vector2( 100.f, 100.f ) );
+    application.GetScene().Add( control );
+  }
+
+  application.SendNotification();
+  application.Render();
+}
+
+uint32_t CountEvents( const std::vector< Profiler::Event >& events, const std::string& name, const std::string& controlType )
+{
+  uint32_t count = 0u;
+  for( auto&& event : events )
+  {
+    if( ( name.empty() || event.name == name ) && event.controlType == controlType )
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+} // unnamed namespace
+
+int UtcDaliProfilerEnable(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the profiler can be enabled only when it is built into the toolkit" );
+
+  DALI_TEST_EQUALS( Profiler::IsEnabled(), false, TEST_LOCATION );
+
+  Profiler::Enable( true );
+  DALI_TEST_EQUALS( Profiler::IsEnabled(), Profiler::IsAvailable(), TEST_LOCATION );
+
+  Profiler::Enable( false );
+  DALI_TEST_EQUALS( Profiler::IsEnabled(), false, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliProfilerGetEvents(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the lifecycle scopes of the controls and visuals are recorded only while the profiler is enabled" );
+
+  if( !Profiler::IsAvailable() )
+  {
+    tet_infoline( "The toolkit is built without the profiler (ENABLE_PROFILING), skipping" );
+    END_TEST;
+  }
+
+  Profiler::Clear();
+  CreateControls( application );
+  DALI_TEST_EQUALS( Profiler::GetEvents().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( Profiler::GetControlTypeCounters().size(), 0u, TEST_LOCATION );
+
+  Profiler::Enable( true );
+  CreateControls( application );
+
+  std::vector< Profiler::Event > events = Profiler::GetEvents();
+  DALI_TEST_EQUALS( CountEvents( events, "Control::Impl::RegisterVisual", "Control" ), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountEvents( events, "Visual::Base::SetOnScene", "Control" ), 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( CountEvents( events, "Control::OnRelayout", "Control" ) >= 3u );
+
+  std::vector< Profiler::ControlTypeCounter > counters = Profiler::GetControlTypeCounters();
+  DALI_TEST_EQUALS( counters.size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( counters[0].controlType, "Control", TEST_LOCATION );
+  DALI_TEST_EQUALS( counters[0].count, CountEvents( events, std::string(), "Control" ), TEST_LOCATION );
+  DALI_TEST_CHECK( counters[0].totalDuration >= counters[0].maxDuration );
+
+  // Nothing more is recorded once the profiler is disabled again
+  Profiler::Enable( false );
+  CreateControls( application );
+  DALI_TEST_EQUALS( Profiler::GetEvents().size(), events.size(), TEST_LOCATION );
+  DALI_TEST_EQUALS( Profiler::GetControlTypeCounters()[0].count, counters[0].count, TEST_LOCATION );
+
+  Profiler::Clear();
+  DALI_TEST_EQUALS( Profiler::GetEvents().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( Profiler::GetControlTypeCounters().size(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliProfilerSetCapacity(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the ring buffer keeps the latest scopes" );
+
+  if( !Profiler::IsAvailable() )
+  {
+    tet_infoline( "The toolkit is built without the profiler (ENABLE_PROFILING), skipping" );
+    END_TEST;
+  }
+
+  Profiler::SetCapacity( 2u );
+  Profiler::Enable( true );
+  CreateControls( application );
+
+  std::vector< Profiler::Event > events = Profiler::GetEvents();
+  DALI_TEST_EQUALS( events.size(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( events[0].start <= events[1].start );
+
+  // The counters are not limited by the capacity
+  DALI_TEST_CHECK( Profiler::GetControlTypeCounters()[0].count > 2u );
+
+  Profiler::SetCapacity( 0u );
+  CreateControls( application );
+  DALI_TEST_EQUALS( Profiler::GetEvents().size(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliProfilerGetChromeTrace(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check the scopes are written in the Chrome trace event format" );
+
+  Profiler::Clear();
+  std::string emptyTrace = Profiler::GetChromeTrace();
+  DALI_TEST_CHECK( emptyTrace.find( "{\"traceEvents\":[" ) == 0u );
+  DALI_TEST_CHECK( emptyTrace.find( "\"ph\":\"X\"" ) == std::string::npos );
+
+  if( !Profiler::IsAvailable() )
+  {
+    tet_infoline( "The toolkit is built without the profiler (ENABLE_PROFILING), skipping" );
+    END_TEST;
+  }
+
+  Profiler::Enable( true );
+  CreateControls( application );
+
+  std::string trace = Profiler::GetChromeTrace();
+  DALI_TEST_CHECK( trace.find( "{\"traceEvents\":[" ) == 0u );
+  DALI_TEST_CHECK( trace.rfind( "]," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"ph\":\"X\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"Visual::Base::SetOnScene\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"control\":\"Control\"" ) != std::string::npos );
+
+  DALI_TEST_EQUALS( Profiler::WriteChromeTrace( "/tmp/dali-toolkit-profiler-trace.json" ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( Profiler::WriteChromeTrace( "/non-existent-directory/trace.json" ), false, TEST_LOCATION );
+
+  END_TEST;
+}
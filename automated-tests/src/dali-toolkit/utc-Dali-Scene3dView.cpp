@@ -18,6 +18,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-event-thread-callback.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/scene3d-view/scene3d-view.h>
 
@@ -71,6 +72,32 @@ const char* TEST_GLTF_FILE_NAME[] = {TEST_RESOURCE_DIR "/AnimatedCube.gltf",
  */
 const char* TEST_DIFFUSE_TEXTURE = TEST_RESOURCE_DIR "/forest_diffuse_cubemap.png";
 const char* TEST_SPECULAR_TEXTURE = TEST_RESOURCE_DIR "/forest_specular_cubemap.png";
+
+Renderer FindRenderer( Actor actor )
+{
+  if( actor.GetRendererCount() > 0u )
+  {
+    return actor.GetRendererAt( 0u );
+  }
+
+  for( unsigned int i = 0u; i < actor.GetChildCount(); ++i )
+  {
+    Renderer renderer = FindRenderer( actor.GetChildAt( i ) );
+    if( renderer )
+    {
+      return renderer;
+    }
+  }
+  return Renderer();
+}
+
+bool gResourceReadySignalFired = false;
+
+void ResourceReadySignal( Control control )
+{
+  gResourceReadySignalFired = true;
+}
+
 }
 
 int UtcDaliScene3dViewConstructorP(void)
@@ -231,3 +258,128 @@ int UtcDaliScene3dViewAnimations2(void)
 
   END_TEST;
 }
+
+int UtcDaliScene3dViewLoadTexturesAndBuffers(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliScene3dViewLoadTexturesAndBuffers - Test the images and the buffer file of the scene are loaded");
+
+  Toolkit::Scene3dView view = Toolkit::Scene3dView::New( TEST_GLTF_FILE_NAME[0] );
+  application.GetScene().Add( view );
+
+  application.SendNotification();
+  application.Render();
+
+  Renderer renderer = FindRenderer( view );
+  DALI_TEST_CHECK( renderer );
+
+  // The base color and metallic roughness images of the material
+  TextureSet textureSet = renderer.GetTextures();
+  DALI_TEST_CHECK( textureSet );
+  DALI_TEST_EQUALS( textureSet.GetTextureCount(), 2, TEST_LOCATION );
+  for( unsigned int i = 0u; i < textureSet.GetTextureCount(); ++i )
+  {
+    Texture texture = textureSet.GetTexture( i );
+    DALI_TEST_CHECK( texture );
+    DALI_TEST_CHECK( texture.GetWidth() > 0u );
+  }
+
+  // The positions, normals, tangents and texture coordinates of the mesh are read from the buffer file
+  Geometry geometry = renderer.GetGeometry();
+  DALI_TEST_CHECK( geometry );
+  DALI_TEST_CHECK( geometry.GetNumberOfVertexBuffers() > 0u );
+
+  END_TEST;
+}
+
+int UtcDaliScene3dViewAsynchronousLoading(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliScene3dViewAsynchronousLoading - Test the scene is read on a worker thread and created on the event thread");
+
+  gResourceReadySignalFired = false;
+
+  Toolkit::Scene3dView view = Toolkit::Scene3dView::New( TEST_GLTF_FILE_NAME[0], false );
+  view.ResourceReadySignal().Connect( &ResourceReadySignal );
+  application.GetScene().Add( view );
+
+  application.SendNotification();
+  application.Render();
+
+  // The scene is created once the worker thread has read the file
+  DALI_TEST_EQUALS( gResourceReadySignalFired, false, TEST_LOCATION );
+  DALI_TEST_CHECK( !FindRenderer( view ) );
+  DALI_TEST_EQUALS( view.GetAnimationCount(), 0u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gResourceReadySignalFired, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( view.GetAnimationCount(), 1u, TEST_LOCATION );
+
+  Renderer renderer = FindRenderer( view );
+  DALI_TEST_CHECK( renderer );
+
+  TextureSet textureSet = renderer.GetTextures();
+  DALI_TEST_CHECK( textureSet );
+  DALI_TEST_EQUALS( textureSet.GetTextureCount(), 2, TEST_LOCATION );
+  for( unsigned int i = 0u; i < textureSet.GetTextureCount(); ++i )
+  {
+    Texture texture = textureSet.GetTexture( i );
+    DALI_TEST_CHECK( texture );
+    DALI_TEST_CHECK( texture.GetWidth() > 0u );
+  }
+
+  Geometry geometry = renderer.GetGeometry();
+  DALI_TEST_CHECK( geometry );
+  DALI_TEST_CHECK( geometry.GetNumberOfVertexBuffers() > 0u );
+
+  END_TEST;
+}
+
+int UtcDaliScene3dViewAsynchronousLoadingFailed(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliScene3dViewAsynchronousLoadingFailed - Test the ResourceReadySignal is emitted when the scene fails to be read");
+
+  gResourceReadySignalFired = false;
+
+  Toolkit::Scene3dView view = Toolkit::Scene3dView::New( TEST_RESOURCE_DIR "/invalid.gltf", false );
+  view.ResourceReadySignal().Connect( &ResourceReadySignal );
+  application.GetScene().Add( view );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gResourceReadySignalFired, true, TEST_LOCATION );
+  DALI_TEST_CHECK( !FindRenderer( view ) );
+
+  END_TEST;
+}
+
+int UtcDaliScene3dViewAsynchronousLoadingNotGltf(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliScene3dViewAsynchronousLoadingNotGltf - Test the ResourceReadySignal is emitted after New() when the file is not a glTF file");
+
+  gResourceReadySignalFired = false;
+
+  Toolkit::Scene3dView view = Toolkit::Scene3dView::New( TEST_RESOURCE_DIR "/not-a-scene.txt", false );
+  view.ResourceReadySignal().Connect( &ResourceReadySignal );
+  application.GetScene().Add( view );
+
+  DALI_TEST_EQUALS( gResourceReadySignalFired, false, TEST_LOCATION );
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gResourceReadySignalFired, true, TEST_LOCATION );
+  DALI_TEST_CHECK( !FindRenderer( view ) );
+
+  END_TEST;
+}
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/scroll-view/scroll-view-devel.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -957,6 +958,202 @@ int UtcDaliToolkitScrollViewScrollToActorP(void)
   END_TEST;
 }
 
+int UtcDaliToolkitScrollViewCullingMarginP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCullingMarginP");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 480.0f, 800.0f ) );
+  application.GetScene().Add( scrollView );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< float >( DevelScrollView::Property::CULLING_MARGIN ), -1.0f, TEST_LOCATION );
+
+  Actor actors[3];
+  const float positions[3] = { 0.0f, 1000.0f, 3000.0f };
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    actors[i] = Actor::New();
+    actors[i].SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    actors[i].SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+    actors[i].SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+    actors[i].SetProperty( Actor::Property::POSITION, Vector2( positions[i], 0.0f ) );
+    scrollView.Add( actors[i] );
+  }
+
+  Wait(application);
+
+  // The children outside the view plus the margin are culled, their visibility is not changed
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 200.0f );
+  DALI_TEST_EQUALS( scrollView.GetProperty< float >( DevelScrollView::Property::CULLING_MARGIN ), 200.0f, TEST_LOCATION );
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  }
+
+  // Scrolling moves the children entering the margin, the culled children stay outside the view
+  scrollView.ScrollTo( Vector2( 900.0f, 0.0f ), 0.0f );
+  Wait(application);
+  Wait(application);
+
+  DALI_TEST_EQUALS( actors[1].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 100.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[2].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 3000.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  // The culled children are still found and scrolled to
+  scrollView.ScrollTo( actors[2], 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( scrollView.GetCurrentScrollPosition(), Vector2( 3000.0f - 240.0f, -400.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[2].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x, 240.0f, TEST_LOCATION );
+
+  // The first child is culled where it left the margin
+  const float culledPosition = actors[0].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x;
+  DALI_TEST_CHECK( culledPosition > -3000.0f + 240.0f );
+
+  // Disabling the culling moves all the children by the scroll position again
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, -1.0f );
+  Wait(application);
+  DALI_TEST_EQUALS( actors[0].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x, -3000.0f + 240.0f, TEST_LOCATION );
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewCullingMarginWrapModeP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCullingMarginWrapModeP");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 480.0f, 800.0f ) );
+  application.GetScene().Add( scrollView );
+
+  Actor actor = Actor::New();
+  actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  actor.SetProperty( Actor::Property::POSITION, Vector2( 2000.0f, 0.0f ) );
+  scrollView.Add( actor );
+
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 100.0f );
+  Wait(application);
+
+  // The culled child is not moved by the scroll position
+  scrollView.ScrollTo( Vector2( 500.0f, 0.0f ), 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x, 2000.0f, TEST_LOCATION );
+
+  // The wrapped children are not culled
+  scrollView.SetWrapMode( true );
+  Wait(application);
+  DALI_TEST_CHECK( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x < 2000.0f );
+
+  scrollView.SetWrapMode( false );
+  scrollView.ScrollTo( Vector2::ZERO, 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_CHECK( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x < 2000.0f );
+
+  // A removed child is not constrained any more
+  scrollView.Remove( actor );
+  Wait(application);
+  DALI_TEST_EQUALS( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).x, 2000.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewCullingMarginVisibilityP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCullingMarginVisibilityP");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 480.0f, 800.0f ) );
+  application.GetScene().Add( scrollView );
+
+  Actor actors[2];
+  const float positions[2] = { 0.0f, 3000.0f };
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    actors[i] = Actor::New();
+    actors[i].SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    actors[i].SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+    actors[i].SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+    actors[i].SetProperty( Actor::Property::POSITION, Vector2( positions[i], 0.0f ) );
+    scrollView.Add( actors[i] );
+  }
+  actors[0].SetProperty( Actor::Property::VISIBLE, false );
+
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 200.0f );
+  Wait(application);
+  DALI_TEST_EQUALS( actors[1].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  // A hidden child is culled when it leaves the margin
+  scrollView.ScrollTo( Vector2( 900.0f, 0.0f ), 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actors[0].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[1].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 3000.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  // The culled children are found at their scrolled position
+  DALI_TEST_CHECK( scrollView.FindClosestActorToPosition( Vector3( 1500.0f, 50.0f, 0.0f ) ) == actors[1] );
+
+  // The visibility set by the application while the children are culled is kept
+  actors[0].SetProperty( Actor::Property::VISIBLE, true );
+  actors[1].SetProperty( Actor::Property::VISIBLE, false );
+
+  scrollView.ScrollTo( Vector2( 2700.0f, 0.0f ), 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actors[1].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[1].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 300.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  scrollView.ScrollTo( Vector2::ZERO, 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actors[0].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[0].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 0.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewCullingMarginMoveChildP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCullingMarginMoveChildP");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 480.0f, 800.0f ) );
+  application.GetScene().Add( scrollView );
+
+  Actor actor = Actor::New();
+  actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  actor.SetProperty( Actor::Property::POSITION, Vector2( 3000.0f, 0.0f ) );
+  scrollView.Add( actor );
+
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 200.0f );
+  scrollView.ScrollTo( Vector2( 300.0f, 0.0f ), 0.0f );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 3000.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  // A culled child moved within the margin by the application is moved by the scroll position without scrolling
+  actor.SetProperty( Actor::Property::POSITION, Vector2( 400.0f, 0.0f ) );
+  Wait(application);
+  Wait(application);
+  DALI_TEST_EQUALS( actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ), Vector3( 100.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliToolkitScrollViewScrollToSnapPointP(void)
 {
   ToolkitTestApplication application;
@@ -465,6 +465,80 @@ int UtcDaliTableViewCells(void)
   END_TEST;
 }
 
+int UtcDaliTableViewCellsWithSpans(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliTableViewCellsWithSpans");
+
+  const unsigned int ROW_COUNT = 100u;
+
+  // Create a 100x10 table-view
+  TableView tableView = TableView::New( ROW_COUNT, 10 );
+  DALI_TEST_CHECK( tableView );
+  application.GetScene().Add( tableView );
+
+  // Add an actor spanning over rows 20-22 and columns 2-3 and an actor to the first cell of every row
+  Actor spanningActor = Actor::New();
+  DALI_TEST_CHECK( tableView.AddChild( spanningActor, TableView::CellPosition( 20, 2, 3, 2 ) ) );
+
+  std::vector<Actor> actors;
+  for( unsigned int row = 0; row < ROW_COUNT; ++row )
+  {
+    Actor actor = Actor::New();
+    DALI_TEST_CHECK( tableView.AddChild( actor, TableView::CellPosition( row, 0 ) ) );
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  TableView::CellPosition cellPosition;
+
+  // Insert a row the spanning actor spans over
+  tableView.InsertRow( 21 );
+  DALI_TEST_CHECK( tableView.FindChildPosition( spanningActor, cellPosition ) );
+  DALI_TEST_EQUALS( cellPosition.rowIndex, 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cellPosition.rowSpan, 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( tableView.GetChildAt( TableView::CellPosition( 21, 3 ) ) == spanningActor );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actors[10], cellPosition ) && cellPosition.rowIndex == 10u );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actors[50], cellPosition ) && cellPosition.rowIndex == 51u );
+
+  // Delete the top row of the spanning actor
+  std::vector<Actor> actorsRemoved;
+  tableView.DeleteRow( 20, actorsRemoved );
+  DALI_TEST_EQUALS( static_cast<int>( actorsRemoved.size() ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( actorsRemoved[0] == actors[20] );
+  DALI_TEST_CHECK( !tableView.FindChildPosition( actors[20], cellPosition ) );
+  DALI_TEST_CHECK( tableView.FindChildPosition( spanningActor, cellPosition ) );
+  DALI_TEST_EQUALS( cellPosition.rowIndex, 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cellPosition.rowSpan, 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actors[50], cellPosition ) && cellPosition.rowIndex == 50u );
+
+  // Insert a column the spanning actor spans over
+  tableView.InsertColumn( 3 );
+  DALI_TEST_CHECK( tableView.FindChildPosition( spanningActor, cellPosition ) );
+  DALI_TEST_EQUALS( cellPosition.columnIndex, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cellPosition.columnSpan, 3u, TEST_LOCATION );
+
+  // Delete the first column, removing all the actors but the spanning one
+  actorsRemoved.clear();
+  tableView.DeleteColumn( 0, actorsRemoved );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( actorsRemoved.size() ), ROW_COUNT - 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( !tableView.FindChildPosition( actors[50], cellPosition ) );
+  DALI_TEST_CHECK( tableView.FindChildPosition( spanningActor, cellPosition ) );
+  DALI_TEST_EQUALS( cellPosition.columnIndex, 1u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  // Removing the spanning actor clears all its cells
+  tableView.Remove( spanningActor );
+  DALI_TEST_CHECK( !tableView.FindChildPosition( spanningActor, cellPosition ) );
+  DALI_TEST_CHECK( !tableView.GetChildAt( TableView::CellPosition( 22, 3 ) ) );
+
+  END_TEST;
+}
+
 int UtcDaliTableViewChildAssert(void)
 {
   ToolkitTestApplication application;
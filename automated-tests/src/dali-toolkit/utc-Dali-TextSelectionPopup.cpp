@@ -30,6 +30,20 @@ namespace
 
 const char* TEST_IMAGE_FILE_NAME = "selection-popup-border.9.png";
 
+// Finds the toolbar holding the given option
+TextSelectionToolbar FindToolbar( Actor option )
+{
+  for( Actor actor = option; actor; actor = actor.GetParent() )
+  {
+    TextSelectionToolbar toolbar = TextSelectionToolbar::DownCast( actor );
+    if( toolbar )
+    {
+      return toolbar;
+    }
+  }
+  return TextSelectionToolbar();
+}
+
 }
 
 void dali_textselectionpopup_startup(void)
@@ -272,3 +286,59 @@ int UtcDaliToolkitTextSelectionPopupSizeProperties(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitTextSelectionPopupReuseOptionsP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextSelectionPopupReuseOptionsP");
+
+  TextSelectionPopup popup = TextSelectionPopup::New( nullptr );
+  application.GetScene().Add( popup );
+
+  popup.EnableButtons( static_cast<TextSelectionPopup::Buttons>( TextSelectionPopup::COPY | TextSelectionPopup::PASTE ) );
+  popup.ShowPopup();
+
+  application.SendNotification();
+  application.Render();
+
+  Actor copyOption = popup.FindChildByName( "optionCopy" );
+  Actor pasteOption = popup.FindChildByName( "optionPaste" );
+  DALI_TEST_CHECK( copyOption );
+  DALI_TEST_CHECK( pasteOption );
+  TextSelectionToolbar toolbar = FindToolbar( copyOption );
+  DALI_TEST_CHECK( toolbar );
+  DALI_TEST_CHECK( !popup.FindChildByName( "optionCut" ) );
+
+  // The toolbar is removed when the popup is hidden.
+  popup.HidePopup();
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !popup.FindChildByName( "optionCopy" ) );
+
+  // The options are not created again when the popup is shown with a different set of buttons.
+  popup.EnableButtons( static_cast<TextSelectionPopup::Buttons>( TextSelectionPopup::CUT | TextSelectionPopup::COPY | TextSelectionPopup::PASTE ) );
+  popup.ShowPopup();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( popup.FindChildByName( "optionCut" ) );
+  DALI_TEST_CHECK( copyOption == popup.FindChildByName( "optionCopy" ) );
+  DALI_TEST_CHECK( pasteOption == popup.FindChildByName( "optionPaste" ) );
+  DALI_TEST_CHECK( toolbar == FindToolbar( popup.FindChildByName( "optionCut" ) ) );
+  DALI_TEST_CHECK( toolbar == FindToolbar( copyOption ) );
+
+  // Changing the pressed color creates the options again.
+  popup.SetProperty( TextSelectionPopup::Property::POPUP_PRESSED_COLOR, Color::RED );
+  popup.ShowPopup();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( popup.FindChildByName( "optionCopy" ) );
+  DALI_TEST_CHECK( copyOption != popup.FindChildByName( "optionCopy" ) );
+
+  END_TEST;
+}
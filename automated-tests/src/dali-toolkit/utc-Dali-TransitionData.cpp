@@ -1161,3 +1161,230 @@ int UtcDaliTransitionDataGetAnimatorP(void)
 
   END_TEST;
 }
+
+int UtcDaliTransitionDataReusedByControlsOfSameType(void)
+{
+  ToolkitTestApplication application;
+
+  tet_printf("Testing a transition created for controls of the same type which register the target visual with different indices\n");
+
+  Property::Map map;
+  map["target"] = "visual1";
+  map["property"] = "mixColor";
+  map["initialValue"] = Color::MAGENTA;
+  map["targetValue"] = Color::RED;
+  map["animator"] = Property::Map()
+    .Add("alphaFunction", "LINEAR")
+    .Add("timePeriod", Property::Map()
+         .Add("delay", 0.0f)
+         .Add("duration", 1.0f));
+
+  Dali::Toolkit::TransitionData transition = TransitionData::New( map );
+
+  Property::Map visualMap;
+  visualMap[Visual::Property::TYPE] = Visual::COLOR;
+  visualMap[ColorVisual::Property::MIX_COLOR] = Color::MAGENTA;
+
+  DummyControl actor1 = DummyControl::New();
+  actor1.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add(actor1);
+
+  DummyControlImpl& dummyImpl1 = static_cast<DummyControlImpl&>(actor1.GetImplementation());
+  Visual::Base visual1 = VisualFactory::Get().CreateVisual( visualMap );
+  visual1.SetName( "visual1" );
+  dummyImpl1.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1, visual1 );
+
+  DummyControl actor2 = DummyControl::New();
+  actor2.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add(actor2);
+
+  DummyControlImpl& dummyImpl2 = static_cast<DummyControlImpl&>(actor2.GetImplementation());
+  Visual::Base otherVisual = VisualFactory::Get().CreateVisual( visualMap );
+  otherVisual.SetName( "otherVisual" );
+  dummyImpl2.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1, otherVisual, false );
+  Visual::Base visual2 = VisualFactory::Get().CreateVisual( visualMap );
+  visual2.SetName( "visual1" );
+  dummyImpl2.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 2, visual2 );
+
+  Animation anim1 = dummyImpl1.CreateTransition( transition );
+  Animation anim2 = dummyImpl2.CreateTransition( transition );
+  DALI_TEST_CHECK( anim1 );
+  DALI_TEST_CHECK( anim2 );
+
+  Renderer renderer1 = actor1.GetRendererAt(0);
+  Renderer renderer2 = actor2.GetRendererAt(0);
+  Property::Index mixColorIndex1 = renderer1.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+  Property::Index mixColorIndex2 = renderer2.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+
+  anim1.Play();
+  anim2.Play();
+
+  application.SendNotification();
+  application.Render(0);
+  application.Render(1000); // End of anim
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( renderer1.GetCurrentProperty< Vector3 >( mixColorIndex1 ), Vector3(Color::RED), TEST_LOCATION );
+  DALI_TEST_EQUALS( renderer2.GetCurrentProperty< Vector3 >( mixColorIndex2 ), Vector3(Color::RED), TEST_LOCATION );
+
+  tet_printf("Testing the transition is created again for the first control\n");
+
+  anim1 = dummyImpl1.CreateTransition( transition );
+  DALI_TEST_CHECK( anim1 );
+
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( renderer1.GetCurrentProperty< Vector3 >( mixColorIndex1 ), Vector3(Color::MAGENTA), TEST_LOCATION );
+
+  anim1.Play();
+  application.SendNotification();
+  application.Render(0);
+  application.Render(1000); // End of anim
+  application.SendNotification();
+  DALI_TEST_EQUALS( renderer1.GetCurrentProperty< Vector3 >( mixColorIndex1 ), Vector3(Color::RED), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTransitionDataResolvedAgainAfterVisualsChange(void)
+{
+  ToolkitTestApplication application;
+
+  tet_printf("Testing a transition is resolved again when the visuals of the control change\n");
+
+  Property::Map map;
+  map["target"] = "visual1";
+  map["property"] = "mixColor";
+  map["initialValue"] = Color::MAGENTA;
+  map["targetValue"] = Color::RED;
+  map["animator"] = Property::Map()
+    .Add("alphaFunction", "LINEAR")
+    .Add("timePeriod", Property::Map()
+         .Add("delay", 0.5f)
+         .Add("duration", 1.0f));
+
+  Dali::Toolkit::TransitionData transition = TransitionData::New( map );
+
+  Property::Map visualMap;
+  visualMap[Visual::Property::TYPE] = Visual::COLOR;
+  visualMap[ColorVisual::Property::MIX_COLOR] = Color::MAGENTA;
+
+  DummyControl actor = DummyControl::New();
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add(actor);
+
+  DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>(actor.GetImplementation());
+  Visual::Base visual1 = VisualFactory::Get().CreateVisual( visualMap );
+  visual1.SetName( "visual1" );
+  dummyImpl.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1, visual1 );
+
+  Animation anim = dummyImpl.CreateTransition( transition );
+  DALI_TEST_CHECK( anim );
+  DALI_TEST_EQUALS( anim.GetDuration(), 1.5f, TEST_LOCATION );
+
+  tet_printf("Testing the target is found after the visual is replaced by another one at another position\n");
+
+  dummyImpl.UnregisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1 );
+  Visual::Base otherVisual = VisualFactory::Get().CreateVisual( visualMap );
+  otherVisual.SetName( "otherVisual" );
+  dummyImpl.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1, otherVisual );
+  Visual::Base visual2 = VisualFactory::Get().CreateVisual( visualMap );
+  visual2.SetName( "visual1" );
+  dummyImpl.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 2, visual2 );
+
+  application.SendNotification();
+  application.Render(0);
+
+  anim = dummyImpl.CreateTransition( transition );
+  DALI_TEST_CHECK( anim );
+  DALI_TEST_EQUALS( anim.GetDuration(), 1.5f, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( actor.GetRendererCount(), 2u, TEST_LOCATION );
+  Renderer otherRenderer = actor.GetRendererAt(0);
+  Renderer renderer2 = actor.GetRendererAt(1);
+  Property::Index otherMixColorIndex = otherRenderer.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+  Property::Index mixColorIndex2 = renderer2.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+
+  anim.Play();
+  application.SendNotification();
+  application.Render(0);
+  application.Render(1000); // Half way through the animation, after the delay
+  application.SendNotification();
+  DALI_TEST_EQUALS( renderer2.GetCurrentProperty< Vector3 >( mixColorIndex2 ), ( Vector3(Color::MAGENTA) + Vector3(Color::RED) ) * 0.5f, TEST_LOCATION );
+
+  application.Render(500); // End of anim
+  application.SendNotification();
+  DALI_TEST_EQUALS( renderer2.GetCurrentProperty< Vector3 >( mixColorIndex2 ), Vector3(Color::RED), TEST_LOCATION );
+  DALI_TEST_EQUALS( otherRenderer.GetCurrentProperty< Vector3 >( otherMixColorIndex ), Vector3(Color::MAGENTA), TEST_LOCATION );
+
+  tet_printf("Testing the transition is unchanged by the unused target\n");
+
+  dummyImpl.UnregisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 2 );
+  anim = dummyImpl.CreateTransition( transition );
+  DALI_TEST_CHECK( !anim );
+
+  END_TEST;
+}
+
+int UtcDaliTransitionDataTargetRenamedVisual(void)
+{
+  ToolkitTestApplication application;
+
+  tet_printf("Testing a transition created again after its target visual was renamed animates the visual with the target name\n");
+
+  Property::Map map;
+  map["target"] = "visual1";
+  map["property"] = "mixColor";
+  map["initialValue"] = Color::MAGENTA;
+  map["targetValue"] = Color::RED;
+  map["animator"] = Property::Map()
+    .Add("alphaFunction", "LINEAR")
+    .Add("timePeriod", Property::Map()
+         .Add("delay", 0.0f)
+         .Add("duration", 1.0f));
+
+  Dali::Toolkit::TransitionData transition = TransitionData::New( map );
+
+  Property::Map visualMap;
+  visualMap[Visual::Property::TYPE] = Visual::COLOR;
+  visualMap[ColorVisual::Property::MIX_COLOR] = Color::MAGENTA;
+
+  DummyControl actor = DummyControl::New();
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add(actor);
+
+  DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>(actor.GetImplementation());
+  Visual::Base visual1 = VisualFactory::Get().CreateVisual( visualMap );
+  visual1.SetName( "visual1" );
+  dummyImpl.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 1, visual1 );
+  Visual::Base visual2 = VisualFactory::Get().CreateVisual( visualMap );
+  visual2.SetName( "visual2" );
+  dummyImpl.RegisterVisual( Control::CONTROL_PROPERTY_END_INDEX + 2, visual2 );
+
+  Animation anim = dummyImpl.CreateTransition( transition );
+  DALI_TEST_CHECK( anim );
+
+  tet_printf("Swap the names of the visuals, which does not register them again\n");
+  visual1.SetName( "visual2" );
+  visual2.SetName( "visual1" );
+
+  anim = dummyImpl.CreateTransition( transition );
+  DALI_TEST_CHECK( anim );
+
+  Renderer renderer1 = actor.GetRendererAt(0);
+  Renderer renderer2 = actor.GetRendererAt(1);
+  Property::Index mixColorIndex1 = renderer1.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+  Property::Index mixColorIndex2 = renderer2.GetPropertyIndex( ColorVisual::Property::MIX_COLOR );
+
+  anim.Play();
+
+  application.SendNotification();
+  application.Render(0);
+  application.Render(1000); // End of anim
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( renderer1.GetCurrentProperty< Vector3 >( mixColorIndex1 ), Vector3(Color::MAGENTA), TEST_LOCATION );
+  DALI_TEST_EQUALS( renderer2.GetCurrentProperty< Vector3 >( mixColorIndex2 ), Vector3(Color::RED), TEST_LOCATION );
+
+  END_TEST;
+}
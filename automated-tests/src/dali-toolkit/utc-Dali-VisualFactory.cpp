@@ -21,6 +21,7 @@
 #include <toolkit-event-thread-callback.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/devel-api/visuals/color-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/npatch-loader.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -238,6 +239,96 @@ int UtcDaliVisualFactoryGetColorVisual2(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryCompileColorVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryCompileColorVisual: Request color visuals with a compiled template" );
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK( factory );
+
+  Vector4 testColor( 1.f, 0.5f, 0.3f, 0.2f );
+  Property::Map propertyMap;
+  propertyMap.Insert( "visualType", "COLOR" );
+  propertyMap.Insert( "mixColor", testColor );
+  propertyMap.Insert( "renderIfTransparent", true );
+  propertyMap.Insert( "unknownProperty", 1 );
+
+  VisualTemplate visualTemplate = factory.Compile( propertyMap );
+  DALI_TEST_CHECK( visualTemplate );
+
+  // The known names are converted to indices
+  const Property::Map& compiledMap = visualTemplate.GetPropertyMap();
+  Property::Value* typeValue = compiledMap.Find( Visual::Property::TYPE );
+  DALI_TEST_CHECK( typeValue );
+  DALI_TEST_EQUALS( typeValue->Get<int>(), static_cast<int>( Visual::COLOR ), TEST_LOCATION );
+  DALI_TEST_CHECK( compiledMap.Find( ColorVisual::Property::MIX_COLOR ) );
+  DALI_TEST_CHECK( compiledMap.Find( DevelColorVisual::Property::RENDER_IF_TRANSPARENT ) );
+  DALI_TEST_CHECK( !compiledMap.Find( "mixColor" ) );
+  DALI_TEST_CHECK( compiledMap.Find( "unknownProperty" ) );
+
+  Visual::Base visual1 = factory.CreateVisual( visualTemplate );
+  Visual::Base visual2 = factory.CreateVisual( visualTemplate );
+  DALI_TEST_CHECK( visual1 );
+  DALI_TEST_CHECK( visual2 );
+  DALI_TEST_CHECK( visual1 != visual2 );
+
+  Property::Map resultMap;
+  visual2.CreatePropertyMap( resultMap );
+  Property::Value* colorValue = resultMap.Find( ColorVisual::Property::MIX_COLOR, Property::VECTOR4 );
+  DALI_TEST_CHECK( colorValue );
+  DALI_TEST_EQUALS( colorValue->Get<Vector4>(), testColor, TEST_LOCATION );
+
+  DummyControl actor = DummyControl::New(true);
+  TestVisualRender( application, actor, visual1 );
+
+  Vector3 actualValue(Vector4::ZERO);
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  DALI_TEST_CHECK( gl.GetUniformValue<Vector3>( "mixColor", actualValue ) );
+  DALI_TEST_EQUALS( actualValue, Vector3(testColor), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCompileImageVisual(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryCompileImageVisual: Request image visuals with a compiled template" );
+
+  VisualFactory factory = VisualFactory::Get();
+
+  Property::Map propertyMap;
+  propertyMap.Insert( "url", TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( "desiredWidth", 20 );
+  propertyMap.Insert( "desiredHeight", 30 );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_HEIGHT, 40 );
+
+  VisualTemplate visualTemplate = factory.Compile( propertyMap );
+  DALI_TEST_CHECK( visualTemplate );
+
+  // The type defaults to IMAGE and the index key overrides the string key of the same property
+  const Property::Map& compiledMap = visualTemplate.GetPropertyMap();
+  DALI_TEST_EQUALS( compiledMap.Find( Visual::Property::TYPE )->Get<int>(), static_cast<int>( Visual::IMAGE ), TEST_LOCATION );
+  DALI_TEST_EQUALS( compiledMap.Find( ImageVisual::Property::URL )->Get<std::string>(), std::string( TEST_IMAGE_FILE_NAME ), TEST_LOCATION );
+  DALI_TEST_EQUALS( compiledMap.Find( ImageVisual::Property::DESIRED_HEIGHT )->Get<int>(), 40, TEST_LOCATION );
+
+  Visual::Base visual = factory.CreateVisual( visualTemplate );
+  DALI_TEST_CHECK( visual );
+
+  Property::Map resultMap;
+  visual.CreatePropertyMap( resultMap );
+  DALI_TEST_EQUALS( resultMap.Find( Visual::Property::TYPE, Property::INTEGER )->Get<int>(), static_cast<int>( Visual::IMAGE ), TEST_LOCATION );
+  DALI_TEST_EQUALS( resultMap.Find( ImageVisual::Property::DESIRED_WIDTH, Property::INTEGER )->Get<int>(), 20, TEST_LOCATION );
+  DALI_TEST_EQUALS( resultMap.Find( ImageVisual::Property::DESIRED_HEIGHT, Property::INTEGER )->Get<int>(), 40, TEST_LOCATION );
+
+  // An empty url does not create a visual
+  Property::Map emptyUrlMap;
+  emptyUrlMap.Insert( ImageVisual::Property::URL, "" );
+  DALI_TEST_CHECK( !factory.CreateVisual( factory.Compile( emptyUrlMap ) ) );
+
+  END_TEST;
+}
+
 int UtcDaliVisualFactoryGetBorderVisual1(void)
 {
   ToolkitTestApplication application;
@@ -465,6 +556,71 @@ int UtcDaliVisualFactoryDefaultOffsetsGradientVisual(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryGradientVisualSharedLookupTexture(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryGradientVisualSharedLookupTexture: Gradient visuals share the lookup texture");
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK( factory );
+
+  Property::Map propertyMap;
+  propertyMap.Insert(Visual::Property::TYPE,  Visual::GRADIENT);
+  propertyMap.Insert(GradientVisual::Property::START_POSITION, Vector2(-1.f, -1.f));
+  propertyMap.Insert(GradientVisual::Property::END_POSITION, Vector2(1.f, 1.f));
+
+  Property::Array stopColors;
+  stopColors.PushBack( Color::RED );
+  stopColors.PushBack( Color::GREEN );
+  propertyMap.Insert(GradientVisual::Property::STOP_COLOR, stopColors);
+
+  Property::Map otherPropertyMap;
+  otherPropertyMap.Insert(Visual::Property::TYPE,  Visual::GRADIENT);
+  otherPropertyMap.Insert(GradientVisual::Property::START_POSITION, Vector2(-1.f, -1.f));
+  otherPropertyMap.Insert(GradientVisual::Property::END_POSITION, Vector2(1.f, 1.f));
+
+  Property::Array otherStopColors;
+  otherStopColors.PushBack( Color::BLUE );
+  otherStopColors.PushBack( Color::YELLOW );
+  otherPropertyMap.Insert(GradientVisual::Property::STOP_COLOR, otherStopColors);
+
+  Visual::Base visual1 = factory.CreateVisual( propertyMap );
+  Visual::Base visual2 = factory.CreateVisual( propertyMap );
+  Visual::Base visual3 = factory.CreateVisual( otherPropertyMap );
+
+  DummyControl actor1 = DummyControl::New(true);
+  TestVisualRender( application, actor1, visual1 );
+  DummyControl actor2 = DummyControl::New(true);
+  TestVisualRender( application, actor2, visual2 );
+  DummyControl actor3 = DummyControl::New(true);
+  TestVisualRender( application, actor3, visual3 );
+
+  Renderer renderer1 = actor1.GetRendererAt( 0u );
+  Renderer renderer2 = actor2.GetRendererAt( 0u );
+  Renderer renderer3 = actor3.GetRendererAt( 0u );
+
+  // All the gradients are in the same lookup texture
+  DALI_TEST_CHECK( renderer1.GetTextures() == renderer2.GetTextures() );
+  DALI_TEST_CHECK( renderer1.GetTextures() == renderer3.GetTextures() );
+
+  // Identical gradients use the same row of the lookup texture
+  float coordinate1 = renderer1.GetProperty< float >( renderer1.GetPropertyIndex( "uLookupCoordinate" ) );
+  float coordinate2 = renderer2.GetProperty< float >( renderer2.GetPropertyIndex( "uLookupCoordinate" ) );
+  float coordinate3 = renderer3.GetProperty< float >( renderer3.GetPropertyIndex( "uLookupCoordinate" ) );
+  DALI_TEST_EQUALS( coordinate1, coordinate2, TEST_LOCATION );
+  DALI_TEST_CHECK( !Equals( coordinate1, coordinate3 ) );
+
+  // The row of the other gradient is reused once it is off scene
+  application.GetScene().Remove( actor3 );
+  DummyControl actor4 = DummyControl::New(true);
+  Visual::Base visual4 = factory.CreateVisual( otherPropertyMap );
+  TestVisualRender( application, actor4, visual4 );
+  Renderer renderer4 = actor4.GetRendererAt( 0u );
+  DALI_TEST_EQUALS( renderer4.GetProperty< float >( renderer4.GetPropertyIndex( "uLookupCoordinate" ) ), coordinate3, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliVisualFactoryGetNPatchVisualSynchronousLoad1(void)
 {
   ToolkitTestApplication application;
@@ -2026,6 +2182,121 @@ int UtcDaliVisualFactoryGetPrimitiveVisualN1(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryPrimitiveAndMeshVisualShareGeometry(void)
+{
+  //Set up test application first, so everything else can be handled.
+  ToolkitTestApplication application;
+
+  tet_infoline( "UtcDaliVisualFactoryPrimitiveAndMeshVisualShareGeometry:  Visuals with the same shape or mesh share the geometry" );
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK( factory );
+
+  Property::Map sphereMap;
+  sphereMap.Insert( Toolkit::Visual::Property::TYPE, Visual::PRIMITIVE );
+  sphereMap.Insert( PrimitiveVisual::Property::SHAPE, PrimitiveVisual::Shape::SPHERE );
+  sphereMap.Insert( PrimitiveVisual::Property::SLICES, 10 );
+
+  Property::Map otherSphereMap;
+  otherSphereMap.Insert( Toolkit::Visual::Property::TYPE, Visual::PRIMITIVE );
+  otherSphereMap.Insert( PrimitiveVisual::Property::SHAPE, PrimitiveVisual::Shape::SPHERE );
+  otherSphereMap.Insert( PrimitiveVisual::Property::SLICES, 20 );
+
+  Property::Map meshMap;
+  meshMap.Insert( Toolkit::Visual::Property::TYPE, Visual::MESH );
+  meshMap.Insert( MeshVisual::Property::OBJECT_URL, TEST_OBJ_FILE_NAME );
+
+  std::vector< Property::Map > maps = { sphereMap, sphereMap, otherSphereMap, meshMap, meshMap };
+  std::vector< DummyControl > actors;
+  for( auto&& map : maps )
+  {
+    Visual::Base visual = factory.CreateVisual( map );
+    DALI_TEST_CHECK( visual );
+
+    DummyControl actor = DummyControl::New( true );
+    DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    actor.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+    application.GetScene().Add( actor );
+    DALI_TEST_EQUALS( actor.GetRendererCount(), 1u, TEST_LOCATION );
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_CHECK( actors[0].GetRendererAt( 0 ).GetGeometry() == actors[1].GetRendererAt( 0 ).GetGeometry() );
+  DALI_TEST_CHECK( actors[0].GetRendererAt( 0 ).GetGeometry() != actors[2].GetRendererAt( 0 ).GetGeometry() );
+  DALI_TEST_CHECK( actors[3].GetRendererAt( 0 ).GetGeometry() == actors[4].GetRendererAt( 0 ).GetGeometry() );
+
+  tet_infoline( "The geometry is dropped from the cache once the last visual using it is destroyed" );
+  Geometry sphereGeometry = actors[0].GetRendererAt( 0 ).GetGeometry();
+  for( auto&& actor : actors )
+  {
+    actor.Unparent();
+    DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+    dummyImpl.UnregisterVisual( DummyControl::Property::TEST_VISUAL );
+  }
+  actors.clear();
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  Visual::Base visual = factory.CreateVisual( sphereMap );
+  DummyControl actor = DummyControl::New( true );
+  DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( actor );
+  visual.Reset();
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( actor.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( actor.GetRendererAt( 0 ).GetGeometry() != sphereGeometry );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryAtlasPackingPolicyAndOccupancy(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryAtlasPackingPolicyAndOccupancy: The atlases shared by the image visuals report their occupancy" );
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK( factory );
+  DALI_TEST_EQUALS( factory.GetAtlasCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( factory.GetAtlasOccupancyRate(), 0.f, TEST_LOCATION );
+
+  factory.SetAtlasPackingPolicy( ImageAtlas::BEST_FIT );
+
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Visual::IMAGE );
+  propertyMap.Insert( ImageVisual::Property::URL, TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_WIDTH, 32 );
+  propertyMap.Insert( ImageVisual::Property::DESIRED_HEIGHT, 32 );
+  propertyMap.Insert( ImageVisual::Property::ATLASING, true );
+
+  Visual::Base visual = factory.CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  DummyControl actor = DummyControl::New( true );
+  DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  // The image is packed into the first atlas of 1024x1024 pixels
+  DALI_TEST_EQUALS( factory.GetAtlasCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( factory.GetAtlasOccupancyRate(), 32.f * 32.f / ( 1024.f * 1024.f ), Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliVisualFactoryGetAnimatedImageVisual1(void)
 {
   ToolkitTestApplication application;
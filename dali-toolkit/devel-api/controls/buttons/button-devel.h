@@ -47,7 +47,14 @@ enum Type
        * @brief name "visualPadding", type Vector4
        * @details Sets the padding around the foreground visual
        */
-  VISUAL_PADDING
+  VISUAL_PADDING,
+
+  /**
+       * @brief name "prefetchStateVisuals", type BOOLEAN
+       * @details Whether the visuals of the states not shown yet are created when the event thread is idle,
+       *          instead of when their state is entered. Default is false.
+       */
+  PREFETCH_STATE_VISUALS
 };
 } // namespace Property
 
@@ -115,7 +115,19 @@ enum
    * @brief The shadow of the control.
    * @details Name "shadow", type Property::MAP.
    */
-  SHADOW = PADDING + 8
+  SHADOW = PADDING + 8,
+
+  /**
+   * @brief Whether the control draws the color and border visuals of itself and its descendants.
+   * @details Name "batchParent", type Property::BOOLEAN.
+   * @note The visuals are drawn with a few renderers of the batch parent, before its descendants, instead of one renderer each.
+   * @note The visuals put on the scene before the control becomes a batch parent keep their own renderers.
+   * @note A visual is only batched while this does not change what is drawn: no other renderer is drawn between the batch parent and
+   * the visual, and the actors between them are not scaled, rotated or clipping. Otherwise it draws itself until it is put on the scene again.
+   * @note The batched visuals are laid out again, one frame later, when the position, color, scale or visibility of an actor between them and
+   * the batch parent changes, animations included. A visual whose own properties are animated draws itself until it is put on the scene again.
+   */
+  BATCH_PARENT = PADDING + 9
 };
 
 } // namespace Property
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/control-pool.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/singleton-service.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/control-pool/control-pool-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+ControlPool ControlPool::Get()
+{
+  ControlPool pool;
+
+  // Check whether the ControlPool is already created
+  SingletonService singletonService(SingletonService::Get());
+  if(singletonService)
+  {
+    BaseHandle handle = singletonService.GetSingleton(typeid(ControlPool));
+    if(handle)
+    {
+      // If so, downcast the handle of singleton to ControlPool
+      pool = ControlPool(dynamic_cast<Internal::ControlPool*>(handle.GetObjectPtr()));
+    }
+
+    if(!pool) // If not, create the ControlPool and register it as a singleton
+    {
+      pool = ControlPool(new Internal::ControlPool());
+      singletonService.Register(typeid(ControlPool), pool);
+    }
+  }
+
+  return pool;
+}
+
+ControlPool::ControlPool()
+{
+}
+
+ControlPool::~ControlPool()
+{
+}
+
+ControlPool::ControlPool(const ControlPool& handle)
+: BaseHandle(handle)
+{
+}
+
+ControlPool& ControlPool::operator=(const ControlPool& handle)
+{
+  BaseHandle::operator=(handle);
+  return *this;
+}
+
+void ControlPool::Reserve(const std::string& typeName, uint32_t budget)
+{
+  GetImplementation(*this).Reserve(typeName, budget);
+}
+
+Control ControlPool::Acquire(const std::string& typeName)
+{
+  return GetImplementation(*this).Acquire(typeName);
+}
+
+uint32_t ControlPool::GetPooledCount(const std::string& typeName) const
+{
+  return GetImplementation(*this).GetPooledCount(typeName);
+}
+
+ControlPool::ControlPool(Internal::ControlPool* impl)
+: BaseHandle(impl)
+{
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
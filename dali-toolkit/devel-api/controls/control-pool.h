@@ -0,0 +1,127 @@
+#ifndef DALI_TOOLKIT_CONTROL_POOL_H
+#define DALI_TOOLKIT_CONTROL_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class ControlPool;
+}
+
+/**
+ * @brief ControlPool is a singleton which creates controls ahead of time, when the application is idle.
+ *
+ * Creating a control pays for the type registry lookup, the theme style and the creation of its visuals.
+ * The pool moves that cost out of the user interaction: a number of instances of a control type is reserved,
+ * they are created one per idle callback and handed out by Acquire().
+ *
+ * @code
+ * ControlPool::Get().Reserve( "Popup", 2u );
+ * ...
+ * Control popup = ControlPool::Get().Acquire( "Popup" ); // Doesn't create a popup if one is pooled.
+ * @endcode
+ */
+class DALI_TOOLKIT_API ControlPool : public BaseHandle
+{
+public:
+  /**
+   * @brief Create or retrieve the ControlPool singleton.
+   *
+   * @return A handle to the ControlPool.
+   */
+  static ControlPool Get();
+
+  /**
+   * @brief Create a ControlPool handle.
+   *
+   * Calling member functions with an uninitialised handle is not allowed.
+   */
+  ControlPool();
+
+  /**
+   * @brief Destructor
+   *
+   * This is non-virtual since derived Handle types must not contain data or virtual methods.
+   */
+  ~ControlPool();
+
+  /**
+   * @brief This copy constructor is required for (smart) pointer semantics.
+   *
+   * @param[in] handle A reference to the copied handle.
+   */
+  ControlPool(const ControlPool& handle);
+
+  /**
+   * @brief This assignment operator is required for (smart) pointer semantics.
+   *
+   * @param[in] handle A reference to the copied handle.
+   * @return A reference to this.
+   */
+  ControlPool& operator=(const ControlPool& handle);
+
+  /**
+   * @brief Sets the number of instances of a control type to keep ready.
+   *
+   * The missing instances are created in idle callbacks, one per callback.
+   * A budget lower than the number of pooled instances releases the extra ones.
+   *
+   * @param[in] typeName The name of the control type in the type registry, i.e. "Popup".
+   * @param[in] budget The number of instances to keep ready.
+   */
+  void Reserve(const std::string& typeName, uint32_t budget);
+
+  /**
+   * @brief Retrieves an instance of a control type.
+   *
+   * A pooled instance is returned if there is one, otherwise the instance is created now.
+   * The pool is refilled in idle callbacks up to the reserved budget.
+   *
+   * @param[in] typeName The name of the control type in the type registry.
+   * @return The control, or an empty handle if the type is not registered or is not a control.
+   */
+  Control Acquire(const std::string& typeName);
+
+  /**
+   * @brief Retrieves the number of instances of a control type ready to be acquired.
+   *
+   * @param[in] typeName The name of the control type in the type registry.
+   * @return The number of pooled instances.
+   */
+  uint32_t GetPooledCount(const std::string& typeName) const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL ControlPool(Internal::ControlPool* impl);
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_CONTROL_POOL_H
@@ -90,6 +90,16 @@ void GaussianBlurView::Deactivate()
   GetImpl(*this).Deactivate();
 }
 
+void GaussianBlurView::Refresh()
+{
+  GetImpl(*this).Refresh();
+}
+
+void GaussianBlurView::SetRefreshOnDemand(bool onDemand)
+{
+  GetImpl(*this).SetRefreshOnDemand(onDemand);
+}
+
 void GaussianBlurView::SetUserImageAndOutputRenderTarget(Texture inputImage, FrameBuffer outputRenderTarget)
 {
   GetImpl(*this).SetUserImageAndOutputRenderTarget(inputImage, outputRenderTarget);
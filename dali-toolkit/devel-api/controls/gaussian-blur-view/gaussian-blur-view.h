@@ -203,6 +203,23 @@ public:
    */
   void Deactivate();
 
+  /**
+   * @brief Render the GaussianBlurView once more, when it refreshes on demand.
+   *
+   * Call this whenever the children have changed, the blurred result is kept until then.
+   * Listen to the Finished signal to determine when the rendering has completed.
+   */
+  void Refresh();
+
+  /**
+   * @brief Set the refresh mode.
+   *
+   * A static blurred background does not need to be rendered every frame.
+   * @param[in] onDemand Set true to render only after Activate() and each Refresh() call.
+   *                     Set false to render each frame. (GaussianBlurView refresh mode is set to continuous by default).
+   */
+  void SetRefreshOnDemand(bool onDemand);
+
   /**
    * @brief Sets a custom image to be blurred and a render target to receive the blurred result.
    *
@@ -46,12 +46,22 @@ Scene3dView& Scene3dView::operator=(const Scene3dView& handle)
 
 Scene3dView Scene3dView::New(const std::string& filePath)
 {
-  return Internal::Scene3dView::New(filePath);
+  return Internal::Scene3dView::New(filePath, true);
 }
 
 Scene3dView Scene3dView::New(const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor)
 {
-  return Internal::Scene3dView::New(filePath, diffuseTexturePath, specularTexturePath, scaleFactor);
+  return Internal::Scene3dView::New(filePath, diffuseTexturePath, specularTexturePath, scaleFactor, true);
+}
+
+Scene3dView Scene3dView::New(const std::string& filePath, bool synchronousLoading)
+{
+  return Internal::Scene3dView::New(filePath, synchronousLoading);
+}
+
+Scene3dView Scene3dView::New(const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor, bool synchronousLoading)
+{
+  return Internal::Scene3dView::New(filePath, diffuseTexturePath, specularTexturePath, scaleFactor, synchronousLoading);
 }
 
 Scene3dView::Scene3dView(Internal::Scene3dView& implementation)
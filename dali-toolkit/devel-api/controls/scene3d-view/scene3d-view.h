@@ -138,6 +138,26 @@ public:
    */
   static Scene3dView New(const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor);
 
+  /**
+   * @brief Create an initialized Scene3dView, loading the scene on a worker thread if required.
+   * @param[in] filePath File path of scene format file (e.g., glTF).
+   * @param[in] synchronousLoading If false, the file is read on a worker thread and ResourceReadySignal is emitted once the scene is created or fails to be created.
+   * @return A handle to a newly allocated Dali resource
+   */
+  static Scene3dView New(const std::string& filePath, bool synchronousLoading);
+
+  /**
+   * @brief Create an initialized Scene3dView, loading the scene on a worker thread if required.
+   * @param[in] filePath File path of scene format file (e.g., glTF).
+   * @param[in] diffuseTexturePath The texture path of diffuse cube map that used to render with Image Based Lighting.
+   * @param[in] specularTexturePath The texture path of specular cube map that used to render with Image Based Lighting.
+   * @param[in] scaleFactor Scaling factor for the Image Based Lighting.
+   * @param[in] synchronousLoading If false, the file is read on a worker thread and ResourceReadySignal is emitted once the scene is created or fails to be created.
+   * @return A handle to a newly allocated Dali resource
+   * @note The cube maps are loaded synchronously.
+   */
+  static Scene3dView New(const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor, bool synchronousLoading);
+
   /**
    * @brief Get animation count.
    * @return number of animations.
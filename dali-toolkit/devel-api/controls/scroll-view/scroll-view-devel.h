@@ -0,0 +1,64 @@
+#ifndef DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+#define DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelScrollView
+{
+namespace Property
+{
+enum Type
+{
+  WRAP_ENABLED               = Dali::Toolkit::ScrollView::Property::WRAP_ENABLED,
+  PANNING_ENABLED            = Dali::Toolkit::ScrollView::Property::PANNING_ENABLED,
+  AXIS_AUTO_LOCK_ENABLED     = Dali::Toolkit::ScrollView::Property::AXIS_AUTO_LOCK_ENABLED,
+  WHEEL_SCROLL_DISTANCE_STEP = Dali::Toolkit::ScrollView::Property::WHEEL_SCROLL_DISTANCE_STEP,
+  SCROLL_MODE                = Dali::Toolkit::ScrollView::Property::SCROLL_MODE,
+
+  /**
+   * @brief The distance beyond the edges of the scroll view from which the children are culled.
+   * @details Name "cullingMargin", type Property::FLOAT.
+   *
+   * The scroll view constraints are removed from the children which are further than this distance outside of the scroll view,
+   * until they scroll back within the margin. They stay where they were when they left the margin, so they are not drawn.
+   * Their Actor::Property::VISIBLE is not changed.
+   * A negative value disables the culling, which is the default.
+   *
+   * @note The culling is suspended while the wrap mode is enabled or a scroll view effect is applied,
+   * as the children are not moved by the scroll position only.
+   * @note The margin should be larger than the distance scrolled in a frame, otherwise children may appear late.
+   */
+  CULLING_MARGIN,
+};
+
+} // namespace Property
+
+} // namespace DevelScrollView
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
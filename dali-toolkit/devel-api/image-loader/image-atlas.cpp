@@ -75,6 +75,11 @@ void ImageAtlas::SetBrokenImage(const std::string& brokenImageUrl)
   GetImplementation(*this).SetBrokenImage(brokenImageUrl);
 }
 
+void ImageAtlas::SetPackingPolicy(PackingPolicy policy)
+{
+  GetImplementation(*this).SetPackingPolicy(policy);
+}
+
 bool ImageAtlas::Upload(Vector4&           textureRect,
                         const std::string& url,
                         ImageDimensions    size,
@@ -50,6 +50,15 @@ class DALI_TOOLKIT_API ImageAtlas : public BaseHandle
 public:
   typedef uint32_t SizeType;
 
+  /**
+   * @brief The policy choosing the free area of the atlas where an image is packed.
+   */
+  enum PackingPolicy
+  {
+    FIRST_FIT, ///< The first free area found where the image fits. This is the default.
+    BEST_FIT   ///< The free area leaving the shortest remaining side, packing images of a few repeated sizes more tightly.
+  };
+
 public:
   /**
    * @brief Pack a group of  pixel data into atlas.
@@ -119,6 +128,13 @@ public:
    */
   void SetBrokenImage(const std::string& brokenImageUrl);
 
+  /**
+   * @brief Set the policy choosing the free area where the next images are packed.
+   *
+   * @param[in] policy The packing policy.
+   */
+  void SetPackingPolicy(PackingPolicy policy);
+
   /**
    * @brief Upload a resource image to the atlas.
    *
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/utility/profiler.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/profiler.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Profiler
+{
+bool IsAvailable()
+{
+#if defined(PROFILING_ENABLED)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Enable(bool enable)
+{
+  Internal::Profiler::Enable(enable);
+}
+
+bool IsEnabled()
+{
+  return Internal::Profiler::gEnabled;
+}
+
+void SetCapacity(uint32_t capacity)
+{
+  Internal::Profiler::SetCapacity(capacity);
+}
+
+std::vector<Event> GetEvents()
+{
+  return Internal::Profiler::GetEvents();
+}
+
+std::vector<ControlTypeCounter> GetControlTypeCounters()
+{
+  return Internal::Profiler::GetControlTypeCounters();
+}
+
+std::string GetChromeTrace()
+{
+  return Internal::Profiler::GetChromeTrace();
+}
+
+bool WriteChromeTrace(const std::string& filename)
+{
+  return Internal::Profiler::WriteChromeTrace(filename);
+}
+
+void Clear()
+{
+  Internal::Profiler::Clear();
+}
+
+} // namespace Profiler
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,140 @@
+#ifndef DALI_TOOLKIT_PROFILER_H
+#define DALI_TOOLKIT_PROFILER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+/**
+ * @brief Measures the event thread time spent in the control and visual lifecycle.
+ *
+ * The toolkit is built with scoped measurements in its hot paths: registering and staging visuals,
+ * texture requests, text model updates and rendering, style application and relayout.
+ * They are compiled in only when the toolkit is a debug build or is built with ENABLE_PROFILING, and record nothing until Enable() is called.
+ *
+ * The measured scopes are kept in a ring buffer, which can be read with GetEvents() or written as a Chrome trace,
+ * and the scopes attributed to a control are added to the counter of its type name.
+ *
+ * @note All the functions must be called on the event thread.
+ */
+namespace Profiler
+{
+/**
+ * @brief A measured scope.
+ */
+struct Event
+{
+  std::string name;        ///< The name of the scope, e.g. "Visual::Base::SetOnScene"
+  std::string controlType; ///< The type name of the control the scope is attributed to, or an empty string
+  uint64_t    start;       ///< The start time in microseconds
+  uint32_t    duration;    ///< The duration in microseconds
+};
+
+/**
+ * @brief The aggregated scopes attributed to a type of control.
+ */
+struct ControlTypeCounter
+{
+  std::string controlType;   ///< The type name of the control, e.g. "PushButton"
+  uint32_t    count;         ///< The number of scopes
+  uint64_t    totalDuration; ///< The total duration of the scopes in microseconds
+  uint32_t    maxDuration;   ///< The longest scope in microseconds
+};
+
+/**
+ * @brief Whether the toolkit was built with the profiler.
+ *
+ * @return true if the scopes are compiled in
+ */
+DALI_TOOLKIT_API bool IsAvailable();
+
+/**
+ * @brief Starts or stops recording the scopes.
+ *
+ * @param[in] enable Whether to record the scopes
+ */
+DALI_TOOLKIT_API void Enable(bool enable);
+
+/**
+ * @brief Whether the scopes are being recorded.
+ *
+ * @return true if the profiler is enabled
+ */
+DALI_TOOLKIT_API bool IsEnabled();
+
+/**
+ * @brief Sets the number of scopes kept in the ring buffer. The default is 4096.
+ *
+ * The recorded scopes are cleared.
+ * @param[in] capacity The number of scopes
+ */
+DALI_TOOLKIT_API void SetCapacity(uint32_t capacity);
+
+/**
+ * @brief Retrieves the scopes in the ring buffer, the oldest first.
+ *
+ * @return The recorded scopes
+ */
+DALI_TOOLKIT_API std::vector<Event> GetEvents();
+
+/**
+ * @brief Retrieves the counters of the control types.
+ *
+ * The counters are not limited by the capacity of the ring buffer.
+ * @return The counters, sorted by total duration, the longest first
+ */
+DALI_TOOLKIT_API std::vector<ControlTypeCounter> GetControlTypeCounters();
+
+/**
+ * @brief Retrieves the scopes in the ring buffer in the Chrome trace event format.
+ *
+ * The result can be loaded in chrome://tracing or Perfetto.
+ * @return The JSON trace
+ */
+DALI_TOOLKIT_API std::string GetChromeTrace();
+
+/**
+ * @brief Writes the scopes in the ring buffer to a file in the Chrome trace event format.
+ *
+ * @param[in] filename The path of the file
+ * @return true if the file is written
+ */
+DALI_TOOLKIT_API bool WriteChromeTrace(const std::string& filename);
+
+/**
+ * @brief Clears the recorded scopes and the counters.
+ */
+DALI_TOOLKIT_API void Clear();
+
+} // namespace Profiler
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_PROFILER_H
@@ -101,6 +101,16 @@ Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions
   return GetImplementation(*this).CreateVisual(url, size);
 }
 
+VisualTemplate VisualFactory::Compile(const Property::Map& propertyMap)
+{
+  return GetImplementation(*this).Compile(propertyMap);
+}
+
+Visual::Base VisualFactory::CreateVisual(const VisualTemplate& visualTemplate)
+{
+  return GetImplementation(*this).CreateVisual(visualTemplate);
+}
+
 void VisualFactory::SetPreMultiplyOnLoad(bool preMultiply)
 {
   GetImplementation(*this).SetPreMultiplyOnLoad(preMultiply);
@@ -111,6 +121,21 @@ bool VisualFactory::GetPreMultiplyOnLoad() const
   return GetImplementation(*this).GetPreMultiplyOnLoad();
 }
 
+void VisualFactory::SetAtlasPackingPolicy(ImageAtlas::PackingPolicy policy)
+{
+  GetImplementation(*this).SetAtlasPackingPolicy(policy);
+}
+
+uint32_t VisualFactory::GetAtlasCount() const
+{
+  return GetImplementation(*this).GetAtlasCount();
+}
+
+float VisualFactory::GetAtlasOccupancyRate() const
+{
+  return GetImplementation(*this).GetAtlasOccupancyRate();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
@@ -24,7 +24,9 @@
 #include <dali/public-api/object/property-map.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/image-loader/image-atlas.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-template.h>
 
 namespace Dali
 {
@@ -107,6 +109,26 @@ public:
    */
   Visual::Base CreateVisual(const std::string& url, ImageDimensions size);
 
+  /**
+   * @brief Compile the property map of a visual into a template.
+   *
+   * The visual type and the url are resolved, and the property names known by the visual type are
+   * converted to property indices. Creating many visuals from the template is faster than creating
+   * them from the property map.
+   *
+   * @param[in] propertyMap The map contains the properties required by the visual.
+   * @return The handle to the template
+   */
+  VisualTemplate Compile(const Property::Map& propertyMap);
+
+  /**
+   * @brief Request the visual described by a template.
+   *
+   * @param[in] visualTemplate The template returned by Compile().
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualTemplate& visualTemplate);
+
   /**
    * @brief Enable or disable premultiplying alpha in images and image visuals.
    *
@@ -126,6 +148,31 @@ public:
    */
   bool GetPreMultiplyOnLoad() const;
 
+  /**
+   * @brief Set the policy choosing the free area where the images of the visuals are packed into the shared atlases.
+   *
+   * The default is ImageAtlas::FIRST_FIT. ImageAtlas::BEST_FIT packs the images of a few repeated sizes more tightly.
+   *
+   * @param[in] policy The packing policy.
+   */
+  void SetAtlasPackingPolicy(ImageAtlas::PackingPolicy policy);
+
+  /**
+   * @brief Get the number of atlases shared by the image visuals.
+   *
+   * @return The number of atlases.
+   */
+  uint32_t GetAtlasCount() const;
+
+  /**
+   * @brief Get what percentage of space is occupied in all the atlases shared by the image visuals.
+   *
+   * A low rate with several atlases means the atlases are fragmented.
+   *
+   * @return The occupancy rate of the atlases, 0 if no atlas is created.
+   */
+  float GetAtlasOccupancyRate() const;
+
 private:
   explicit DALI_INTERNAL VisualFactory(Internal::VisualFactory* impl);
 };
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/visual-factory/visual-template.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/visual-template-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+VisualTemplate::VisualTemplate()
+{
+}
+
+VisualTemplate::~VisualTemplate()
+{
+}
+
+VisualTemplate VisualTemplate::DownCast(BaseHandle handle)
+{
+  return VisualTemplate(dynamic_cast<Dali::Toolkit::Internal::VisualTemplate*>(handle.GetObjectPtr()));
+}
+
+VisualTemplate::VisualTemplate(const VisualTemplate& handle)
+: BaseHandle(handle)
+{
+}
+
+VisualTemplate& VisualTemplate::operator=(const VisualTemplate& handle)
+{
+  BaseHandle::operator=(handle);
+  return *this;
+}
+
+const Property::Map& VisualTemplate::GetPropertyMap() const
+{
+  return GetImplementation(*this).GetPropertyMap();
+}
+
+VisualTemplate::VisualTemplate(Internal::VisualTemplate* pointer)
+: BaseHandle(pointer)
+{
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,99 @@
+#ifndef DALI_TOOLKIT_VISUAL_TEMPLATE_H
+#define DALI_TOOLKIT_VISUAL_TEMPLATE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class VisualTemplate;
+}
+
+/**
+ * @brief A VisualTemplate is an immutable, pre-parsed property map of a visual.
+ *
+ * It is created by VisualFactory::Compile() and used by VisualFactory::CreateVisual( const VisualTemplate& )
+ * to create many visuals with the same properties, e.g. the rows of a list.
+ *
+ * The visual type and the url type are resolved once, and the property names are converted to property indices,
+ * so the visuals created from the template do not repeat the string comparisons.
+ */
+class DALI_TOOLKIT_API VisualTemplate : public BaseHandle
+{
+public:
+  /**
+   * @brief Create an uninitialized handle
+   */
+  VisualTemplate();
+
+  /**
+   * @brief Destructor - non virtual
+   */
+  ~VisualTemplate();
+
+  /**
+   * @brief Downcast to a VisualTemplate handle
+   *
+   * If handle is not a VisualTemplate, the returned handle is left uninitialized.
+   * @param[in] handle Handle to an object
+   * @return VisualTemplate handle or an uninitialized handle.
+   */
+  static VisualTemplate DownCast(BaseHandle handle);
+
+  /**
+   * @brief Copy constructor
+   *
+   * @param[in] handle Handle to an object
+   */
+  VisualTemplate(const VisualTemplate& handle);
+
+  /**
+   * @brief Assignment Operator
+   *
+   * @param[in] handle Handle to an object
+   * @return A reference to this object.
+   */
+  VisualTemplate& operator=(const VisualTemplate& handle);
+
+  /**
+   * @brief Retrieve the compiled property map
+   *
+   * The properties known by the visual type are keyed by index, unknown properties keep their string key.
+   * @return The compiled property map
+   */
+  const Property::Map& GetPropertyMap() const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL VisualTemplate(Internal::VisualTemplate* impl);
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VISUAL_TEMPLATE_H
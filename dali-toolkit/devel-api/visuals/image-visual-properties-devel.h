@@ -138,7 +138,24 @@ enum Type
    * And the array contains 2 integer values which are the frame numbers, the start frame number and the end frame number of the layer.
    * @note This property is read-only.
    */
-  CONTENT_INFO = ORIENTATION_CORRECTION + 10
+  CONTENT_INFO = ORIENTATION_CORRECTION + 10,
+
+  /**
+   * @brief Whether the AnimatedVectorImageVisual shares the rasterized frames with other visuals.
+   * @details Name "sharedRasterization", Type Property::BOOLEAN.
+   * All the visuals which enable this property and display the same url at the same size are rasterized only once per frame.
+   * The playback of those visuals is synchronized, so the animation keeps playing while any of them is playing.
+   * @note Default false. It is applied when the visual is placed on the scene and ignored if a custom shader is used.
+   */
+  SHARED_RASTERIZATION = ORIENTATION_CORRECTION + 11,
+
+  /**
+   * @brief The number of frames the AnimatedImageVisual or AnimatedVectorImageVisual skipped while it was not visible.
+   * @details Name "skippedFrameCount", Type Property::INTEGER.
+   * The animation is suspended while the visual is culled or fully transparent, and resumes at the frame it would have reached.
+   * @note This property is read-only.
+   */
+  SKIPPED_FRAME_COUNT = ORIENTATION_CORRECTION + 12
 };
 
 } //namespace Property
@@ -46,6 +46,7 @@
 #include <dali-toolkit/internal/builder/builder-set-property.h>
 #include <dali-toolkit/internal/builder/replacement.h>
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
+#include <dali-toolkit/internal/helpers/profiler.h>
 
 namespace Dali
 {
@@ -342,6 +343,12 @@ bool Builder::ApplyStyle( const std::string& styleName, Handle& handle )
   return ApplyStyle( styleName, handle, replacer );
 }
 
+bool Builder::ApplyStyleChanges( const std::string& styleName, Handle& handle, const Style& previousStyle )
+{
+  Replacement replacer( mReplacementMap );
+  return ApplyStyle( styleName, handle, replacer, &previousStyle );
+}
+
 bool Builder::LookupStyleName( const std::string& styleName )
 {
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
@@ -1094,8 +1101,10 @@ void Builder::SetupTask( RenderTask& task, const TreeNode& node, const Replaceme
   SetProperties( node, task, constant );
 }
 
-bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Replacement& replacement )
+bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Replacement& replacement, const Style* previousStyle )
 {
+  DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE( "Builder::ApplyStyle", handle );
+
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
 
   OptionalChild styles = IsChild( *mParser.GetRoot(), KEYNAME_STYLES );
@@ -1105,7 +1114,7 @@ bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Re
 
   if( styles && style )
   {
-    ApplyAllStyleProperties( *mParser.GetRoot(), *style, handle, replacement );
+    ApplyAllStyleProperties( *mParser.GetRoot(), *style, handle, replacement, previousStyle );
     return true;
   }
   else
@@ -1115,7 +1124,8 @@ bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Re
 }
 
 void Builder::ApplyAllStyleProperties( const TreeNode& root, const TreeNode& node,
-                                       Dali::Handle& handle, const Replacement& constant )
+                                       Dali::Handle& handle, const Replacement& constant,
+                                       const Style* previousStyle )
 {
   const char* styleName = node.GetName();
 
@@ -1172,7 +1182,14 @@ void Builder::ApplyAllStyleProperties( const TreeNode& root, const TreeNode& nod
   {
     StylePtr style( *matchedStyle );
     Dictionary<Property::Map> instancedProperties;
-    style->ApplyVisualsAndPropertiesRecursively( handle, instancedProperties );
+    if( previousStyle )
+    {
+      style->ApplyChangedVisualsAndPropertiesRecursively( handle, *previousStyle, instancedProperties );
+    }
+    else
+    {
+      style->ApplyVisualsAndPropertiesRecursively( handle, instancedProperties );
+    }
   }
   else // If there were no styles, instead set properties
   {
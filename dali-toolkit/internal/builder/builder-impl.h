@@ -153,6 +153,18 @@ public:
    */
   bool ApplyStyle( const std::string& styleName, Handle& handle );
 
+  /**
+   * Apply a style to a handle which is already styled by the previous
+   * style, e.g. the style of the previous theme. Only the visuals and
+   * properties which differ from the previous style are applied.
+   *
+   * @param[in] styleName The name of the set of style properties to set on the handle object.
+   * @param[in] handle The handle to apply the style to
+   * @param[in] previousStyle The style applied to the handle
+   * @return true if the style was found
+   */
+  bool ApplyStyleChanges( const std::string& styleName, Handle& handle, const Style& previousStyle );
+
   /**
    * Lookup the stylename in builder. If it's found in the parse tree,
    * then return true.
@@ -270,12 +282,14 @@ private:
 
   bool ApplyStyle( const std::string& styleName,
                    Handle&            handle,
-                   const Replacement& replacement);
+                   const Replacement& replacement,
+                   const Style*       previousStyle = NULL );
 
   void ApplyAllStyleProperties( const TreeNode&    root,
                                 const TreeNode&    node,
                                 Dali::Handle&      handle,
-                                const Replacement& constant );
+                                const Replacement& constant,
+                                const Style*       previousStyle = NULL );
 
   void RecordStyles( const char*        styleName,
                      const TreeNode&    node,
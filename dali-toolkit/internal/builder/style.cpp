@@ -14,11 +14,21 @@
  * limitations under the License.
  */
 
+#include <dali/public-api/common/extents.h>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/matrix3.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/public-api/object/handle.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali-toolkit/public-api/controls/control.h>
+#include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/public-api/visuals/color-visual-properties.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
+#include <dali-toolkit/devel-api/visuals/color-visual-actions-devel.h>
 #include <dali-toolkit/internal/builder/style.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 
@@ -33,6 +43,229 @@ namespace Internal
 extern const Dali::Scripting::StringEnum ControlStateTable[];
 extern const unsigned int ControlStateTableCount;
 
+namespace
+{
+
+bool IsEqual( const Property::Map& lhs, const Property::Map& rhs );
+
+/**
+ * Whether two property values are equal. Arrays and maps are compared element by element.
+ */
+bool IsEqual( const Property::Value& lhs, const Property::Value& rhs )
+{
+  const Property::Type type = lhs.GetType();
+  if( type != rhs.GetType() )
+  {
+    return false;
+  }
+
+  switch( type )
+  {
+    case Property::NONE:
+    {
+      return true;
+    }
+    case Property::BOOLEAN:
+    {
+      return lhs.Get<bool>() == rhs.Get<bool>();
+    }
+    case Property::FLOAT:
+    {
+      return Equals( lhs.Get<float>(), rhs.Get<float>() );
+    }
+    case Property::INTEGER:
+    {
+      return lhs.Get<int>() == rhs.Get<int>();
+    }
+    case Property::VECTOR2:
+    {
+      return lhs.Get<Vector2>() == rhs.Get<Vector2>();
+    }
+    case Property::VECTOR3:
+    {
+      return lhs.Get<Vector3>() == rhs.Get<Vector3>();
+    }
+    case Property::VECTOR4:
+    {
+      return lhs.Get<Vector4>() == rhs.Get<Vector4>();
+    }
+    case Property::MATRIX3:
+    {
+      return lhs.Get<Matrix3>() == rhs.Get<Matrix3>();
+    }
+    case Property::MATRIX:
+    {
+      return lhs.Get<Matrix>() == rhs.Get<Matrix>();
+    }
+    case Property::RECTANGLE:
+    {
+      return lhs.Get< Rect<int> >() == rhs.Get< Rect<int> >();
+    }
+    case Property::ROTATION:
+    {
+      return lhs.Get<Quaternion>() == rhs.Get<Quaternion>();
+    }
+    case Property::STRING:
+    {
+      return lhs.Get<std::string>() == rhs.Get<std::string>();
+    }
+    case Property::EXTENTS:
+    {
+      return lhs.Get<Extents>() == rhs.Get<Extents>();
+    }
+    case Property::ARRAY:
+    {
+      const Property::Array* lhsArray = lhs.GetArray();
+      const Property::Array* rhsArray = rhs.GetArray();
+      if( ! lhsArray || ! rhsArray || lhsArray->Count() != rhsArray->Count() )
+      {
+        return false;
+      }
+      for( Property::Array::SizeType i = 0; i < lhsArray->Count(); ++i )
+      {
+        if( ! IsEqual( lhsArray->GetElementAt( i ), rhsArray->GetElementAt( i ) ) )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    case Property::MAP:
+    {
+      const Property::Map* lhsMap = lhs.GetMap();
+      const Property::Map* rhsMap = rhs.GetMap();
+      return lhsMap && rhsMap && IsEqual( *lhsMap, *rhsMap );
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Find the value of a key, whether it's an index or a string.
+ */
+const Property::Value* FindKey( const Property::Map& map, const Property::Key& key )
+{
+  if( key.type == Property::Key::INDEX )
+  {
+    return map.Find( key.indexKey );
+  }
+  return map.Find( key.stringKey );
+}
+
+/**
+ * Whether two maps have the same keys and values. The order of the keys doesn't matter.
+ */
+bool IsEqual( const Property::Map& lhs, const Property::Map& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( Property::Map::SizeType i = 0; i < lhs.Count(); ++i )
+  {
+    KeyValuePair keyValue = lhs.GetKeyValue( i );
+    const Property::Value* rhsValue = FindKey( rhs, keyValue.first );
+    if( ! rhsValue || ! IsEqual( keyValue.second, *rhsValue ) )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Whether the visual registered with the handle under the visual name is still the one the style
+ * created from the visual map, i.e. the application has neither replaced nor changed it since.
+ */
+bool IsStyledVisual( Handle handle, const std::string& visualName, const Property::Map& visualMap )
+{
+  Toolkit::Control control = Toolkit::Control::DownCast( handle );
+  if( ! control )
+  {
+    return false;
+  }
+
+  const Property::Index index = handle.GetPropertyIndex( visualName );
+  Toolkit::Visual::Base visual = DevelControl::GetVisual( Toolkit::Internal::GetImplementation( control ), index );
+  Toolkit::Visual::Base styledVisual = Toolkit::VisualFactory::Get().CreateVisual( visualMap );
+  if( ! visual || ! styledVisual )
+  {
+    return false;
+  }
+
+  Property::Map map;
+  visual.CreatePropertyMap( map );
+  Property::Map styledMap;
+  styledVisual.CreatePropertyMap( styledMap );
+
+  return IsEqual( map, styledMap );
+}
+
+/**
+ * Update the mix color of the color visual, which the style created from the previous visual map,
+ * through the UPDATE_PROPERTY action if it's the only difference between the previous and the new visual maps.
+ *
+ * @return true if the visual is updated, false if a new visual has to be created.
+ */
+bool UpdateColorVisual( Handle handle,
+                        const std::string& visualName,
+                        const Property::Map& visualMap,
+                        const Property::Map& previousVisualMap )
+{
+  Toolkit::Control control = Toolkit::Control::DownCast( handle );
+  if( ! control || visualMap.Count() != previousVisualMap.Count() )
+  {
+    return false;
+  }
+
+  const Property::Value* typeValue = visualMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
+  int visualType = -1;
+  if( ! typeValue ||
+      ! Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType ) ||
+      visualType != Toolkit::Visual::COLOR )
+  {
+    return false;
+  }
+
+  // The renderer of a transparent color visual is not added to the actor, so a change of transparency needs a new visual.
+  const Property::Value* colorValue = visualMap.Find( Toolkit::ColorVisual::Property::MIX_COLOR, MIX_COLOR );
+  const Property::Value* previousColorValue = previousVisualMap.Find( Toolkit::ColorVisual::Property::MIX_COLOR, MIX_COLOR );
+  if( ! colorValue || ! previousColorValue ||
+      colorValue->GetType() != Property::VECTOR4 || previousColorValue->GetType() != Property::VECTOR4 ||
+      colorValue->Get<Vector4>().a <= 0.0f || previousColorValue->Get<Vector4>().a <= 0.0f )
+  {
+    return false;
+  }
+
+  for( Property::Map::SizeType i = 0; i < visualMap.Count(); ++i )
+  {
+    KeyValuePair keyValue = visualMap.GetKeyValue( i );
+    const Property::Key& key = keyValue.first;
+    if( ( key.type == Property::Key::INDEX && key.indexKey == Toolkit::ColorVisual::Property::MIX_COLOR ) ||
+        ( key.type == Property::Key::STRING && key.stringKey == MIX_COLOR ) )
+    {
+      continue;
+    }
+
+    const Property::Value* previousValue = FindKey( previousVisualMap, key );
+    if( ! previousValue || ! IsEqual( keyValue.second, *previousValue ) )
+    {
+      return false;
+    }
+  }
+
+  Property::Map attributes;
+  attributes.Insert( Toolkit::ColorVisual::Property::MIX_COLOR, *colorValue );
+  DevelControl::DoAction( control, handle.GetPropertyIndex( visualName ), DevelColorVisual::Action::UPDATE_PROPERTY, attributes );
+
+  return true;
+}
+
+} // unnamed namespace
+
 StylePtr Style::New()
 {
   StylePtr stylePtr( new Style() );
@@ -46,6 +279,80 @@ void Style::ApplyVisualsAndPropertiesRecursively(
   ApplyVisuals( handle, instancedProperties );
   ApplyProperties( handle );
 
+  const Style* stateStyle = NULL;
+  const Style* subStateStyle = NULL;
+  FindStateStyles( handle, stateStyle, subStateStyle );
+
+  if( stateStyle )
+  {
+    // We have a state match.
+    stateStyle->ApplyVisuals( handle, instancedProperties );
+    stateStyle->ApplyProperties( handle );
+
+    if( subStateStyle )
+    {
+      // We have a sub-state match.
+      subStateStyle->ApplyVisuals( handle, instancedProperties );
+      subStateStyle->ApplyProperties( handle );
+    }
+  }
+}
+
+void Style::ApplyChangedVisualsAndPropertiesRecursively(
+  Handle handle,
+  const Style& previousStyle,
+  const Dictionary<Property::Map>& instancedProperties ) const
+{
+  // Compare what ends up applied for the current state, as a state may override a changed visual or property.
+  Dictionary<Property::Map> visualMaps;
+  Property::Map propertyMap;
+  CollectVisualsAndPropertiesRecursively( handle, visualMaps, propertyMap );
+
+  Dictionary<Property::Map> previousVisualMaps;
+  Property::Map previousPropertyMap;
+  previousStyle.CollectVisualsAndPropertiesRecursively( handle, previousVisualMaps, previousPropertyMap );
+
+  for( Dictionary<Property::Map>::iterator iter = visualMaps.Begin(); iter != visualMaps.End() ; ++iter )
+  {
+    const std::string& visualName = (*iter).key;
+    const Property::Map& visualMap = (*iter).entry;
+    Property::Map* instancedMap = instancedProperties.Find( visualName );
+    const Property::Map* previousVisualMap = previousVisualMaps.FindConst( visualName );
+
+    // A visual the application has replaced or changed is styled again, as when the whole style is applied.
+    if( previousVisualMap && ! instancedMap && IsStyledVisual( handle, visualName, *previousVisualMap ) )
+    {
+      if( IsEqual( visualMap, *previousVisualMap ) ||
+          UpdateColorVisual( handle, visualName, visualMap, *previousVisualMap ) )
+      {
+        continue;
+      }
+    }
+
+    ApplyVisual( handle, visualName, visualMap, instancedMap );
+  }
+
+  for( Property::Map::SizeType i=0; i<propertyMap.Count(); ++i )
+  {
+    KeyValuePair keyValue = propertyMap.GetKeyValue( i );
+    if( keyValue.first.type == Property::Key::INDEX )
+    {
+      // A property the application has overridden is styled again, as when the whole style is applied.
+      const Property::Value* previousValue = previousPropertyMap.Find( keyValue.first.indexKey );
+      if( ! previousValue || ! IsEqual( keyValue.second, *previousValue ) ||
+          ! IsEqual( handle.GetProperty( keyValue.first.indexKey ), keyValue.second ) )
+      {
+        handle.SetProperty( keyValue.first.indexKey, keyValue.second );
+      }
+    }
+  }
+}
+
+void Style::FindStateStyles( Handle handle, const Style*& stateStyle, const Style*& subStateStyle ) const
+{
+  stateStyle = NULL;
+  subStateStyle = NULL;
+
   Toolkit::Control control = Toolkit::Control::DownCast(handle);
   if( control )
   {
@@ -60,24 +367,17 @@ void Style::ApplyVisualsAndPropertiesRecursively(
       const StylePtr* stylePtr = subStates.FindConst( stateName );
       if( stylePtr )
       {
-        const StylePtr statePtr(*stylePtr);
-
-        // We have a state match.
-        statePtr->ApplyVisuals( handle, instancedProperties );
-        statePtr->ApplyProperties( handle );
+        stateStyle = stylePtr->Get();
 
-        // Apply substate visuals
+        // Look up substate in the state's substates table:
         Property::Value value = control.GetProperty(DevelControl::Property::SUB_STATE);
         std::string subStateName;
         if( value.Get( subStateName ) && ! subStateName.empty() )
         {
-          const StylePtr* stylePtr = statePtr->subStates.FindConst( subStateName );
+          const StylePtr* stylePtr = stateStyle->subStates.FindConst( subStateName );
           if( stylePtr )
           {
-            const StylePtr subStatePtr(*stylePtr);
-            // We have a sub-state match.
-            subStatePtr->ApplyVisuals( handle, instancedProperties );
-            subStatePtr->ApplyProperties( handle );
+            subStateStyle = stylePtr->Get();
           }
         }
       }
@@ -85,6 +385,31 @@ void Style::ApplyVisualsAndPropertiesRecursively(
   }
 }
 
+void Style::CollectVisualsAndPropertiesRecursively(
+  Handle handle,
+  Dictionary<Property::Map>& visualMaps,
+  Property::Map& propertyMap ) const
+{
+  visualMaps.Merge( visuals );
+  propertyMap.Merge( properties );
+
+  const Style* stateStyle = NULL;
+  const Style* subStateStyle = NULL;
+  FindStateStyles( handle, stateStyle, subStateStyle );
+
+  if( stateStyle )
+  {
+    visualMaps.Merge( stateStyle->visuals );
+    propertyMap.Merge( stateStyle->properties );
+
+    if( subStateStyle )
+    {
+      visualMaps.Merge( subStateStyle->visuals );
+      propertyMap.Merge( subStateStyle->properties );
+    }
+  }
+}
+
 void Style::ApplyVisuals(
   Handle handle,
   const Dictionary<Property::Map>& instancedProperties ) const
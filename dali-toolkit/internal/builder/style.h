@@ -60,6 +60,23 @@ public:
   void ApplyVisualsAndPropertiesRecursively( Handle handle,
                                              const Dictionary<Property::Map>& instancedProperties ) const;
 
+  /**
+   * Apply the visuals and properties for the current state/substate
+   * of the handle which differ from those of the previous style, e.g.
+   * the style of the same control in the previous theme. The visuals
+   * and properties which are unchanged are not applied again, unless
+   * the application has changed them since the previous style was
+   * applied, and a color visual whose mix color only has changed is
+   * updated in place.
+   *
+   * @param[in] handle The handle to apply the visuals to
+   * @param[in] previousStyle The style currently applied to the handle
+   * @param[in] instancedProperties The maps from which to get instanced properties
+   */
+  void ApplyChangedVisualsAndPropertiesRecursively( Handle handle,
+                                                    const Style& previousStyle,
+                                                    const Dictionary<Property::Map>& instancedProperties ) const;
+
   /**
    * Apply the visuals of the style to the control pointed at by
    * handle.
@@ -111,6 +128,28 @@ protected:
   ~Style() override;
 
 private:
+  /**
+   * Find the styles of the current state and substate of the handle.
+   *
+   * @param[in] handle The handle whose state is used
+   * @param[out] stateStyle The style of the state, or NULL
+   * @param[out] subStateStyle The style of the substate, or NULL
+   */
+  void FindStateStyles( Handle handle, const Style*& stateStyle, const Style*& subStateStyle ) const;
+
+  /**
+   * Collect the visuals and properties for the current state/substate
+   * of the handle, as they are applied by ApplyVisualsAndPropertiesRecursively().
+   * The visuals and properties of the states override those of the style.
+   *
+   * @param[in] handle The handle whose state is used
+   * @param[out] visualMaps The visual maps
+   * @param[out] propertyMap The properties
+   */
+  void CollectVisualsAndPropertiesRecursively( Handle handle,
+                                               Dictionary<Property::Map>& visualMaps,
+                                               Property::Map& propertyMap ) const;
+
   // Not implemented
   DALI_INTERNAL Style( const Style& rhs );
 
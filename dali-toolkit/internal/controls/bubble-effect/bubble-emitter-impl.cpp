@@ -59,6 +59,9 @@ float RandomRange(float f0, float f1, unsigned int& seed)
   return f0 + (rand_r( &seed ) & 0xfff) * (f1-f0) * (1.0f/4095.0f);
 }
 
+// The bubbles controlled by the same uniforms are offset by uOffset[9] in the shader
+const unsigned int MAXIMUM_DENSITY = 9u;
+
 const char* VERTEX_SHADER = DALI_COMPOSE_SHADER(
   attribute mediump vec2 aPosition;\n
   attribute mediump vec2 aTexCoord;\n
@@ -219,8 +222,9 @@ void BubbleEmitter::OnInitialize()
   mEffectTexture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, imageSize.x, imageSize.y );
   mFrameBuffer.AttachColorTexture( mEffectTexture );
 
-  // Generate the geometry, which is used by all bubbleActors
-  mMeshGeometry =  CreateGeometry( mNumBubblePerRenderer*mDensity );
+  // Generate the geometry, which is used by all bubbleActors.
+  // It holds the patches of the maximum density, so changing the density only changes the drawn index range.
+  mMeshGeometry =  CreateGeometry( mNumBubblePerRenderer*MAXIMUM_DENSITY );
 
   Shader bubbleShader = CreateBubbleShader( mNumBubblePerRenderer );
 
@@ -233,6 +237,7 @@ void BubbleEmitter::OnInitialize()
   for(unsigned int i=0; i < mNumRenderer; i++ )
   {
     mBubbleRenderers[i].Initialize( mNumBubblePerRenderer, mMovementArea, mMeshGeometry, mTextureSet, bubbleShader );
+    mBubbleRenderers[i].SetNumberOfPatch( mNumBubblePerRenderer*mDensity );
     mBubbleRoot.AddRenderer( mBubbleRenderers[i].GetRenderer() );
   }
 
@@ -299,7 +304,7 @@ void BubbleEmitter::SetBubbleScale( float scale )
 
 void BubbleEmitter::SetBubbleDensity( unsigned int density )
 {
-  DALI_ASSERT_ALWAYS( density>0 && density<=9 && " Only densities between 1 to 9 are valid " );
+  DALI_ASSERT_ALWAYS( density>0 && density<=MAXIMUM_DENSITY && " Only densities between 1 to 9 are valid " );
 
   if( density == mDensity )
   {
@@ -308,10 +313,9 @@ void BubbleEmitter::SetBubbleDensity( unsigned int density )
   else
   {
     mDensity = density;
-    mMeshGeometry =  CreateGeometry( mNumBubblePerRenderer*mDensity );
     for(unsigned int i=0; i < mNumRenderer; i++ )
     {
-      mBubbleRenderers[i].SetGeometry( mMeshGeometry );
+      mBubbleRenderers[i].SetNumberOfPatch( mNumBubblePerRenderer*mDensity );
     }
   }
 }
@@ -96,9 +96,11 @@ Renderer& BubbleRenderer::GetRenderer()
   return mRenderer;
 }
 
-void BubbleRenderer::SetGeometry( Geometry geometry )
+void BubbleRenderer::SetNumberOfPatch( unsigned int numberOfPatch )
 {
-  mRenderer.SetGeometry( geometry );
+  // Each patch is drawn with six indices
+  mRenderer.SetProperty( Renderer::Property::INDEX_RANGE_FIRST, 0 );
+  mRenderer.SetProperty( Renderer::Property::INDEX_RANGE_COUNT, static_cast<int>( numberOfPatch * 6u ) );
 }
 
 void BubbleRenderer::SetStartAndEndPosition( unsigned int index, const Vector4& startAndEndPosition )
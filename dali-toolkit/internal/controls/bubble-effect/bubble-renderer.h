@@ -73,10 +73,11 @@ public:
   Renderer& GetRenderer();
 
   /**
-   * Sets the geometry to be used by the renderer
-   * @param[in] geometry The geometry to be used by the renderer
+   * Set how many patches of the geometry are rendered.
+   * The geometry holds the patches of all the densities, only the first ones are drawn.
+   * @param[in] numberOfPatch The number of patches to render.
    */
-  void SetGeometry( Geometry geometry );
+  void SetNumberOfPatch( unsigned int numberOfPatch );
 
   /**
    * Set the start and end positions of the index-th bubble's movement.
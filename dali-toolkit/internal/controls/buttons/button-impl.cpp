@@ -20,7 +20,9 @@
 
 // EXTERNAL INCLUDES
 #include <cstring> // for strcmp
+#include <algorithm>
 #include <dali/devel-api/scripting/enum-helper.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/events/touch-event.h>
 #include <dali/public-api/object/type-registry.h>
@@ -86,6 +88,7 @@ DALI_PROPERTY_REGISTRATION( Toolkit, Button, "disabledSelectedBackgroundVisual",
 DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, Button, "labelRelativeAlignment",             STRING,  LABEL_RELATIVE_ALIGNMENT              )
 DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, Button, "labelPadding",                       VECTOR4, LABEL_PADDING                         )
 DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, Button, "visualPadding",                      VECTOR4, VISUAL_PADDING                        )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, Button, "prefetchStateVisuals",               BOOLEAN, PREFETCH_STATE_VISUALS                )
 
 // Signals:
 DALI_SIGNAL_REGISTRATION(   Toolkit, Button, "pressed",                               SIGNAL_PRESSED               )
@@ -148,9 +151,11 @@ Button::Button()
 : Control( ControlBehaviour( CONTROL_BEHAVIOUR_DEFAULT ) ),
   mAutoRepeatingTimer(),
   mTextLabelAlignment( END ),
+  mIdleCallback( nullptr ),
   mAutoRepeating( false ),
   mTogglableButton( false ),
   mTextStringSetFlag( false ),
+  mPrefetchStateVisuals( false ),
   mInitialAutoRepeatingDelay( 0.0f ),
   mNextAutoRepeatingDelay( 0.0f ),
   mAnimationTime( 0.0f ),
@@ -163,6 +168,11 @@ Button::Button()
 
 Button::~Button()
 {
+  if( ( nullptr != mIdleCallback ) && Adaptor::IsAvailable() )
+  {
+    // Removes the callback from the callback manager in case the button is destroyed before the callback is executed.
+    Adaptor::Get().RemoveIdle( mIdleCallback );
+  }
 }
 
 void Button::SetAutoRepeating( bool autoRepeating )
@@ -355,14 +365,40 @@ Button::Align Button::GetLabelAlignment()
 
 /**
  * Create Visual for given index from a property map or url.
+ * 1) Keep the url or map if the visual is not required yet. The visual is created when required ( Button::CreatePendingVisual )
+ * 2) Otherwise create and register the visual ( Button::RegisterComponentVisual )
+ */
+void Button::CreateVisualsForComponent( Property::Index index, const Property::Value& value, const int visualDepth )
+{
+  DALI_LOG_INFO( gLogButtonFilter, Debug::Verbose, "CreateVisualsForComponent index(%d)\n", index );
+
+  RemovePendingVisual( index );
+
+  std::string imageUrl;
+  const Property::Map* map = value.GetMap();
+  const bool hasVisual = value.Get( imageUrl ) ? !imageUrl.empty() : ( map && !map->Empty() );
+  if( hasVisual && CanDeferVisual( index ) )
+  {
+    DALI_LOG_INFO( gLogButtonFilter, Debug::Verbose, "CreateVisualsForComponent Deferring visual(%d)\n", index );
+    DevelControl::UnregisterVisual( *this, index ); // Any previous visual is replaced
+    mPendingVisuals.push_back( PendingVisual{ index, value, visualDepth } );
+    RequestPrefetchIdleCallback();
+  }
+  else
+  {
+    RegisterComponentVisual( index, value, visualDepth );
+  }
+  RelayoutRequest();
+}
+
+/**
  * 1) Check if value passed in is a url and create visual
  * 2) Create visual from map if step (1) is false
  * 3) Register visual with control with false for enable flag. Button will later enable visual when needed ( Button::SelectRequiredVisual )
  * 4) Unregister visual if empty map was provided. This is the method to remove a visual
  */
-void Button::CreateVisualsForComponent( Property::Index index, const Property::Value& value, const int visualDepth )
+void Button::RegisterComponentVisual( Property::Index index, const Property::Value& value, const int visualDepth )
 {
-  DALI_LOG_INFO( gLogButtonFilter, Debug::Verbose, "CreateVisualsForComponent index(%d)\n", index );
   Toolkit::VisualFactory visualFactory = Toolkit::VisualFactory::Get();
   Toolkit::Visual::Base buttonVisual;
 
@@ -402,13 +438,23 @@ void Button::CreateVisualsForComponent( Property::Index index, const Property::V
     DevelControl::UnregisterVisual( *this, index );
     DALI_LOG_INFO( gLogButtonFilter, Debug::General, "CreateVisualsForComponent Visual not created or empty map (clearing visual).(%d)\n", index);
   }
-  RelayoutRequest();
 }
 
-bool Button::GetPropertyMapForVisual( Property::Index visualIndex, Property::Map& retreivedMap ) const
+void Button::RemovePendingVisual( Property::Index index )
+{
+  auto iter = std::find_if( mPendingVisuals.begin(), mPendingVisuals.end(),
+                            [index]( const PendingVisual& pendingVisual ) { return pendingVisual.index == index; } );
+  if( iter != mPendingVisuals.end() )
+  {
+    mPendingVisuals.erase( iter );
+  }
+}
+
+bool Button::GetPropertyMapForVisual( Property::Index visualIndex, Property::Map& retreivedMap )
 {
   DALI_LOG_INFO( gLogButtonFilter, Debug::General, "GetPropertyMapForVisual visual(%d)\n", visualIndex);
   bool success = false;
+  CreatePendingVisual( visualIndex ); // The map of the created visual is returned, as for the visuals created straight away
   Toolkit::Visual::Base visual = DevelControl::GetVisual( *this, visualIndex );
   if ( visual )
   {
@@ -713,6 +759,7 @@ void Button::OnSceneConnection( int depth )
   SelectRequiredVisual( VISUAL_INDEX_FOR_STATE[ mButtonState ][ BACKGROUND ] );
   SelectRequiredVisual( VISUAL_INDEX_FOR_STATE[ mButtonState ][ FOREGROUND ] );
   Control::OnSceneConnection( depth ); // Enabled visuals will be put on stage
+  RequestPrefetchIdleCallback();
   RelayoutRequest();
 }
 
@@ -730,6 +777,7 @@ Vector3 Button::GetNaturalSize()
 
   for ( int state = Button::UNSELECTED_STATE; state < Button::STATE_COUNT; state++ )
   {
+    CreatePendingVisual( VISUAL_INDEX_FOR_STATE[state][FOREGROUND] ); // The natural size is the largest of all the states
     Toolkit::Visual::Base visual = DevelControl::GetVisual( *this, VISUAL_INDEX_FOR_STATE[state][FOREGROUND] );
     Size visualSize;
     if ( visual )
@@ -745,6 +793,7 @@ Vector3 Button::GetNaturalSize()
   {
     for ( int state = Button::UNSELECTED_STATE; state < Button::STATE_COUNT; state++ )
     {
+      CreatePendingVisual( VISUAL_INDEX_FOR_STATE[state][BACKGROUND] );
       Toolkit::Visual::Base visual = DevelControl::GetVisual( *this, VISUAL_INDEX_FOR_STATE[state][BACKGROUND] );
       Size visualSize;
       if ( visual )
@@ -1042,6 +1091,7 @@ void Button::Released()
 void Button::SelectRequiredVisual( Property::Index visualIndex )
 {
   DALI_LOG_INFO( gLogButtonFilter, Debug::Verbose, "Button::SelectRequiredVisual index(%d) state(%d)\n", visualIndex, mButtonState );
+  CreatePendingVisual( visualIndex );
   // only enable visuals that exist
   if( DevelControl::GetVisual( *this, visualIndex ) )
   {
@@ -1049,6 +1099,66 @@ void Button::SelectRequiredVisual( Property::Index visualIndex )
   }
 }
 
+bool Button::CanDeferVisual( Property::Index visualIndex ) const
+{
+  if( visualIndex == Toolkit::Button::Property::LABEL )
+  {
+    return false;
+  }
+
+  // The visuals of the current state are shown as soon as the button is on scene
+  const bool currentState = ( visualIndex == VISUAL_INDEX_FOR_STATE[ mButtonState ][ BACKGROUND ] ) ||
+                            ( visualIndex == VISUAL_INDEX_FOR_STATE[ mButtonState ][ FOREGROUND ] );
+  return !currentState || !Self().GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE );
+}
+
+void Button::CreatePendingVisual( Property::Index visualIndex )
+{
+  auto iter = std::find_if( mPendingVisuals.begin(), mPendingVisuals.end(),
+                            [visualIndex]( const PendingVisual& pendingVisual ) { return pendingVisual.index == visualIndex; } );
+  if( iter != mPendingVisuals.end() )
+  {
+    DALI_LOG_INFO( gLogButtonFilter, Debug::Verbose, "Button::CreatePendingVisual index(%d) state(%d)\n", visualIndex, mButtonState );
+
+    PendingVisual pendingVisual = std::move( *iter );
+    mPendingVisuals.erase( iter );
+    RegisterComponentVisual( pendingVisual.index, pendingVisual.value, pendingVisual.depthIndex );
+  }
+}
+
+void Button::RequestPrefetchIdleCallback()
+{
+  if( mPrefetchStateVisuals && !mPendingVisuals.empty() && ( nullptr == mIdleCallback ) &&
+      Self().GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) && Adaptor::IsAvailable() )
+  {
+    // @note: The callback manager takes the ownership of the callback object.
+    mIdleCallback = MakeCallback( this, &Button::OnIdlePrefetch );
+    if( !Adaptor::Get().AddIdle( mIdleCallback, true ) )
+    {
+      mIdleCallback = nullptr;
+    }
+  }
+}
+
+bool Button::OnIdlePrefetch()
+{
+  // Create one visual per callback to not block the event thread for long.
+  if( !mPendingVisuals.empty() )
+  {
+    CreatePendingVisual( mPendingVisuals.front().index );
+  }
+
+  if( mPrefetchStateVisuals && !mPendingVisuals.empty() && Self().GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) )
+  {
+    return true;
+  }
+
+  // Set the pointer to null as the callback manager deletes the callback when it returns false.
+  mIdleCallback = nullptr;
+
+  return false;
+}
+
 void Button::RemoveVisual( Property::Index visualIndex )
 {
   // Use OnButtonVisualRemoval if want button developer to have the option to override removal.
@@ -1190,6 +1300,12 @@ void Button::SetProperty( BaseObject* object, Property::Index index, const Prope
         GetImplementation( button ).SetForegroundPadding( Padding( padding.x, padding.y, padding.z, padding.w ) );
         break;
       }
+
+      case Toolkit::DevelButton::Property::PREFETCH_STATE_VISUALS:
+      {
+        GetImplementation( button ).SetPrefetchStateVisuals( value.Get< bool >() );
+        break;
+      }
     }
   }
 }
@@ -1282,6 +1398,13 @@ Property::Value Button::GetProperty( BaseObject* object, Property::Index propert
       {
         Padding padding = GetImplementation( button ).GetForegroundPadding();
         value = Vector4( padding.x, padding.y, padding.top, padding.bottom);
+        break;
+      }
+
+      case Toolkit::DevelButton::Property::PREFETCH_STATE_VISUALS:
+      {
+        value = GetImplementation( button ).GetPrefetchStateVisuals();
+        break;
       }
     }
   }
@@ -1313,6 +1436,17 @@ Padding Button::GetForegroundPadding()
   return mForegroundPadding;
 }
 
+void Button::SetPrefetchStateVisuals( bool prefetch )
+{
+  mPrefetchStateVisuals = prefetch;
+  RequestPrefetchIdleCallback();
+}
+
+bool Button::GetPrefetchStateVisuals() const
+{
+  return mPrefetchStateVisuals;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <vector>
 #include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/animation/animation.h>
 
@@ -445,6 +446,18 @@ protected:
    */
   Padding GetForegroundPadding();
 
+  /**
+   * Sets whether the deferred state visuals are created at idle once the button is on scene.
+   * @param[in] prefetch true to prefetch the state visuals
+   */
+  void SetPrefetchStateVisuals( bool prefetch );
+
+  /**
+   * Gets whether the deferred state visuals are created at idle once the button is on scene.
+   * @return true if the state visuals are prefetched
+   */
+  bool GetPrefetchStateVisuals() const;
+
   /**
    * @brief Setup the button components for example foregrounds and background
    * @param[in] index the index of the visual to set
@@ -453,13 +466,19 @@ protected:
    */
   void CreateVisualsForComponent( Property::Index index, const Property::Value& value, const int visualDepth );
 
+  /**
+   * @brief Discards the deferred creation of the visual, for the derived buttons registering their own visual at the index
+   * @param[in] index the index of the visual
+   */
+  void RemovePendingVisual( Property::Index index );
+
   /**
    * @brief Get the Property map for the given Visual
    * @param[in] visualIndex visual index of the required visual
    * @param[out] retreivedMap the property map used to construct the required visual
    * @return bool success flag, true if visual found
    */
-  bool GetPropertyMapForVisual( Property::Index visualIndex, Property::Map& retreivedMap ) const;
+  bool GetPropertyMapForVisual( Property::Index visualIndex, Property::Map& retreivedMap );
   /**
    * Returns the animation to be used for transition, creating the animation if needed.
    * @return The initialised transition animation.
@@ -501,6 +520,39 @@ private:
    */
   void SelectRequiredVisual( Property::Index visualIndex );
 
+  /**
+   * Creates the visual from a url or a property map and registers it, or unregisters the visual if the value is empty.
+   * @param[in] index the index of the visual to set
+   * @param[in] value the url or the property map of the visual
+   * @param[in] visualDepth the depth of the visual if overlapping another
+   */
+  void RegisterComponentVisual( Property::Index index, const Property::Value& value, const int visualDepth );
+
+  /**
+   * Whether the creation of the visual can wait until it is required.
+   * Only the visuals of the states not shown yet are deferred, the label is always created.
+   * @param[in] visualIndex The Property index of the visual
+   * @return true if the visual can be deferred
+   */
+  bool CanDeferVisual( Property::Index visualIndex ) const;
+
+  /**
+   * Creates and registers the visual if its creation has been deferred.
+   * @param[in] visualIndex The Property index of the visual
+   */
+  void CreatePendingVisual( Property::Index visualIndex );
+
+  /**
+   * Requests an idle callback to create the deferred visuals, if the prefetch is enabled.
+   */
+  void RequestPrefetchIdleCallback();
+
+  /**
+   * Creates one deferred visual per idle callback.
+   * @return true if there are more deferred visuals to create
+   */
+  bool OnIdlePrefetch();
+
   // Undefined
   Button( const Button& );
 
@@ -509,6 +561,16 @@ private:
 
 private:
 
+  /**
+   * The description of a visual whose creation is deferred until it is required.
+   */
+  struct PendingVisual
+  {
+    Property::Index index;      ///< The Property index of the visual
+    Property::Value value;      ///< The url or the property map of the visual
+    int             depthIndex; ///< The depth of the visual
+  };
+
   // Signals
   Toolkit::Button::ButtonSignalType mPressedSignal;           ///< Signal emitted when the button is pressed.
   Toolkit::Button::ButtonSignalType mReleasedSignal;          ///< Signal emitted when the button is released.
@@ -525,9 +587,13 @@ private:
 
   TapGestureDetector mTapDetector;
 
+  std::vector< PendingVisual > mPendingVisuals;  ///< The state visuals not created yet.
+  CallbackBase*    mIdleCallback;               ///< The idle callback prefetching the pending visuals. It's owned by the adaptor.
+
   bool             mAutoRepeating;              ///< Stores the autorepeating property.
   bool             mTogglableButton;            ///< Stores the togglable property as a flag.
   bool             mTextStringSetFlag;          ///< Stores if text has been set. Required in relayout but don't want to calculate there.
+  bool             mPrefetchStateVisuals;       ///< Whether the pending visuals are created at idle once the button is on scene.
 
   float            mInitialAutoRepeatingDelay;  ///< Stores the initial autorepeating delay in seconds.
   float            mNextAutoRepeatingDelay;     ///< Stores the next autorepeating delay in seconds.
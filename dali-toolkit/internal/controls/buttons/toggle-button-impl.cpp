@@ -305,6 +305,9 @@ void ToggleButton::PrepareVisual(Property::Index index, Toolkit::Visual::Base& v
 {
   bool enabled = false; // Disabled by default
 
+  // The visual replaces any visual set to the index but not created yet
+  RemovePendingVisual( index );
+
   // Unregister the visual with the given index if registered previously
   if( DevelControl::GetVisual( *this, index ) )
   {
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/control-pool/control-pool-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/type-registry.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_CONTROL_POOL" );
+#endif
+
+} // namespace
+
+ControlPool::ControlPool()
+: mPools(),
+  mIdleCallback( nullptr )
+{
+}
+
+ControlPool::~ControlPool()
+{
+  if( ( nullptr != mIdleCallback ) && Adaptor::IsAvailable() )
+  {
+    // Removes the callback from the adaptor. It's deleted by the callback manager.
+    Adaptor::Get().RemoveIdle( mIdleCallback );
+  }
+}
+
+void ControlPool::Reserve( const std::string& typeName, uint32_t budget )
+{
+  Pool* pool = FindPool( typeName );
+  if( nullptr == pool )
+  {
+    if( 0u == budget )
+    {
+      return;
+    }
+
+    TypeInfo typeInfo = TypeRegistry::Get().GetTypeInfo( typeName );
+    if( !typeInfo )
+    {
+      DALI_LOG_ERROR( "ControlPool::Reserve: The type %s is not registered\n", typeName.c_str() );
+      return;
+    }
+
+    mPools.push_back( Pool() );
+    pool = &mPools.back();
+    pool->typeName = typeName;
+    pool->typeInfo = typeInfo;
+    pool->budget = 0u;
+  }
+
+  pool->budget = budget;
+
+  if( pool->controls.size() > budget )
+  {
+    // Release the extra instances.
+    pool->controls.resize( budget );
+  }
+  else if( pool->controls.size() < budget )
+  {
+    RequestIdleCallback();
+  }
+}
+
+void ControlPool::Prewarm( const std::string& typeName, uint32_t budget )
+{
+  const Pool* pool = FindPool( typeName );
+  if( ( nullptr == pool ) || ( pool->budget < budget ) )
+  {
+    Reserve( typeName, budget );
+  }
+}
+
+Toolkit::Control ControlPool::Acquire( const std::string& typeName )
+{
+  Pool* pool = FindPool( typeName );
+  if( nullptr == pool )
+  {
+    // The type is not pooled, the control is created now.
+    TypeInfo typeInfo = TypeRegistry::Get().GetTypeInfo( typeName );
+    return typeInfo ? CreateControl( typeInfo ) : Toolkit::Control();
+  }
+
+  Toolkit::Control control;
+  if( pool->controls.empty() )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "ControlPool::Acquire: No %s ready, creating one\n", typeName.c_str() );
+    control = CreateControl( pool->typeInfo );
+  }
+  else
+  {
+    control = pool->controls.back();
+    pool->controls.pop_back();
+  }
+
+  // Refill the pool when the application is idle.
+  RequestIdleCallback();
+
+  return control;
+}
+
+uint32_t ControlPool::GetPooledCount( const std::string& typeName ) const
+{
+  for( const auto& pool : mPools )
+  {
+    if( pool.typeName == typeName )
+    {
+      return static_cast<uint32_t>( pool.controls.size() );
+    }
+  }
+
+  return 0u;
+}
+
+ControlPool::Pool* ControlPool::FindPool( const std::string& typeName )
+{
+  // There are few pooled types, a linear search is enough.
+  for( auto& pool : mPools )
+  {
+    if( pool.typeName == typeName )
+    {
+      return &pool;
+    }
+  }
+
+  return nullptr;
+}
+
+Toolkit::Control ControlPool::CreateControl( TypeInfo typeInfo ) const
+{
+  return Toolkit::Control::DownCast( typeInfo.CreateInstance() );
+}
+
+void ControlPool::RequestIdleCallback()
+{
+  if( ( nullptr == mIdleCallback ) && Adaptor::IsAvailable() )
+  {
+    // @note: The callback manager takes the ownership of the callback object.
+    mIdleCallback = MakeCallback( this, &ControlPool::OnIdle );
+    if( !Adaptor::Get().AddIdle( mIdleCallback, true ) )
+    {
+      mIdleCallback = nullptr;
+    }
+  }
+}
+
+bool ControlPool::OnIdle()
+{
+  // Create one instance per callback to not block the event thread for long.
+  for( auto& pool : mPools )
+  {
+    if( pool.controls.size() < pool.budget )
+    {
+      Toolkit::Control control = CreateControl( pool.typeInfo );
+      if( control )
+      {
+        pool.controls.push_back( control );
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "ControlPool::OnIdle: %s pooled %d/%d\n", pool.typeName.c_str(), static_cast<int>( pool.controls.size() ), pool.budget );
+      }
+      else
+      {
+        DALI_LOG_ERROR( "ControlPool: The type %s is not a control\n", pool.typeName.c_str() );
+        pool.budget = 0u;
+      }
+      break;
+    }
+  }
+
+  // Whether there are more missing instances.
+  for( const auto& pool : mPools )
+  {
+    if( pool.controls.size() < pool.budget )
+    {
+      return true;
+    }
+  }
+
+  // Set the pointer to null as the callback manager deletes the callback when it returns false.
+  mIdleCallback = nullptr;
+
+  return false;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
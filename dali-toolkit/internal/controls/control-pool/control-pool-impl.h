@@ -0,0 +1,161 @@
+#ifndef DALI_TOOLKIT_INTERNAL_CONTROL_POOL_H
+#define DALI_TOOLKIT_INTERNAL_CONTROL_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/type-info.h>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/control-pool.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @copydoc Toolkit::ControlPool
+ */
+class ControlPool : public BaseObject
+{
+public:
+
+  /**
+   * @brief Constructor
+   */
+  ControlPool();
+
+  /**
+   * @copydoc Toolkit::ControlPool::Reserve()
+   */
+  void Reserve( const std::string& typeName, uint32_t budget );
+
+  /**
+   * @brief Raises the number of instances of a control type to keep ready to at least the given budget.
+   *
+   * Used by the toolkit's controls, so they don't lower the budget set by the application.
+   *
+   * @param[in] typeName The name of the control type in the type registry.
+   * @param[in] budget The minimum number of instances to keep ready.
+   */
+  void Prewarm( const std::string& typeName, uint32_t budget );
+
+  /**
+   * @copydoc Toolkit::ControlPool::Acquire()
+   */
+  Toolkit::Control Acquire( const std::string& typeName );
+
+  /**
+   * @copydoc Toolkit::ControlPool::GetPooledCount()
+   */
+  uint32_t GetPooledCount( const std::string& typeName ) const;
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~ControlPool();
+
+private:
+
+  /**
+   * @brief The instances of a control type.
+   */
+  struct Pool
+  {
+    std::string                   typeName; ///< The name of the control type.
+    TypeInfo                      typeInfo; ///< The type used to create the instances.
+    std::vector<Toolkit::Control> controls; ///< The instances ready to be acquired.
+    uint32_t                      budget;   ///< The number of instances to keep ready.
+  };
+
+  /**
+   * @brief Finds the pool of a control type.
+   *
+   * @param[in] typeName The name of the control type.
+   * @return The pool or nullptr if no instance of the type has been reserved.
+   */
+  Pool* FindPool( const std::string& typeName );
+
+  /**
+   * @brief Creates an instance of a control type.
+   *
+   * @param[in] typeInfo The type.
+   * @return The control or an empty handle if the type is not a control.
+   */
+  Toolkit::Control CreateControl( TypeInfo typeInfo ) const;
+
+  /**
+   * @brief Adds an idle callback to create the missing instances, if it's not added yet.
+   */
+  void RequestIdleCallback();
+
+  /**
+   * @brief Creates one missing instance.
+   *
+   * @return Whether there are more missing instances, so the idle callback is called again.
+   */
+  bool OnIdle();
+
+private:
+
+  // Undefined
+  ControlPool( const ControlPool& );
+  ControlPool& operator=( const ControlPool& );
+
+private:
+
+  std::vector<Pool> mPools;        ///< The pools of the reserved control types.
+  CallbackBase*     mIdleCallback; ///< The idle callback. It's owned by the adaptor.
+};
+
+} // namespace Internal
+
+inline Internal::ControlPool& GetImplementation( Toolkit::ControlPool& pool )
+{
+  DALI_ASSERT_ALWAYS( pool && "ControlPool handle is empty" );
+
+  BaseObject& handle = pool.GetBaseObject();
+
+  return static_cast<Internal::ControlPool&>( handle );
+}
+
+inline const Internal::ControlPool& GetImplementation( const Toolkit::ControlPool& pool )
+{
+  DALI_ASSERT_ALWAYS( pool && "ControlPool handle is empty" );
+
+  const BaseObject& handle = pool.GetBaseObject();
+
+  return static_cast<const Internal::ControlPool&>( handle );
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_CONTROL_POOL_H
@@ -25,6 +25,7 @@
 #include <dali/devel-api/scripting/enum-helper.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/object/property-index-ranges.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <cstring>
 #include <limits>
@@ -36,7 +37,11 @@
 #include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/control-wrapper-impl.h>
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/styling/style-manager-impl.h>
+#include <dali-toolkit/internal/visuals/visual-batch-manager.h>
+#include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 
 namespace Dali
@@ -293,6 +298,15 @@ void SetVisualsOffScene( const RegisteredVisualContainer& container, Actor paren
   }
 }
 
+/**
+ * @brief Gets the manager drawing the visuals under the batch parents
+ */
+VisualBatchManager& GetVisualBatchManager()
+{
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+  return Toolkit::GetImplementation( factory ).GetFactoryCache().GetVisualBatchManager();
+}
+
 } // unnamed namespace
 
 
@@ -310,6 +324,7 @@ const PropertyRegistration Control::Impl::PROPERTY_12( typeRegistration, "rightF
 const PropertyRegistration Control::Impl::PROPERTY_13( typeRegistration, "upFocusableActorId",    Toolkit::DevelControl::Property::UP_FOCUSABLE_ACTOR_ID,   Property::INTEGER, &Control::Impl::SetProperty, &Control::Impl::GetProperty );
 const PropertyRegistration Control::Impl::PROPERTY_14( typeRegistration, "downFocusableActorId",  Toolkit::DevelControl::Property::DOWN_FOCUSABLE_ACTOR_ID, Property::INTEGER, &Control::Impl::SetProperty, &Control::Impl::GetProperty );
 const PropertyRegistration Control::Impl::PROPERTY_15( typeRegistration, "shadow",                Toolkit::DevelControl::Property::SHADOW,                  Property::MAP,     &Control::Impl::SetProperty, &Control::Impl::GetProperty );
+const PropertyRegistration Control::Impl::PROPERTY_16( typeRegistration, "batchParent",           Toolkit::DevelControl::Property::BATCH_PARENT,            Property::BOOLEAN, &Control::Impl::SetProperty, &Control::Impl::GetProperty );
 
 
 Control::Impl::Impl( Control& controlImpl )
@@ -338,7 +353,10 @@ Control::Impl::Impl( Control& controlImpl )
   mInputMethodContext(),
   mFlags( Control::ControlBehaviour( CONTROL_BEHAVIOUR_DEFAULT ) ),
   mIsKeyboardNavigationSupported( false ),
-  mIsKeyboardFocusGroup( false )
+  mIsKeyboardFocusGroup( false ),
+  mIsBatchParent( false ),
+  mVisualsSignatureValid( false ),
+  mVisualsSignature( 0u )
 {
 }
 
@@ -406,6 +424,8 @@ void Control::Impl::RegisterVisual( Property::Index index, Toolkit::Visual::Base
   bool visualReplaced ( false );
   Actor self = mControlImpl.Self();
 
+  DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE( "Control::Impl::RegisterVisual", self );
+
   // Set the depth index, if not set by caller this will be either the current visual depth, max depth of all visuals
   // or zero.
   int requiredDepthIndex = visual.GetDepthIndex();
@@ -506,6 +526,9 @@ void Control::Impl::RegisterVisual( Property::Index index, Toolkit::Visual::Base
     }
   }
 
+  // The registered visuals have changed, so the transitions must be resolved for the new ones
+  mVisualsSignatureValid = false;
+
   if( visual )
   {
     // Set determined depth index
@@ -548,6 +571,7 @@ void Control::Impl::UnregisterVisual( Property::Index index )
     Toolkit::GetImplementation((*iter)->visual).SetOffScene( self );
     (*iter)->visual.Reset();
     mVisuals.Erase( iter );
+    mVisualsSignatureValid = false;
   }
 
   if( FindVisual( index, mRemoveVisuals, iter ) )
@@ -728,13 +752,38 @@ void Control::Impl::AddTransitions( Dali::Animation& animation,
 {
   // Setup a Transition from TransitionData.
   const Internal::TransitionData& transitionData = Toolkit::GetImplementation( handle );
-  TransitionData::Iterator end = transitionData.End();
-  for( TransitionData::Iterator iter = transitionData.Begin() ;
-       iter != end; ++iter )
+
+  // The targets are looked up by name only the first time the transition is created for these visuals
+  const std::size_t visualsSignature = GetVisualsSignature();
+  const TransitionData::Plan* plan = transitionData.FindPlan( visualsSignature );
+  if( !plan )
   {
-    TransitionData::Animator* animator = (*iter);
+    TransitionData::Plan compiledPlan;
+    CompileTransition( transitionData, compiledPlan );
+    plan = &transitionData.AddPlan( visualsSignature, std::move( compiledPlan ) );
+  }
 
-    Toolkit::Visual::Base visual = GetVisualByName( mVisuals, animator->objectName );
+  for( const TransitionData::PlanStep& step : *plan )
+  {
+    TransitionData::Animator* animator = step.animator;
+
+    // The same signature usually means the same visuals are registered at the same positions, but a visual may have been
+    // renamed since the signature was computed, or the signatures of other visuals may collide, so the name is checked
+    Toolkit::Visual::Base visual;
+    if( step.visualPosition >= 0 && static_cast< std::size_t >( step.visualPosition ) < mVisuals.Size() )
+    {
+      visual = mVisuals[ step.visualPosition ]->visual;
+    }
+
+    if( !visual || visual.GetName() != animator->objectName )
+    {
+      visual = GetVisualByName( mVisuals, animator->objectName );
+      if( visual || step.visualPosition >= 0 )
+      {
+        // The plan is stale, the next transition recomputes the signature, which reflects the renamed visuals
+        mVisualsSignatureValid = false;
+      }
+    }
 
     if( visual )
     {
@@ -750,7 +799,7 @@ void Control::Impl::AddTransitions( Dali::Animation& animation,
                      visual.GetName().c_str(), typeInfo?typeInfo.GetName().c_str():"Unknown" );
 #endif
       Internal::Visual::Base& visualImpl = Toolkit::GetImplementation( visual );
-      visualImpl.AnimateProperty( animation, *animator );
+      visualImpl.AnimateProperty( animation, *animator, step.alphaFunction, step.timePeriod );
     }
     else
     {
@@ -759,7 +808,12 @@ void Control::Impl::AddTransitions( Dali::Animation& animation,
       Actor child = mControlImpl.Self().FindChildByName( animator->objectName );
       if( child )
       {
-        Property::Index propertyIndex = child.GetPropertyIndex( animator->propertyKey );
+        Property::Index propertyIndex = step.propertyIndex;
+        if( propertyIndex == Property::INVALID_INDEX )
+        {
+          propertyIndex = child.GetPropertyIndex( animator->propertyKey );
+        }
+
         if( propertyIndex != Property::INVALID_INDEX )
         {
           if( animator->animate == false )
@@ -783,9 +837,8 @@ void Control::Impl::AddTransitions( Dali::Animation& animation,
 
             animation.AnimateTo( Property( child, propertyIndex ),
                                  animator->targetValue,
-                                 animator->alphaFunction,
-                                 TimePeriod( animator->timePeriodDelay,
-                                             animator->timePeriodDuration ) );
+                                 step.alphaFunction,
+                                 step.timePeriod );
           }
         }
       }
@@ -793,6 +846,67 @@ void Control::Impl::AddTransitions( Dali::Animation& animation,
   }
 }
 
+void Control::Impl::CompileTransition( const Internal::TransitionData& transitionData, TransitionData::Plan& plan )
+{
+  Actor self( mControlImpl.Self() );
+
+  plan.reserve( transitionData.Count() );
+  TransitionData::Iterator end = transitionData.End();
+  for( TransitionData::Iterator iter = transitionData.Begin(); iter != end; ++iter )
+  {
+    TransitionData::Animator* animator = (*iter);
+    TransitionData::PlanStep step = { animator, -1, Property::INVALID_INDEX, animator->alphaFunction,
+                                      TimePeriod( animator->timePeriodDelay, animator->timePeriodDuration ) };
+
+    for( int position = 0, count = static_cast< int >( mVisuals.Size() ); position < count; ++position )
+    {
+      const Toolkit::Visual::Base& visual = mVisuals[ position ]->visual;
+      if( visual && visual.GetName() == animator->objectName )
+      {
+        step.visualPosition = position;
+        break;
+      }
+    }
+
+    if( step.visualPosition < 0 )
+    {
+      // The children are not part of the signature, so they are looked up whenever the transition is created
+      Actor child = self.FindChildByName( animator->objectName );
+      if( child )
+      {
+        // The children of another control with the same visuals may be of other types, which register their properties with other indices
+        Property::Index propertyIndex = child.GetPropertyIndex( animator->propertyKey );
+        if( propertyIndex >= DEFAULT_ACTOR_PROPERTY_START_INDEX && propertyIndex < DEFAULT_DERIVED_ACTOR_PROPERTY_START_INDEX )
+        {
+          step.propertyIndex = propertyIndex;
+        }
+      }
+    }
+
+    plan.push_back( step );
+  }
+}
+
+std::size_t Control::Impl::GetVisualsSignature()
+{
+  if( !mVisualsSignatureValid )
+  {
+    // Combines the index and the name of each registered visual, in the order of the container
+    std::hash< std::string > hashName;
+    std::size_t signature = mVisuals.Size();
+    for( auto&& registeredVisual : mVisuals )
+    {
+      const std::size_t visualHash = hashName( registeredVisual->visual ? registeredVisual->visual.GetName() : std::string() ) ^ static_cast< std::size_t >( registeredVisual->index );
+      signature ^= visualHash + 0x9e3779b9 + ( signature << 6 ) + ( signature >> 2 );
+    }
+
+    mVisualsSignature = signature;
+    mVisualsSignatureValid = true;
+  }
+
+  return mVisualsSignature;
+}
+
 Dali::Animation Control::Impl::CreateTransition( const Toolkit::TransitionData& transitionData )
 {
   Dali::Animation transition;
@@ -997,6 +1111,16 @@ void Control::Impl::SetProperty( BaseObject* object, Property::Index index, cons
         break;
       }
 
+      case Toolkit::DevelControl::Property::BATCH_PARENT:
+      {
+        bool batchParent = false;
+        if( value.Get( batchParent ) )
+        {
+          controlImpl.mImpl->SetBatchParent( batchParent );
+        }
+        break;
+      }
+
     }
   }
 }
@@ -1109,6 +1233,12 @@ Property::Value Control::Impl::GetProperty( BaseObject* object, Property::Index
         value = map;
         break;
       }
+
+      case Toolkit::DevelControl::Property::BATCH_PARENT:
+      {
+        value = controlImpl.mImpl->mIsBatchParent;
+        break;
+      }
     }
   }
 
@@ -1354,6 +1484,15 @@ void Control::Impl::SetSubState( const std::string& subStateName, bool withTrans
   }
 }
 
+void Control::Impl::OnSceneConnection()
+{
+  // The batch parent is added before the visuals of the control and its descendants are put on the scene
+  if( mIsBatchParent )
+  {
+    GetVisualBatchManager().AddBatchParent( mControlImpl.Self() );
+  }
+}
+
 void Control::Impl::OnSceneDisconnection()
 {
   Actor self = mControlImpl.Self();
@@ -1378,6 +1517,32 @@ void Control::Impl::OnSceneDisconnection()
   }
 
   mRemoveVisuals.Clear();
+
+  if( mIsBatchParent )
+  {
+    GetVisualBatchManager().RemoveBatchParent( self );
+  }
+}
+
+void Control::Impl::SetBatchParent( bool batchParent )
+{
+  if( mIsBatchParent != batchParent )
+  {
+    mIsBatchParent = batchParent;
+
+    Actor self = mControlImpl.Self();
+    if( self.GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) )
+    {
+      if( batchParent )
+      {
+        GetVisualBatchManager().AddBatchParent( self );
+      }
+      else
+      {
+        GetVisualBatchManager().RemoveBatchParent( self );
+      }
+    }
+  }
 }
 
 void Control::Impl::SetMargin( Extents margin )
@@ -31,6 +31,7 @@
 #include <dali-toolkit/internal/controls/tooltip/tooltip.h>
 #include <dali-toolkit/internal/builder/style.h>
 #include <dali-toolkit/internal/builder/dictionary.h>
+#include <dali-toolkit/internal/visuals/transition-data-impl.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
 
 namespace Dali
@@ -207,6 +208,27 @@ public:
    */
   Dali::Animation CreateTransition( const Toolkit::TransitionData& transitionData );
 
+  /**
+   * @brief Resolves the targets of the animators of a transition on this control.
+   *
+   * The visual targets are resolved to their position in the registered visuals, and the actor targets
+   * to the index of their property when it is a default actor property, the same for every actor.
+   * The alpha function and time period of each animator are compiled too.
+   * @param[in] transitionData The transition data
+   * @param[out] plan The resolved animators, valid for every control with the same visuals signature
+   */
+  void CompileTransition( const Internal::TransitionData& transitionData, Internal::TransitionData::Plan& plan );
+
+  /**
+   * @brief Gets the signature of the indices and names of the registered visuals.
+   *
+   * It is computed again only after a visual is registered or unregistered.
+   * @note A visual renamed after it is registered does not change the signature, and different visuals may share a signature,
+   * so AddTransitions() checks the name of each target visual and looks it up by name when it differs.
+   * @return The signature
+   */
+  std::size_t GetVisualsSignature();
+
   /**
    * @copydoc Dali::Toolkit::DevelControl::DoAction()
    */
@@ -289,11 +311,22 @@ public:
    */
   bool IsResourceReady() const;
 
+  /**
+   * @copydoc CustomActorImpl::OnSceneConnection()
+   */
+  void OnSceneConnection();
+
   /**
    * @copydoc CustomActorImpl::OnSceneDisconnection()
    */
   void OnSceneDisconnection();
 
+  /**
+   * @brief Sets whether the control draws the color and border visuals of itself and its descendants.
+   * @param[in] batchParent Whether the control is a batch parent
+   */
+  void SetBatchParent( bool batchParent );
+
   /**
    * @brief Sets the margin.
    * @param[in] margin Margin is a collections of extent ( start, end, top, bottom )
@@ -423,6 +456,9 @@ public:
   ControlBehaviour mFlags : CONTROL_BEHAVIOUR_FLAG_COUNT;    ///< Flags passed in from constructor.
   bool mIsKeyboardNavigationSupported :1;  ///< Stores whether keyboard navigation is supported by the control.
   bool mIsKeyboardFocusGroup :1;           ///< Stores whether the control is a focus group.
+  bool mIsBatchParent :1;                  ///< Stores whether the control is a batch parent.
+  bool mVisualsSignatureValid :1;          ///< Stores whether mVisualsSignature matches the registered visuals.
+  std::size_t mVisualsSignature;           ///< The signature of the registered visuals, which the transition plans are found with.
 
   RegisteredVisualContainer mRemoveVisuals;         ///< List of visuals that are being replaced by another visual once ready
 
@@ -443,6 +479,7 @@ public:
   static const PropertyRegistration PROPERTY_13;
   static const PropertyRegistration PROPERTY_14;
   static const PropertyRegistration PROPERTY_15;
+  static const PropertyRegistration PROPERTY_16;
 };
 
 
@@ -274,7 +274,8 @@ void EffectsView::OnSizeSet(const Vector3& targetSize)
   mTargetSize = Vector2(targetSize);
 
   // if we are already on stage, need to update render target sizes now to reflect the new size of this actor
-  if(mEnabled)
+  // the render targets and the filters are kept if the size did not change
+  if( mEnabled && mTargetSize != mLastSize )
   {
     if( mLastSize != Vector2::ZERO )
     {
@@ -486,10 +487,11 @@ void EffectsView::CreateRenderTasks()
   mRenderTaskForChildren.SetFrameBuffer( mFrameBufferForChildren );
   mRenderTaskForChildren.SetCameraActor(mCameraForChildren); // use camera that covers render target exactly
 
-  // Enable image filters
+  // Enable image filters, their render tasks refresh like the children render task
   const size_t numFilters( mFilters.Size() );
   for( size_t i = 0; i < numFilters; ++i )
   {
+    mFilters[i]->SetRefreshOnDemand( mRefreshOnDemand );
     mFilters[i]->Enable();
   }
 }
@@ -524,6 +526,7 @@ void EffectsView::RefreshRenderTasks()
   const size_t numFilters( mFilters.Size() );
   for( size_t i = 0; i < numFilters; ++i )
   {
+    mFilters[i]->SetRefreshOnDemand( mRefreshOnDemand );
     mFilters[i]->Refresh();
   }
 }
@@ -20,10 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <sstream>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/object/type-registry.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/object/handle-devel.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/public-api/size-negotiation/relayout-container.h>
 #include <dali/integration-api/debug.h>
@@ -157,6 +159,72 @@ const Scripting::StringEnum ALIGN_CONTENT_STRING_TABLE[] =
 };
 const unsigned int ALIGN_CONTENT_STRING_TABLE_COUNT = sizeof( ALIGN_CONTENT_STRING_TABLE ) / sizeof( ALIGN_CONTENT_STRING_TABLE[0] );
 
+/**
+ * @brief Copies a property of a flex item into the style of its node.
+ *
+ * Yoga only marks the node dirty if the style actually changes, so the next layout
+ * calculation only visits the affected part of the tree.
+ * @param[in] node The node of the flex item
+ * @param[in] index The index of the property
+ * @param[in] value The new value of the property
+ */
+void SetNodeStyle( YGNodeRef node, Property::Index index, const Property::Value& value )
+{
+  switch( index )
+  {
+    case Actor::Property::MINIMUM_SIZE:
+    {
+      Vector2 minimumSize = value.Get< Vector2 >();
+      YGNodeStyleSetMinWidth( node, minimumSize.x );
+      YGNodeStyleSetMinHeight( node, minimumSize.y );
+      break;
+    }
+    case Actor::Property::MAXIMUM_SIZE:
+    {
+      Vector2 maximumSize = value.Get< Vector2 >();
+      YGNodeStyleSetMaxWidth( node, maximumSize.x );
+      YGNodeStyleSetMaxHeight( node, maximumSize.y );
+      break;
+    }
+    case Toolkit::FlexContainer::ChildProperty::FLEX:
+    {
+      YGNodeStyleSetFlex( node, value.Get< float >() );
+      break;
+    }
+    case Toolkit::FlexContainer::ChildProperty::ALIGN_SELF:
+    {
+      Toolkit::FlexContainer::Alignment alignSelf( Toolkit::FlexContainer::ALIGN_AUTO );
+      if( value.GetType() == Property::INTEGER )
+      {
+        alignSelf = static_cast<Toolkit::FlexContainer::Alignment>( value.Get< int >() );
+      }
+      else if( value.GetType() == Property::STRING )
+      {
+        std::string alignSelfString = value.Get< std::string >();
+        Scripting::GetEnumeration< Toolkit::FlexContainer::Alignment >( alignSelfString.c_str(),
+                                                                        ALIGN_SELF_STRING_TABLE,
+                                                                        ALIGN_SELF_STRING_TABLE_COUNT,
+                                                                        alignSelf );
+      }
+      YGNodeStyleSetAlignSelf( node, static_cast<YGAlign>( alignSelf ) );
+      break;
+    }
+    case Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN:
+    {
+      Vector4 flexMargin = value.Get< Vector4 >();
+      YGNodeStyleSetMargin( node, YGEdgeLeft, flexMargin.x );
+      YGNodeStyleSetMargin( node, YGEdgeTop, flexMargin.y );
+      YGNodeStyleSetMargin( node, YGEdgeRight, flexMargin.z );
+      YGNodeStyleSetMargin( node, YGEdgeBottom, flexMargin.w );
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+}
+
 } // Unnamed namespace
 
 Toolkit::FlexContainer FlexContainer::New()
@@ -481,6 +549,25 @@ void FlexContainer::OnChildAdd( Actor& child )
   childNode.actor = child;
   childNode.node = YGNodeNew();
 
+  // Intialize the style of the child. Later changes are pushed into the node as they are set.
+  SetNodeStyle( childNode.node, Actor::Property::MINIMUM_SIZE, child.GetProperty( Actor::Property::MINIMUM_SIZE ) );
+  SetNodeStyle( childNode.node, Actor::Property::MAXIMUM_SIZE, child.GetProperty( Actor::Property::MAXIMUM_SIZE ) );
+
+  // Check child properties on the child for how to layout it.
+  // These properties should be dynamically registered to the child which
+  // would be added to FlexContainer.
+  for( auto childPropertyIndex : { Toolkit::FlexContainer::ChildProperty::FLEX,
+                                   Toolkit::FlexContainer::ChildProperty::ALIGN_SELF,
+                                   Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN } )
+  {
+    if( child.GetPropertyType( childPropertyIndex ) != Property::NONE )
+    {
+      SetNodeStyle( childNode.node, childPropertyIndex, child.GetProperty( childPropertyIndex ) );
+    }
+  }
+
+  DevelHandle::PropertySetSignal( child ).Connect( this, &FlexContainer::OnChildPropertySet );
+
   mChildrenNodes.push_back( childNode );
   YGNodeInsertChild( mRootNode.node, childNode.node, mChildrenNodes.size() - 1 );
 
@@ -493,6 +580,8 @@ void FlexContainer::OnChildRemove( Actor& child )
   {
     if( mChildrenNodes[i].actor.GetHandle() == child )
     {
+      DevelHandle::PropertySetSignal( child ).Disconnect( this, &FlexContainer::OnChildPropertySet );
+
       YGNodeRemoveChild( mRootNode.node, mChildrenNodes[i].node );
       YGNodeFree( mChildrenNodes[i].node );
 
@@ -515,11 +604,15 @@ void FlexContainer::OnRelayout( const Vector2& size, RelayoutContainer& containe
     if( child )
     {
       // Anchor actor to top left of the container
-      if( child.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
+      if( child.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() &&
+          child.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT ) != AnchorPoint::TOP_LEFT )
       {
         child.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
       }
-      child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+      if( child.GetProperty< Vector3 >( Actor::Property::PARENT_ORIGIN ) != ParentOrigin::TOP_LEFT )
+      {
+        child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+      }
 
       float negotiatedWidth = child.GetRelayoutSize(Dimension::WIDTH);
       float negotiatedHeight = child.GetRelayoutSize(Dimension::HEIGHT);
@@ -612,54 +705,8 @@ void FlexContainer::ComputeLayout()
 {
   if( mRootNode.node )
   {
-    for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
-    {
-      YGNodeRef childNode = mChildrenNodes[i].node;
-      Actor childActor = mChildrenNodes[i].actor.GetHandle();
-
-      // Intialize the style of the child.
-      YGNodeStyleSetMinWidth( childNode, childActor.GetProperty< Vector2 >( Actor::Property::MINIMUM_SIZE ).x );
-      YGNodeStyleSetMinHeight( childNode, childActor.GetProperty< Vector2 >( Actor::Property::MINIMUM_SIZE ).y );
-      YGNodeStyleSetMaxWidth( childNode, childActor.GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).x );
-      YGNodeStyleSetMaxHeight( childNode, childActor.GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).y );
-
-      // Check child properties on the child for how to layout it.
-      // These properties should be dynamically registered to the child which
-      // would be added to FlexContainer.
-
-      if( childActor.GetPropertyType( Toolkit::FlexContainer::ChildProperty::FLEX ) != Property::NONE )
-      {
-        YGNodeStyleSetFlex( childNode, childActor.GetProperty( Toolkit::FlexContainer::ChildProperty::FLEX ).Get<float>() );
-      }
-
-      Toolkit::FlexContainer::Alignment alignSelf( Toolkit::FlexContainer::ALIGN_AUTO );
-      if( childActor.GetPropertyType( Toolkit::FlexContainer::ChildProperty::ALIGN_SELF ) != Property::NONE )
-      {
-        Property::Value alignSelfPropertyValue = childActor.GetProperty( Toolkit::FlexContainer::ChildProperty::ALIGN_SELF );
-        if( alignSelfPropertyValue.GetType() == Property::INTEGER )
-        {
-          alignSelf = static_cast<Toolkit::FlexContainer::Alignment>( alignSelfPropertyValue.Get< int >() );
-        }
-        else if( alignSelfPropertyValue.GetType() == Property::STRING )
-        {
-          std::string value = alignSelfPropertyValue.Get<std::string>();
-          Scripting::GetEnumeration< Toolkit::FlexContainer::Alignment >( value.c_str(),
-                                                                          ALIGN_SELF_STRING_TABLE,
-                                                                          ALIGN_SELF_STRING_TABLE_COUNT,
-                                                                          alignSelf );
-        }
-        YGNodeStyleSetAlignSelf( childNode, static_cast<YGAlign>(alignSelf) );
-      }
-
-      if( childActor.GetPropertyType( Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN ) != Property::NONE )
-      {
-        Vector4 flexMargin = childActor.GetProperty( Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN ).Get<Vector4>();
-        YGNodeStyleSetMargin( childNode, YGEdgeLeft, flexMargin.x );
-        YGNodeStyleSetMargin( childNode, YGEdgeTop, flexMargin.y );
-        YGNodeStyleSetMargin( childNode, YGEdgeRight, flexMargin.z );
-        YGNodeStyleSetMargin( childNode, YGEdgeBottom, flexMargin.w );
-      }
-    }
+    // The style of the children is kept up to date by OnChildPropertySet(), so only the
+    // nodes marked dirty by a style change (and their ancestors) are recalculated here.
 
     // Calculate the layout
     YGDirection nodeLayoutDirection = YGDirectionInherit;
@@ -687,7 +734,8 @@ void FlexContainer::ComputeLayout()
 #if defined(FLEX_CONTAINER_DEBUG)
     YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
 #endif
-    YGNodeCalculateLayout( mRootNode.node, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).x, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).y, nodeLayoutDirection );
+    Vector2 maximumSize = Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE );
+    YGNodeCalculateLayout( mRootNode.node, maximumSize.x, maximumSize.y, nodeLayoutDirection );
 #if defined(FLEX_CONTAINER_DEBUG)
     YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
 #endif
@@ -698,14 +746,45 @@ void FlexContainer::RelayoutChildren()
 {
   ComputeLayout();
 
-  // Set size and position of children according to the layout calculation
+  // Set position of children according to the layout calculation
   for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
   {
     Dali::Actor child = mChildrenNodes[i].actor.GetHandle();
     if( child )
     {
-      child.SetProperty( Actor::Property::POSITION_X,  YGNodeLayoutGetLeft( mChildrenNodes[i].node ) );
-      child.SetProperty( Actor::Property::POSITION_Y,  YGNodeLayoutGetTop( mChildrenNodes[i].node ) );
+      // Only update the children whose position has changed, to avoid sending messages for the unchanged ones
+      Vector3 position = child.GetProperty< Vector3 >( Actor::Property::POSITION );
+      float left = YGNodeLayoutGetLeft( mChildrenNodes[i].node );
+      float top = YGNodeLayoutGetTop( mChildrenNodes[i].node );
+
+      if( !Equals( position.x, left ) )
+      {
+        child.SetProperty( Actor::Property::POSITION_X, left );
+      }
+      if( !Equals( position.y, top ) )
+      {
+        child.SetProperty( Actor::Property::POSITION_Y, top );
+      }
+    }
+  }
+}
+
+void FlexContainer::OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value )
+{
+  if( index == Actor::Property::MINIMUM_SIZE ||
+      index == Actor::Property::MAXIMUM_SIZE ||
+      index == Toolkit::FlexContainer::ChildProperty::FLEX ||
+      index == Toolkit::FlexContainer::ChildProperty::ALIGN_SELF ||
+      index == Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN )
+  {
+    for( auto&& childNode : mChildrenNodes )
+    {
+      if( childNode.actor.GetHandle() == handle )
+      {
+        SetNodeStyle( childNode.node, index, value );
+        RelayoutRequest();
+        break;
+      }
     }
   }
 }
@@ -209,10 +209,18 @@ private: // From Control
   */
   void OnLayoutDirectionChanged( Dali::Actor actor, Dali::LayoutDirection::Type type );
 
+  /**
+   * @brief Called when a property of a child is set; pushes the properties affecting the layout into the child's node.
+   * @param[in] handle The child whose property is set
+   * @param[in] index The index of the property
+   * @param[in] value The new value of the property
+   */
+  void OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value );
+
 private: // Implementation
 
   /**
-   * Calculate the layout properties of all the children
+   * Calculate the layout of the children whose style has changed since the last calculation
    */
   void ComputeLayout();
 
@@ -133,6 +133,7 @@ GaussianBlurView::GaussianBlurView()
   mDownsampledHeight( 0.0f ),
   mBlurUserImage( false ),
   mRenderOnce( false ),
+  mRefreshOnDemand( false ),
   mBackgroundColor( Color::BLACK ),
   mTargetSize(Vector2::ZERO),
   mLastSize(Vector2::ZERO),
@@ -160,6 +161,7 @@ GaussianBlurView::GaussianBlurView( const unsigned int numSamples,
   mDownsampledHeight( 0.0f ),
   mBlurUserImage( blurUserImage ),
   mRenderOnce( false ),
+  mRefreshOnDemand( false ),
   mBackgroundColor( Color::BLACK ),
   mTargetSize(Vector2::ZERO),
   mLastSize(Vector2::ZERO),
@@ -344,7 +346,8 @@ void GaussianBlurView::OnSizeSet(const Vector3& targetSize)
 
 
   // if we have already activated the blur, need to update render target sizes now to reflect the new size of this actor
-  if(mActivated)
+  // the render targets are kept if the size did not change
+  if( mActivated && mTargetSize != mLastSize )
   {
     Deactivate();
     Activate();
@@ -439,6 +442,7 @@ void GaussianBlurView::AllocateResources()
 void GaussianBlurView::CreateRenderTasks()
 {
   RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
+  const unsigned int refreshRate = ( mRenderOnce || mRefreshOnDemand ) ? RenderTask::REFRESH_ONCE : RenderTask::REFRESH_ALWAYS;
 
   if(!mBlurUserImage)
   {
@@ -452,11 +456,7 @@ void GaussianBlurView::CreateRenderTasks()
 
     mRenderChildrenTask.SetCameraActor(mRenderFullSizeCamera);
     mRenderChildrenTask.SetFrameBuffer( mRenderTargetForRenderingChildren );
-
-    if( mRenderOnce )
-    {
-      mRenderChildrenTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
-    }
+    mRenderChildrenTask.SetRefreshRate( refreshRate );
   }
 
   // perform a horizontal blur targeting the second buffer
@@ -468,10 +468,7 @@ void GaussianBlurView::CreateRenderTasks()
   mHorizBlurTask.SetClearColor( mBackgroundColor );
   mHorizBlurTask.SetCameraActor(mRenderDownsampledCamera);
   mHorizBlurTask.SetFrameBuffer( mRenderTarget2 );
-  if( mRenderOnce || ( mRenderOnce && mBlurUserImage ) )
-  {
-    mHorizBlurTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
-  }
+  mHorizBlurTask.SetRefreshRate( refreshRate );
 
   // use the second buffer and perform a horizontal blur targeting the first buffer
   mVertBlurTask = taskList.CreateTask();
@@ -489,11 +486,9 @@ void GaussianBlurView::CreateRenderTasks()
   {
     mVertBlurTask.SetFrameBuffer( mRenderTarget1 );
   }
-  if( mRenderOnce || ( mRenderOnce && mBlurUserImage ) )
-  {
-    mVertBlurTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
-    mVertBlurTask.FinishedSignal().Connect( this, &GaussianBlurView::OnRenderTaskFinished );
-  }
+  // the finished signal is only emitted by the tasks refreshing once
+  mVertBlurTask.SetRefreshRate( refreshRate );
+  mVertBlurTask.FinishedSignal().Connect( this, &GaussianBlurView::OnRenderTaskFinished );
 
   // use the completed blur in the first buffer and composite with the original child actors render
   if(!mBlurUserImage)
@@ -505,11 +500,7 @@ void GaussianBlurView::CreateRenderTasks()
 
     mCompositeTask.SetCameraActor(mRenderFullSizeCamera);
     mCompositeTask.SetFrameBuffer( mRenderTargetForRenderingChildren );
-
-    if( mRenderOnce )
-    {
-      mCompositeTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
-    }
+    mCompositeTask.SetRefreshRate( refreshRate );
   }
 }
 
@@ -523,6 +514,25 @@ void GaussianBlurView::RemoveRenderTasks()
   taskList.RemoveTask(mCompositeTask);
 }
 
+void GaussianBlurView::RefreshRenderTasks()
+{
+  if( mActivated )
+  {
+    const unsigned int refreshRate = ( mRenderOnce || mRefreshOnDemand ) ? RenderTask::REFRESH_ONCE : RenderTask::REFRESH_ALWAYS;
+
+    if( mRenderChildrenTask )
+    {
+      mRenderChildrenTask.SetRefreshRate( refreshRate );
+    }
+    mHorizBlurTask.SetRefreshRate( refreshRate );
+    mVertBlurTask.SetRefreshRate( refreshRate );
+    if( mCompositeTask )
+    {
+      mCompositeTask.SetRefreshRate( refreshRate );
+    }
+  }
+}
+
 void GaussianBlurView::Activate()
 {
   if( !mActivated )
@@ -558,6 +568,18 @@ void GaussianBlurView::Deactivate()
   }
 }
 
+void GaussianBlurView::Refresh()
+{
+  RefreshRenderTasks();
+}
+
+void GaussianBlurView::SetRefreshOnDemand( bool onDemand )
+{
+  mRefreshOnDemand = onDemand;
+
+  RefreshRenderTasks();
+}
+
 void GaussianBlurView::SetBlurBellCurveWidth(float blurBellCurveWidth)
 {
   // a value of zero leads to undefined Gaussian weights, do not allow user to do this
@@ -75,6 +75,12 @@ public:
   void ActivateOnce();
   void Deactivate();
 
+  /// @copydoc Dali::Toolkit::GaussianBlurView::Refresh
+  void Refresh();
+
+  /// @copydoc Dali::Toolkit::GaussianBlurView::SetRefreshOnDemand
+  void SetRefreshOnDemand( bool onDemand );
+
   void SetUserImageAndOutputRenderTarget(Texture inputImage, FrameBuffer outputRenderTarget);
 
   Property::Index GetBlurStrengthPropertyIndex() const {return mBlurStrengthPropertyIndex;}
@@ -89,6 +95,12 @@ public:
   void AllocateResources();
   void CreateRenderTasks();
   void RemoveRenderTasks();
+
+  /**
+   * Set the refresh rate of the render tasks, rendering them once more if they refresh on demand
+   */
+  void RefreshRenderTasks();
+
   Dali::Toolkit::GaussianBlurView::GaussianBlurViewSignal& FinishedSignal();
 
 private:
@@ -134,6 +146,10 @@ private:
   // if this is set to true, set the render tasks to refresh once
   bool mRenderOnce:1;
 
+  /////////////////////////////////////////////////////////////
+  // if this is set to true, the render tasks refresh once each time Refresh() is called
+  bool mRefreshOnDemand:1;
+
   /////////////////////////////////////////////////////////////
   // background fill color
   Vector4 mBackgroundColor;
@@ -20,9 +20,14 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cmath>
 #include <string>
-#include <sstream>
 #include <string.h>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/parallel-for.h>
 
 namespace Dali
 {
@@ -36,6 +41,200 @@ namespace Internal
 namespace
 {
   const int MAX_POINT_INDICES = 4;
+
+  // The minimum number of faces or points worth a thread when they are processed in parallel
+  const uint32_t MINIMUM_ITEMS_PER_THREAD = 8192u;
+
+  const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+  const int MAX_TABLE_EXPONENT = 22;
+
+  inline bool IsSpace( char character )
+  {
+    return ( character == ' ' ) || ( character == '\t' ) || ( character == '\r' ) || ( character == '\f' ) || ( character == '\v' );
+  }
+
+  inline bool IsDigit( char character )
+  {
+    return ( character >= '0' ) && ( character <= '9' );
+  }
+
+  inline void SkipSpaces( const char*& position, const char* lineEnd )
+  {
+    while( ( position < lineEnd ) && IsSpace( *position ) )
+    {
+      ++position;
+    }
+  }
+
+  /**
+   * @brief Finds the end of the line starting at the given position.
+   * @return The position of the new line character, or the end of the buffer.
+   */
+  inline const char* FindLineEnd( const char* position, const char* bufferEnd )
+  {
+    const char* lineEnd = static_cast<const char*>( memchr( position, '\n', bufferEnd - position ) );
+    return lineEnd ? lineEnd : bufferEnd;
+  }
+
+  /**
+   * @brief Reads the next whitespace separated token of the line without copying it.
+   * @param[in,out] position The position in the line, moved after the token.
+   * @param[in] lineEnd The end of the line.
+   * @param[out] token The start of the token.
+   * @return The length of the token, zero at the end of the line.
+   */
+  inline std::size_t ReadToken( const char*& position, const char* lineEnd, const char*& token )
+  {
+    SkipSpaces( position, lineEnd );
+    token = position;
+    while( ( position < lineEnd ) && !IsSpace( *position ) )
+    {
+      ++position;
+    }
+    return position - token;
+  }
+
+  inline bool TokenEquals( const char* token, std::size_t length, const char* tag )
+  {
+    return ( strlen( tag ) == length ) && ( strncmp( token, tag, length ) == 0 );
+  }
+
+  /**
+   * @brief Reads an integer, with an optional sign, independently of the locale.
+   * @return The integer, or zero if there is none at the position.
+   */
+  int ReadInteger( const char*& position, const char* lineEnd )
+  {
+    bool negative = false;
+    if( ( position < lineEnd ) && ( ( *position == '-' ) || ( *position == '+' ) ) )
+    {
+      negative = ( *position == '-' );
+      ++position;
+    }
+
+    int value = 0;
+    while( ( position < lineEnd ) && IsDigit( *position ) )
+    {
+      value = value * 10 + ( *position - '0' );
+      ++position;
+    }
+    return negative ? -value : value;
+  }
+
+  /**
+   * @brief Reads a floating point number in the "C" locale format, e.g. -1.25e-3, skipping the leading spaces.
+   * @return The number, or zero if there is none at the position.
+   */
+  float ReadFloat( const char*& position, const char* lineEnd )
+  {
+    SkipSpaces( position, lineEnd );
+
+    bool negative = false;
+    if( ( position < lineEnd ) && ( ( *position == '-' ) || ( *position == '+' ) ) )
+    {
+      negative = ( *position == '-' );
+      ++position;
+    }
+
+    // Accumulate up to 19 significant digits, the following ones only move the decimal point
+    uint64_t mantissa = 0u;
+    int significantDigits = 0;
+    int exponent = 0;
+    while( ( position < lineEnd ) && IsDigit( *position ) )
+    {
+      if( significantDigits < 19 )
+      {
+        mantissa = mantissa * 10u + static_cast<uint64_t>( *position - '0' );
+        significantDigits += ( mantissa != 0u ) ? 1 : 0;
+      }
+      else
+      {
+        ++exponent;
+      }
+      ++position;
+    }
+
+    if( ( position < lineEnd ) && ( *position == '.' ) )
+    {
+      ++position;
+      while( ( position < lineEnd ) && IsDigit( *position ) )
+      {
+        if( significantDigits < 19 )
+        {
+          mantissa = mantissa * 10u + static_cast<uint64_t>( *position - '0' );
+          significantDigits += ( mantissa != 0u ) ? 1 : 0;
+          --exponent;
+        }
+        ++position;
+      }
+    }
+
+    if( ( position < lineEnd ) && ( ( *position == 'e' ) || ( *position == 'E' ) ) )
+    {
+      ++position;
+      exponent += ReadInteger( position, lineEnd );
+    }
+
+    double value = static_cast<double>( mantissa );
+    if( mantissa != 0u )
+    {
+      if( exponent < 0 )
+      {
+        value = ( exponent >= -MAX_TABLE_EXPONENT ) ? value / POWERS_OF_TEN[-exponent] : value * std::pow( 10.0, exponent );
+      }
+      else if( exponent > 0 )
+      {
+        value = ( exponent <= MAX_TABLE_EXPONENT ) ? value * POWERS_OF_TEN[exponent] : value * std::pow( 10.0, exponent );
+      }
+    }
+
+    return static_cast<float>( negative ? -value : value );
+  }
+
+  inline void ReadVector3( const char*& position, const char* lineEnd, Vector3& vector )
+  {
+    vector.x = ReadFloat( position, lineEnd );
+    vector.y = ReadFloat( position, lineEnd );
+    vector.z = ReadFloat( position, lineEnd );
+  }
+
+  inline void ReadVector2( const char*& position, const char* lineEnd, Vector2& vector )
+  {
+    vector.x = ReadFloat( position, lineEnd );
+    vector.y = ReadFloat( position, lineEnd );
+  }
+
+  /**
+   * @brief Counts the points, normals, texture coordinates and faces in the file to reserve the arrays.
+   *
+   * Quads are counted as one face, so the triangles array may still grow.
+   */
+  void CountElements( const char* position, const char* bufferEnd,
+                      uint32_t& numPoints, uint32_t& numNormals, uint32_t& numTextures, uint32_t& numFaces )
+  {
+    while( position < bufferEnd )
+    {
+      const char* lineEnd = FindLineEnd( position, bufferEnd );
+      SkipSpaces( position, lineEnd );
+      if( lineEnd - position > 1 )
+      {
+        const char first = position[0];
+        const char second = position[1];
+        if( first == 'v' )
+        {
+          numPoints += IsSpace( second ) ? 1u : 0u;
+          numNormals += ( second == 'n' ) ? 1u : 0u;
+          numTextures += ( second == 't' ) ? 1u : 0u;
+        }
+        else if( first == 'f' )
+        {
+          numFaces += IsSpace( second ) ? 1u : 0u;
+        }
+      }
+      position = lineEnd + 1;
+    }
+  }
 }
 using namespace Dali;
 
@@ -69,73 +268,87 @@ void ObjLoader::CalculateHardFaceNormals( const Dali::Vector<Vector3>& vertices,
                                           Dali::Vector<Vector3>& normals )
 {
   int numFaceVertices = 3 * triangles.Size();  //Vertex per face, as each point has different normals for each face.
-  int normalIndex = 0;  //Tracks progress through the array of normals.
 
   normals.Clear();
   normals.Resize( numFaceVertices );
 
   //For each triangle, calculate the normal by crossing two vectors on the triangle's plane.
-  for( unsigned long i = 0; i < triangles.Size(); i++ )
+  //The triangles only write their own normals, so they are processed in parallel.
+  ParallelFor( triangles.Size(), MINIMUM_ITEMS_PER_THREAD, [&]( uint32_t first, uint32_t last )
   {
-    //Triangle vertices.
-    const Vector3& v0 = vertices[triangles[i].pointIndex[0]];
-    const Vector3& v1 = vertices[triangles[i].pointIndex[1]];
-    const Vector3& v2 = vertices[triangles[i].pointIndex[2]];
+    for( uint32_t i = first; i < last; i++ )
+    {
+      //Triangle vertices.
+      const Vector3& v0 = vertices[triangles[i].pointIndex[0]];
+      const Vector3& v1 = vertices[triangles[i].pointIndex[1]];
+      const Vector3& v2 = vertices[triangles[i].pointIndex[2]];
 
-    //Triangle edges.
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+      //Triangle edges.
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    //Using edges as vectors on the plane, cross to get the normal.
-    Vector3 normalVector = edge1.Cross(edge2);
-    normalVector.Normalize();
+      //Using edges as vectors on the plane, cross to get the normal.
+      Vector3 normalVector = edge1.Cross(edge2);
+      normalVector.Normalize();
 
-    //Assign normals to points.
-    for( unsigned long j = 0; j < 3; j++, normalIndex++ )
-    {
-      triangles[i].normalIndex[j] = normalIndex;
-      normals[normalIndex] = normalVector;
+      //Assign normals to points.
+      for( uint32_t j = 0, normalIndex = 3 * i; j < 3; j++, normalIndex++ )
+      {
+        triangles[i].normalIndex[j] = normalIndex;
+        normals[normalIndex] = normalVector;
+      }
     }
-  }
+  } );
 }
 
 void ObjLoader::CalculateSoftFaceNormals( const Dali::Vector<Vector3>& vertices, Dali::Vector<TriIndex>& triangles,
                                           Dali::Vector<Vector3>& normals )
 {
-  int normalIndex = 0;  //Tracks progress through the array of normals.
-
   normals.Clear();
   normals.Resize( vertices.Size() );  //One (averaged) normal per point.
 
-  //For each triangle, calculate the normal by crossing two vectors on the triangle's plane
-  //We then add the triangle's normal to the cumulative normals at each point of it
-  for( unsigned long i = 0; i < triangles.Size(); i++ )
+  //For each triangle, calculate the normal by crossing two vectors on the triangle's plane.
+  //The triangles are processed in parallel, each one only writing its own normal.
+  Dali::Vector<Vector3> faceNormals;
+  faceNormals.Resize( triangles.Size() );
+  ParallelFor( triangles.Size(), MINIMUM_ITEMS_PER_THREAD, [&]( uint32_t first, uint32_t last )
   {
-    //Triangle vertices.
-    const Vector3& v0 = vertices[triangles[i].pointIndex[0]];
-    const Vector3& v1 = vertices[triangles[i].pointIndex[1]];
-    const Vector3& v2 = vertices[triangles[i].pointIndex[2]];
+    for( uint32_t i = first; i < last; i++ )
+    {
+      //Triangle vertices.
+      const Vector3& v0 = vertices[triangles[i].pointIndex[0]];
+      const Vector3& v1 = vertices[triangles[i].pointIndex[1]];
+      const Vector3& v2 = vertices[triangles[i].pointIndex[2]];
 
-    //Triangle edges.
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+      //Triangle edges.
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    //Using edges as vectors on the plane, cross to get the normal.
-    Vector3 normalVector = edge1.Cross(edge2);
+      //Using edges as vectors on the plane, cross to get the normal.
+      faceNormals[i] = edge1.Cross(edge2);
+    }
+  } );
 
+  //We then add the triangle's normal to the cumulative normals at each point of it.
+  //The points are shared between triangles, so this is done in order, in a single thread.
+  for( uint32_t i = 0; i < triangles.Size(); i++ )
+  {
     //Add this triangle's normal to the cumulative normal of each constituent point and set the index of the normal accordingly.
-    for( unsigned long j = 0; j < 3; j++, normalIndex++ )
+    for( uint32_t j = 0; j < 3; j++ )
     {
       triangles[i].normalIndex[j] = triangles[i].pointIndex[j]; //Normal index matches up to vertex index, as one normal per vertex.
-      normals[triangles[i].normalIndex[j]] += normalVector;
+      normals[triangles[i].normalIndex[j]] += faceNormals[i];
     }
   }
 
   //Normalise the normals.
-  for( unsigned long i = 0; i < normals.Size(); i++ )
+  ParallelFor( normals.Size(), MINIMUM_ITEMS_PER_THREAD, [&]( uint32_t first, uint32_t last )
   {
-    normals[i].Normalize();
-  }
+    for( uint32_t i = first; i < last; i++ )
+    {
+      normals[i].Normalize();
+    }
+  } );
 }
 
 //TODO: Use a function that can generate more than one normal/tangent per vertex (using angle)
@@ -147,50 +360,64 @@ void ObjLoader::CalculateTangentFrame()
   mTangents.Resize( mPoints.Size() );
   mBiTangents.Resize( mPoints.Size() );
 
-  //For each triangle, calculate the tangent vector and then add it to the total tangent vector of each point.
-  for ( unsigned long a = 0; a < mTriangles.Size(); a++ )
+  //For each triangle, calculate the tangent vector. The triangles are processed in parallel.
+  Dali::Vector<Vector3> faceTangents;
+  faceTangents.Resize( mTriangles.Size() );
+  ParallelFor( mTriangles.Size(), MINIMUM_ITEMS_PER_THREAD, [&]( uint32_t first, uint32_t last )
   {
-    Vector3 tangentVector;
+    for ( uint32_t a = first; a < last; a++ )
+    {
+      Vector3 tangentVector;
 
-    const Vector3& v0 = mPoints[mTriangles[a].pointIndex[0]];
-    const Vector3& v1 = mPoints[mTriangles[a].pointIndex[1]];
-    const Vector3& v2 = mPoints[mTriangles[a].pointIndex[2]];
+      const Vector3& v0 = mPoints[mTriangles[a].pointIndex[0]];
+      const Vector3& v1 = mPoints[mTriangles[a].pointIndex[1]];
+      const Vector3& v2 = mPoints[mTriangles[a].pointIndex[2]];
 
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    const Vector2& w0 = mTextures[mTriangles[a].textureIndex[0]];
-    const Vector2& w1 = mTextures[mTriangles[a].textureIndex[1]];
-    const Vector2& w2 = mTextures[mTriangles[a].textureIndex[2]];
+      const Vector2& w0 = mTextures[mTriangles[a].textureIndex[0]];
+      const Vector2& w1 = mTextures[mTriangles[a].textureIndex[1]];
+      const Vector2& w2 = mTextures[mTriangles[a].textureIndex[2]];
 
-    float deltaU1 = w1.x - w0.x;
-    float deltaV1 = w1.y - w0.y;
-    float deltaU2 = w2.x - w0.x;
-    float deltaV2 = w2.y - w0.y;
+      float deltaU1 = w1.x - w0.x;
+      float deltaV1 = w1.y - w0.y;
+      float deltaU2 = w2.x - w0.x;
+      float deltaV2 = w2.y - w0.y;
 
-    float f = 1.0f / (deltaU1 * deltaV2 - deltaU2 * deltaV1);
+      float f = 1.0f / (deltaU1 * deltaV2 - deltaU2 * deltaV1);
 
-    tangentVector.x = f * ( deltaV2 * edge1.x - deltaV1 * edge2.x );
-    tangentVector.y = f * ( deltaV2 * edge1.y - deltaV1 * edge2.y );
-    tangentVector.z = f * ( deltaV2 * edge1.z - deltaV1 * edge2.z );
+      tangentVector.x = f * ( deltaV2 * edge1.x - deltaV1 * edge2.x );
+      tangentVector.y = f * ( deltaV2 * edge1.y - deltaV1 * edge2.y );
+      tangentVector.z = f * ( deltaV2 * edge1.z - deltaV1 * edge2.z );
 
-    mTangents[mTriangles[a].pointIndex[0]] += tangentVector;
-    mTangents[mTriangles[a].pointIndex[1]] += tangentVector;
-    mTangents[mTriangles[a].pointIndex[2]] += tangentVector;
+      faceTangents[a] = tangentVector;
+    }
+  } );
+
+  //Then add it to the total tangent vector of each point, in order as the points are shared between triangles.
+  for ( uint32_t a = 0; a < mTriangles.Size(); a++ )
+  {
+    mTangents[mTriangles[a].pointIndex[0]] += faceTangents[a];
+    mTangents[mTriangles[a].pointIndex[1]] += faceTangents[a];
+    mTangents[mTriangles[a].pointIndex[2]] += faceTangents[a];
   }
 
   //Orthogonalize tangents and set binormals.
-  for ( unsigned long a = 0; a < mTangents.Size(); a++ )
+  ParallelFor( mTangents.Size(), MINIMUM_ITEMS_PER_THREAD, [&]( uint32_t first, uint32_t last )
   {
-    const Vector3& n = mNormals[a];
-    const Vector3& t = mTangents[a];
+    for ( uint32_t a = first; a < last; a++ )
+    {
+      const Vector3& n = mNormals[a];
+      const Vector3& t = mTangents[a];
 
-    // Gram-Schmidt orthogonalize
-    mTangents[a] = t - n * n.Dot(t);
-    mTangents[a].Normalize();
+      // Gram-Schmidt orthogonalize
+      mTangents[a] = t - n * n.Dot(t);
+      mTangents[a].Normalize();
 
-    mBiTangents[a] = mNormals[a].Cross( mTangents[a] );
-  }
+      mBiTangents[a] = mNormals[a].Cross( mTangents[a] );
+    }
+  } );
 }
 
 void ObjLoader::CenterAndScale( bool center, Dali::Vector<Vector3>& points )
@@ -349,7 +576,6 @@ bool ObjLoader::LoadObject( char* objBuffer, std::streampos fileSize )
 {
   Vector3 point;
   Vector2 texture;
-  std::string vet[MAX_POINT_INDICES], name;
   int ptIdx[MAX_POINT_INDICES];
   int nrmIdx[MAX_POINT_INDICES];
   int texIdx[MAX_POINT_INDICES];
@@ -362,77 +588,68 @@ bool ObjLoader::LoadObject( char* objBuffer, std::streampos fileSize )
   //Init AABB for the file
   mSceneAABB.Init();
 
-  std::string strMatActual;
-
-  std::string input( objBuffer, fileSize );
-  std::istringstream ss(input);
-  ss.imbue( std::locale( "C" ) );
+  const char* const bufferEnd = objBuffer + static_cast<std::size_t>( fileSize );
 
+  //Reserve the arrays up front rather than growing them line by line.
+  uint32_t numPoints = 0, numNormals = 0, numTextures = 0, numFaces = 0;
+  CountElements( objBuffer, bufferEnd, numPoints, numNormals, numTextures, numFaces );
+  mPoints.Reserve( mPoints.Count() + numPoints );
+  mNormals.Reserve( mNormals.Count() + numNormals );
+  mTextures.Reserve( mTextures.Count() + numTextures );
+  mTriangles.Reserve( mTriangles.Count() + numFaces );
 
-  std::string line;
-  std::getline( ss, line );
+  //The first line is ignored.
+  const char* lineEnd = FindLineEnd( objBuffer, bufferEnd );
 
-  while ( std::getline( ss, line ) )
+  while( lineEnd < bufferEnd )
   {
-    std::istringstream isline( line, std::istringstream::in );
-    std::string tag;
+    const char* line = lineEnd + 1;
+    lineEnd = FindLineEnd( line, bufferEnd );
 
-    isline >> tag;
+    const char* tag;
+    std::size_t tagLength = ReadToken( line, lineEnd, tag );
 
-    if ( tag == "v" )
+    if ( TokenEquals( tag, tagLength, "v" ) )
     {
       //Two different objects in the same file
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      ReadVector3( line, lineEnd, point );
       mPoints.PushBack( point );
 
       mSceneAABB.ConsiderNewPointInVolume( point );
     }
-    else if ( tag == "vn" )
+    else if ( TokenEquals( tag, tagLength, "vn" ) )
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      ReadVector3( line, lineEnd, point );
 
       mNormals.PushBack( point );
     }
-    else if ( tag == "#_#tangent" )
+    else if ( TokenEquals( tag, tagLength, "#_#tangent" ) )
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      ReadVector3( line, lineEnd, point );
 
       mTangents.PushBack( point );
     }
-    else if ( tag == "#_#binormal" )
+    else if ( TokenEquals( tag, tagLength, "#_#binormal" ) )
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      ReadVector3( line, lineEnd, point );
 
       mBiTangents.PushBack( point );
     }
-    else if ( tag == "vt" )
+    else if ( TokenEquals( tag, tagLength, "vt" ) )
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      ReadVector2( line, lineEnd, texture );
 
       texture.y = 1.0-texture.y;
       mTextures.PushBack( texture );
     }
-    else if ( tag == "#_#vt1" )
+    else if ( TokenEquals( tag, tagLength, "#_#vt1" ) )
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      ReadVector2( line, lineEnd, texture );
 
       texture.y = 1.0-texture.y;
       mTextures2.PushBack( texture );
     }
-    else if ( tag == "s" )
-    {
-    }
-    else if ( tag == "f" )
+    else if ( TokenEquals( tag, tagLength, "f" ) )
     {
       if ( !iniObj )
       {
@@ -441,62 +658,49 @@ bool ObjLoader::LoadObject( char* objBuffer, std::streampos fileSize )
         iniObj = true;
       }
 
+      //Each point is of the form A, A/B, A//C or A/B/C, as in, point, texture and normal indices.
+      //Missing texture and normal indices are read as zero.
       int numIndices = 0;
-      while( ( numIndices < MAX_POINT_INDICES ) && ( isline >> vet[numIndices] ) )
-      {
-        numIndices++;
-      }
-
-      //Hold slashes that separate attributes of the same point.
-      char separator;
-      char separator2;
-
-      const char * subString; //A pointer to the position in the string as we move through it.
-
-      subString = strstr( vet[0].c_str(),"/" ); //Search for the first '/'
-
-      if( subString )
+      while( numIndices < MAX_POINT_INDICES )
       {
-        if( subString[1] == '/' ) // Of the form A//C, so has points and normals but no texture coordinates.
+        SkipSpaces( line, lineEnd );
+        if( line == lineEnd )
         {
-          for( int i = 0 ; i < numIndices; i++)
-          {
-            std::istringstream isindex( vet[i] );
-            isindex >> ptIdx[i] >> separator >> separator2 >> nrmIdx[i];
-            texIdx[i] = 0;
-          }
+          break;
         }
-        else if( strstr( subString, "/" ) ) // Of the form A/B/C, so has points, textures and normals.
+
+        ptIdx[numIndices] = ReadInteger( line, lineEnd );
+        texIdx[numIndices] = 0;
+        nrmIdx[numIndices] = 0;
+
+        if( ( line < lineEnd ) && ( *line == '/' ) )
         {
-          for( int i = 0 ; i < numIndices; i++ )
+          ++line;
+          if( ( line < lineEnd ) && ( *line != '/' ) )
           {
-            std::istringstream isindex( vet[i] );
-            isindex >> ptIdx[i] >> separator >> texIdx[i] >> separator2 >> nrmIdx[i];
+            texIdx[numIndices] = ReadInteger( line, lineEnd );
+
+            //The first point decides whether the object has texture coordinates.
+            if( numIndices == 0 )
+            {
+              hasTexture = true;
+            }
           }
 
-          hasTexture = true;
-        }
-        else // Of the form A/B, so has points and textures but no normals.
-        {
-          for( int i = 0 ; i < numIndices; i++ )
+          if( ( line < lineEnd ) && ( *line == '/' ) )
           {
-            std::istringstream isindex( vet[i] );
-            isindex >> ptIdx[i] >> separator >> texIdx[i];
-            nrmIdx[i] = 0;
+            ++line;
+            nrmIdx[numIndices] = ReadInteger( line, lineEnd );
           }
-
-          hasTexture = true;
         }
-      }
-      else // Simply of the form A, as in, point indices only.
-      {
-        for( int i = 0 ; i < numIndices; i++ )
+
+        //Skip what is left of the point.
+        while( ( line < lineEnd ) && !IsSpace( *line ) )
         {
-          std::istringstream isindex( vet[i] );
-          isindex >> ptIdx[i];
-          texIdx[i] = 0;
-          nrmIdx[i] = 0;
+          ++line;
         }
+
+        numIndices++;
       }
 
       //If it is a triangle
@@ -534,18 +738,6 @@ bool ObjLoader::LoadObject( char* objBuffer, std::streampos fileSize )
         face++;
       }
     }
-    else if ( tag == "usemtl" )
-    {
-      isline >> strMatActual;
-    }
-    else if ( tag == "mtllib" )
-    {
-      isline >> strMatActual;
-    }
-    else if ( tag == "g" )
-    {
-      isline >> name;
-    }
   }
 
   if ( iniObj )
@@ -562,62 +754,39 @@ bool ObjLoader::LoadObject( char* objBuffer, std::streampos fileSize )
 void ObjLoader::LoadMaterial( char* objBuffer, std::streampos fileSize, std::string& diffuseTextureUrl,
                               std::string& normalTextureUrl, std::string& glossTextureUrl )
 {
-  float fR,fG,fB;
-
-  std::string info;
+  const char* const bufferEnd = objBuffer + static_cast<std::size_t>( fileSize );
 
-  std::string input( objBuffer, fileSize );
-  std::istringstream ss(input);
-  ss.imbue(std::locale("C"));
+  //The first line is ignored.
+  const char* lineEnd = FindLineEnd( objBuffer, bufferEnd );
 
-  std::string line;
-  std::getline( ss, line );
-
-  while ( std::getline( ss, line ) )
+  while( lineEnd < bufferEnd )
   {
-    std::istringstream isline( line, std::istringstream::in );
-    std::string tag;
+    const char* line = lineEnd + 1;
+    lineEnd = FindLineEnd( line, bufferEnd );
 
-    isline >> tag;
+    const char* tag;
+    std::size_t tagLength = ReadToken( line, lineEnd, tag );
 
-    if ( tag == "newmtl" )  //name of the material
-    {
-      isline >> info;
-    }
-    else if ( tag == "Ka" ) //ambient color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if ( tag == "Kd" ) //diffuse color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if ( tag == "Ks" ) //specular color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if ( tag == "Tf" ) //color
-    {
-    }
-    else if ( tag == "Ni" )
-    {
-    }
-    else if ( tag == "map_Kd" )
+    //Only the texture maps are used, the colors are ignored.
+    if ( TokenEquals( tag, tagLength, "map_Kd" ) )
     {
-      isline >> info;
-      diffuseTextureUrl = info;
+      const char* info;
+      std::size_t infoLength = ReadToken( line, lineEnd, info );
+      diffuseTextureUrl.assign( info, infoLength );
       mHasDiffuseMap = true;
     }
-    else if ( tag == "bump" )
+    else if ( TokenEquals( tag, tagLength, "bump" ) )
     {
-      isline >> info;
-      normalTextureUrl = info;
+      const char* info;
+      std::size_t infoLength = ReadToken( line, lineEnd, info );
+      normalTextureUrl.assign( info, infoLength );
       mHasNormalMap = true;
     }
-    else if ( tag == "map_Ks" )
+    else if ( TokenEquals( tag, tagLength, "map_Ks" ) )
     {
-      isline >> info;
-      glossTextureUrl = info;
+      const char* info;
+      std::size_t infoLength = ReadToken( line, lineEnd, info );
+      glossTextureUrl.assign( info, infoLength );
       mHasSpecularMap = true;
     }
   }
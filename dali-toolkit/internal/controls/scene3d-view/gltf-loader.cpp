@@ -20,9 +20,14 @@
 #include <dali-toolkit/internal/controls/scene3d-view/gltf-shader.h>
 
 // EXTERNAL INCLUDES
+#include <cstring>
+#include <functional>
 #include <dali/integration-api/debug.h>
+#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
-#include <dali/devel-api/adaptor-framework/file-stream.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/parallel-for.h>
 
 namespace Dali
 {
@@ -234,31 +239,26 @@ void FitBuffer( Dali::Vector<Vector4>& bufferDestination, Dali::Vector<T>& buffe
 
 // Template functions
 template <typename T>
-bool ReadBinFile( Vector<T> &dataBuffer, std::string url, int32_t offset, int32_t count )
+bool ReadBinaryData( Vector<T> &dataBuffer, const Dali::Vector<char>& binaryData, int32_t offset, int32_t count )
 {
-  Dali::FileStream fileStream( url, FileStream::READ | FileStream::BINARY );
-  FILE* fp = fileStream.GetFile();
-  if( !fp )
-  {
-    return false;
-  }
-
   dataBuffer.Resize( count );
-  ssize_t result = -1;
-  if( !fseek( fp, offset, SEEK_SET ) )
+  if( count <= 0 || offset < 0 || static_cast<size_t>( offset ) >= binaryData.Count() )
   {
-    result = fread( &dataBuffer[0], sizeof( T ), count, fp );
+    return false;
   }
 
-  return ( result >= 0 );
+  // Copy as much as the buffer file holds, as reading the file did.
+  const size_t byteSize = std::min( sizeof( T ) * count, binaryData.Count() - offset );
+  memcpy( &dataBuffer[0], &binaryData[offset], byteSize );
+  return true;
 }
 
 template <typename T>
-void LoadDataFromAccessor( int32_t accessorIdx, Dali::Vector<T>& bufferData, std::string path, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray )
+void LoadDataFromAccessor( int32_t accessorIdx, Dali::Vector<T>& bufferData, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray )
 {
   AccessorInfo accessor = accessorArray[accessorIdx];
   BufferViewInfo bufferView = bufferViewArray[accessor.bufferView];
-  std::string load_uri = bufferArray[bufferView.buffer].uri;
+  const Dali::Vector<char>& binaryData = bufferArray[bufferView.buffer].data;
 
   // In the glTF 2.0 Specification, 5121 is UNSIGNED BYTE, 5123 is UNSIGNED SHORT
   int32_t elementByteSize = ( accessor.componentType <= 5121 ) ? 1 :
@@ -307,37 +307,37 @@ void LoadDataFromAccessor( int32_t accessorIdx, Dali::Vector<T>& bufferData, std
   if( accessor.componentType == 5120 )
   {
     Dali::Vector<int8_t> inputBufferData;
-    ReadBinFile<int8_t>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<int8_t>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
   else if( accessor.componentType == 5121 )
   {
     Dali::Vector<uint8_t> inputBufferData;
-    ReadBinFile<uint8_t>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<uint8_t>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
   else if( accessor.componentType == 5122 )
   {
     Dali::Vector<int16_t> inputBufferData;
-    ReadBinFile<int16_t>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<int16_t>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
   else if( accessor.componentType == 5123 )
   {
     Dali::Vector<uint16_t> inputBufferData;
-    ReadBinFile<uint16_t>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<uint16_t>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
   else if( accessor.componentType == 5125 )
   {
     Dali::Vector<uint32_t> inputBufferData;
-    ReadBinFile<uint32_t>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<uint32_t>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
   else if( accessor.componentType == 5126 )
   {
     Dali::Vector<float> inputBufferData;
-    ReadBinFile<float>( inputBufferData, path + load_uri, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
+    ReadBinaryData<float>( inputBufferData, binaryData, bufferView.byteOffset + accessor.byteOffset, elementNumOfByteStride * accessor.count );
     FitBuffer( bufferData, inputBufferData, accessor.count, elementNumOfByteStride, accessor.normalized );
   }
 }
@@ -382,12 +382,12 @@ VertexBuffer CreateVertexBuffer( Vector<T> bufferData, std::string map, int32_t
   return vertexBuffer;
 }
 
-void SetVertexBufferData( MeshInfo& meshInfo, std::string path, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t accessorIdx, std::string map, int32_t type )
+void SetVertexBufferData( MeshInfo& meshInfo, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t accessorIdx, std::string map, int32_t type )
 {
   if( accessorIdx >= 0 )
   {
     Dali::Vector<Vector3> bufferData;
-    LoadDataFromAccessor( accessorIdx, bufferData, path, accessorArray, bufferViewArray, bufferArray );
+    LoadDataFromAccessor( accessorIdx, bufferData, accessorArray, bufferViewArray, bufferArray );
     SetMeshInfoAndCanonize( meshInfo, bufferData );
 
     VertexBuffer vertexBuffer = CreateVertexBuffer<Vector3>( bufferData, map, type );
@@ -396,33 +396,33 @@ void SetVertexBufferData( MeshInfo& meshInfo, std::string path, std::vector<Acce
 }
 
 template <typename T>
-void SetAttributeBufferData( MeshInfo& meshInfo, std::string path, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t accessorIdx, std::string map, int32_t type )
+void SetAttributeBufferData( MeshInfo& meshInfo, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t accessorIdx, std::string map, int32_t type )
 {
   if( accessorIdx >= 0 )
   {
     Dali::Vector<T> bufferData;
-    LoadDataFromAccessor( accessorIdx, bufferData, path, accessorArray, bufferViewArray, bufferArray );
+    LoadDataFromAccessor( accessorIdx, bufferData, accessorArray, bufferViewArray, bufferArray );
 
     VertexBuffer vertexBuffer = CreateVertexBuffer<T>( bufferData, map, type );
     meshInfo.geometry.AddVertexBuffer( vertexBuffer );
   }
 }
 
-void SetIndexBuffersData( MeshInfo& meshInfo, std::string path, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t indexIdx )
+void SetIndexBuffersData( MeshInfo& meshInfo, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray, int32_t indexIdx )
 {
   Dali::Vector<uint16_t> indexBufferData;
-  LoadDataFromAccessor( indexIdx, indexBufferData, path, accessorArray, bufferViewArray, bufferArray );
+  LoadDataFromAccessor( indexIdx, indexBufferData, accessorArray, bufferViewArray, bufferArray );
   meshInfo.geometry.SetIndexBuffer( &indexBufferData[0], indexBufferData.Size() );
 }
 
 template<typename T>
-float LoadKeyFrames( const AnimationSamplerInfo& currentSampler, const Property::Index propIndex, KeyFrames& keyframes, std::string path, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray )
+float LoadKeyFrames( const AnimationSamplerInfo& currentSampler, const Property::Index propIndex, KeyFrames& keyframes, std::vector<AccessorInfo>& accessorArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<BufferInfo>& bufferArray )
 {
   Dali::Vector<float> inputBufferData;
   Dali::Vector<T> outputBufferData;
 
-  LoadDataFromAccessor<float>( currentSampler.input, inputBufferData, path, accessorArray, bufferViewArray, bufferArray );
-  LoadDataFromAccessor<T>( currentSampler.output, outputBufferData, path, accessorArray, bufferViewArray, bufferArray );
+  LoadDataFromAccessor<float>( currentSampler.input, inputBufferData, accessorArray, bufferViewArray, bufferArray );
+  LoadDataFromAccessor<T>( currentSampler.output, outputBufferData, accessorArray, bufferViewArray, bufferArray );
 
   uint32_t keyframeNum = inputBufferData.Size();
   float lengthAnimation = inputBufferData[inputBufferData.Size() - 1];
@@ -724,10 +724,9 @@ WrapMode::Type GetWrapMode( uint32_t mode )
   return retValue;
 }
 
-Texture LoadTexture( const char* imageUrl, bool generateMipmaps )
+Texture CreateTexture( Devel::PixelBuffer pixelBuffer, bool generateMipmaps )
 {
   Texture texture;
-  Devel::PixelBuffer pixelBuffer = LoadImageFromFile( imageUrl );
   if( pixelBuffer )
   {
     texture = Texture::New( TextureType::TEXTURE_2D, pixelBuffer.GetPixelFormat(), pixelBuffer.GetWidth(), pixelBuffer.GetHeight() );
@@ -786,7 +785,7 @@ Sampler LoadSampler( const TreeNode& samplerNode )
   return sampler;
 }
 
-bool LoadTextureArray( const TreeNode& root, std::string path, std::vector<Texture>& sourceArray, std::vector<Sampler>& samplerArray, std::vector<TextureInfo>& textureArray )
+void LoadImageUrlArray( const TreeNode& root, std::string path, std::vector<std::string>& imageUrlArray )
 {
   const TreeNode* imagesNode = root.GetChild( "images" );
   if( imagesNode )
@@ -802,9 +801,18 @@ bool LoadTextureArray( const TreeNode& root, std::string path, std::vector<Textu
         imageUrl = path + uri;
       }
 
-      sourceArray.push_back( LoadTexture( imageUrl.c_str(), true ) );
+      imageUrlArray.push_back( imageUrl );
     }
   }
+}
+
+bool LoadTextureArray( const TreeNode& root, std::vector<Devel::PixelBuffer>& pixelBufferArray, std::vector<Texture>& sourceArray, std::vector<Sampler>& samplerArray, std::vector<TextureInfo>& textureArray )
+{
+  // The images are already decoded, the textures are created and uploaded on the event thread.
+  for( auto&& pixelBuffer : pixelBufferArray )
+  {
+    sourceArray.push_back( CreateTexture( pixelBuffer, true ) );
+  }
 
   const TreeNode* samplersNode = root.GetChild( "samplers" );
   if( samplersNode )
@@ -1105,7 +1113,7 @@ bool LoadPrimitive( const TreeNode& mesh, MeshInfo& meshInfo )
   return true;
 }
 
-bool SetGeometry( MeshInfo& meshInfo, std::string path, std::vector<BufferInfo>& bufferArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<AccessorInfo>& accessorArray )
+bool SetGeometry( MeshInfo& meshInfo, std::vector<BufferInfo>& bufferArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<AccessorInfo>& accessorArray )
 {
   int32_t indicesIdx = meshInfo.indicesIdx;
 
@@ -1116,19 +1124,19 @@ bool SetGeometry( MeshInfo& meshInfo, std::string path, std::vector<BufferInfo>&
 
   if( indicesIdx >= 0 )
   {
-    SetIndexBuffersData( meshInfo, path, accessorArray, bufferViewArray, bufferArray, indicesIdx );
+    SetIndexBuffersData( meshInfo, accessorArray, bufferViewArray, bufferArray, indicesIdx );
   }
 
-  SetVertexBufferData( meshInfo, path, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.POSITION, "aPosition", Property::VECTOR3 );
-  SetAttributeBufferData<Vector3>( meshInfo, path, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.NORMAL, "aNormal", Property::VECTOR3 );
-  SetAttributeBufferData<Vector4>( meshInfo, path, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.TANGENT, "aTangent", Property::VECTOR4 );
+  SetVertexBufferData( meshInfo, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.POSITION, "aPosition", Property::VECTOR3 );
+  SetAttributeBufferData<Vector3>( meshInfo, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.NORMAL, "aNormal", Property::VECTOR3 );
+  SetAttributeBufferData<Vector4>( meshInfo, accessorArray, bufferViewArray, bufferArray, meshInfo.attribute.TANGENT, "aTangent", Property::VECTOR4 );
 
   for( uint32_t i = 0; i < meshInfo.attribute.TEXCOORD.size(); ++i )
   {
     int32_t accessorIdx = meshInfo.attribute.TEXCOORD[i];
     std::ostringstream texCoordString;
     texCoordString << "aTexCoord" << i;
-    SetAttributeBufferData<Vector2>( meshInfo, path, accessorArray, bufferViewArray, bufferArray, accessorIdx, texCoordString.str(), Property::VECTOR2 );
+    SetAttributeBufferData<Vector2>( meshInfo, accessorArray, bufferViewArray, bufferArray, accessorIdx, texCoordString.str(), Property::VECTOR2 );
   }
 
   for( auto&& accessorIdx : meshInfo.attribute.COLOR )
@@ -1141,7 +1149,7 @@ bool SetGeometry( MeshInfo& meshInfo, std::string path, std::vector<BufferInfo>&
     if( accessorArray[accessorIdx].type == "VEC3" )
     {
       Dali::Vector<Vector3> inputBufferData;
-      LoadDataFromAccessor( accessorIdx, inputBufferData, path, accessorArray, bufferViewArray, bufferArray );
+      LoadDataFromAccessor( accessorIdx, inputBufferData, accessorArray, bufferViewArray, bufferArray );
 
       Dali::Vector<Vector4> bufferData;
       bufferData.Resize( inputBufferData.Size() );
@@ -1157,13 +1165,13 @@ bool SetGeometry( MeshInfo& meshInfo, std::string path, std::vector<BufferInfo>&
     }
     else if( accessorArray[accessorIdx].type == "VEC4" )
     {
-      SetAttributeBufferData<Vector4>( meshInfo, path, accessorArray, bufferViewArray, bufferArray, accessorIdx, "aVertexColor", Property::VECTOR4 );
+      SetAttributeBufferData<Vector4>( meshInfo, accessorArray, bufferViewArray, bufferArray, accessorIdx, "aVertexColor", Property::VECTOR4 );
     }
   }
   return true;
 }
 
-bool LoadMeshArray( const TreeNode& root, std::string path, std::vector<MeshInfo>& meshArray, std::vector<BufferInfo>& bufferArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<AccessorInfo>& accessorArray )
+bool LoadMeshArray( const TreeNode& root, std::vector<MeshInfo>& meshArray, std::vector<BufferInfo>& bufferArray, std::vector<BufferViewInfo>& bufferViewArray, std::vector<AccessorInfo>& accessorArray )
 {
   const TreeNode* meshesNode = root.GetChild( "meshes" );
   if( !meshesNode )
@@ -1183,7 +1191,7 @@ bool LoadMeshArray( const TreeNode& root, std::string path, std::vector<MeshInfo
 
     //Need to add weights for Morph targets.
     LoadPrimitive( ( *meshIter ).second, meshInfo );
-    SetGeometry( meshInfo, path, bufferArray, bufferViewArray, accessorArray );
+    SetGeometry( meshInfo, bufferArray, bufferViewArray, accessorArray );
     meshArray.push_back( meshInfo );
   }
 
@@ -1203,6 +1211,11 @@ Loader::~Loader()
 }
 
 bool Loader::LoadScene( const std::string& filePath, Internal::Scene3dView& scene3dView )
+{
+  return ReadScene( filePath ) && CreateScene( scene3dView );
+}
+
+bool Loader::ReadScene( const std::string& filePath )
 {
   // Extracting directory path from full path to load resources.
   if( std::string::npos != filePath.rfind('/') )
@@ -1218,9 +1231,9 @@ bool Loader::LoadScene( const std::string& filePath, Internal::Scene3dView& scen
 
   mRoot = mParser.GetRoot();
   if( mRoot &&
-      LoadAssets() &&
-      CreateScene( scene3dView ) )
+      LoadBinaryData( *mRoot, mBufferArray, mBufferViewArray, mAccessorArray ) )
   {
+    LoadBinaryFilesAndImages();
     return true;
   }
   return false;
@@ -1241,21 +1254,65 @@ bool Loader::ParseGltf( const std::string& filePath )
   return mParser.Parse( fileBuffer );
 }
 
-bool Loader::LoadAssets()
+void Loader::LoadBinaryFilesAndImages()
 {
-  if( LoadBinaryData( *mRoot, mBufferArray, mBufferViewArray, mAccessorArray ) &&
-      LoadTextureArray( *mRoot, mPath, mSourceArray, mSamplerArray, mTextureArray ) &&
-      LoadMaterialSetArray( *mRoot, mMaterialArray ) &&
-      LoadMeshArray( *mRoot, mPath, mMeshArray, mBufferArray, mBufferViewArray, mAccessorArray )
-    )
+  std::vector<std::string> imageUrlArray;
+  LoadImageUrlArray( *mRoot, mPath, imageUrlArray );
+  mPixelBufferArray.resize( imageUrlArray.size() );
+
+  // Each buffer file is read once and each image is decoded concurrently, instead of reading the buffer
+  // files again for every accessor and decoding the images one after another.
+  std::vector< std::function< void() > > tasks;
+  tasks.reserve( mBufferArray.size() + imageUrlArray.size() );
+  for( auto&& buffer : mBufferArray )
   {
-    return true;
+    if( buffer.uri.empty() )
+    {
+      continue;
+    }
+
+    const std::string url = mPath + buffer.uri;
+    Dali::Vector<char>& data = buffer.data;
+    tasks.push_back( [url, &data]()
+    {
+      std::streampos fileSize = 0;
+      if( !Dali::FileLoader::ReadFile( url, fileSize, data, FileLoader::FileType::BINARY ) )
+      {
+        DALI_LOG_ERROR( "Fail to read the buffer file %s\n", url.c_str() );
+      }
+    } );
   }
-  return false;
+  for( uint32_t i = 0; i < imageUrlArray.size(); ++i )
+  {
+    const std::string& imageUrl = imageUrlArray[i];
+    Devel::PixelBuffer& pixelBuffer = mPixelBufferArray[i];
+    tasks.push_back( [&imageUrl, &pixelBuffer]()
+    {
+      pixelBuffer = LoadImageFromFile( imageUrl );
+    } );
+  }
+
+  ParallelFor( tasks.size(), 1u, [&tasks]( uint32_t first, uint32_t last )
+  {
+    for( uint32_t i = first; i < last; ++i )
+    {
+      tasks[i]();
+    }
+  } );
 }
 
 bool Loader::CreateScene( Internal::Scene3dView& scene3dView )
 {
+  // The textures and geometries are created on the event thread.
+  const bool loaded = LoadTextureArray( *mRoot, mPixelBufferArray, mSourceArray, mSamplerArray, mTextureArray ) &&
+                      LoadMaterialSetArray( *mRoot, mMaterialArray ) &&
+                      LoadMeshArray( *mRoot, mMeshArray, mBufferArray, mBufferViewArray, mAccessorArray );
+  mPixelBufferArray.clear();
+  if( !loaded )
+  {
+    return false;
+  }
+
   scene3dView.SetDefaultCamera( Dali::Camera::LOOK_AT_TARGET, 0.01, Vector3::ZERO );
   LoadCamera( scene3dView );
 
@@ -1768,11 +1825,11 @@ bool Loader::LoadAnimation( Scene3dView& scene3dView )
       KeyFrames keyframes = KeyFrames::New();
       if( propIndex == Dali::Actor::Property::ORIENTATION )
       {
-        duration = LoadKeyFrames<Vector4>( animationInfo.samplerArray[currentChannel.sampler], propIndex, keyframes, mPath, mAccessorArray, mBufferViewArray, mBufferArray );
+        duration = LoadKeyFrames<Vector4>( animationInfo.samplerArray[currentChannel.sampler], propIndex, keyframes, mAccessorArray, mBufferViewArray, mBufferArray );
       }
       else
       {
-        duration = LoadKeyFrames<Vector3>( animationInfo.samplerArray[currentChannel.sampler], propIndex, keyframes, mPath, mAccessorArray, mBufferViewArray, mBufferArray );
+        duration = LoadKeyFrames<Vector3>( animationInfo.samplerArray[currentChannel.sampler], propIndex, keyframes, mAccessorArray, mBufferViewArray, mBufferArray );
       }
 
       Animation animation = Animation::New( duration );
@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/shader.h>
@@ -127,6 +128,7 @@ struct BufferInfo
   int32_t byteLength;
   std::string uri;
   std::string name;
+  Dali::Vector<char> data; ///< The content of the buffer file, read once when the assets are loaded
 };
 
 struct BufferViewInfo
@@ -444,12 +446,25 @@ public:
    */
   bool LoadScene( const std::string& filePath, Internal::Scene3dView& scene3dView );
 
-private:
-  bool ParseGltf( const std::string& filePath );
-  bool LoadAssets();
+  /**
+   * @brief Read the scene format file, its buffer files and its images.
+   * It creates no Dali object, so it can be called on a worker thread.
+   * @param[in] filePath Path of scene format file.
+   * @return true if the file is successfully read
+   */
+  bool ReadScene( const std::string& filePath );
 
+  /**
+   * @brief Create the scene from the data read by ReadScene(), called on the event thread.
+   * @param[in] scene3dView Scene3dView the scene is created in.
+   * @return true if scene is successfully created
+   */
   bool CreateScene( Internal::Scene3dView& scene3dView );
 
+private:
+  bool ParseGltf( const std::string& filePath );
+  void LoadBinaryFilesAndImages();
+
   void LoadCamera( Scene3dView& scene3dView );
   bool LoadOrthoGraphic( const TreeNode& camera, CameraInfo& cameraInfo );
   bool LoadPerspective( const TreeNode& camera, CameraInfo& cameraInfo );
@@ -481,6 +496,7 @@ private:
   std::vector<MaterialInfo> mMaterialArray;
   std::vector<TextureInfo> mTextureArray;
 
+  std::vector<Devel::PixelBuffer> mPixelBufferArray; ///< The decoded images, until their textures are created
   std::vector<Texture> mSourceArray;
   std::vector<Sampler> mSamplerArray;
 };
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/scene3d-view/scene3d-load-thread.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/scene3d-view/gltf-loader.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+Scene3dLoadThread::Scene3dLoadThread( Gltf::Loader& loader, const std::string& filePath, EventThreadCallback* trigger )
+: mLoader( loader ),
+  mFilePath( filePath ),
+  mTrigger( std::unique_ptr< EventThreadCallback >( trigger ) ),
+  mLogFactory( Dali::Adaptor::Get().GetLogFactory() ),
+  mRead( false )
+{
+}
+
+Scene3dLoadThread::~Scene3dLoadThread()
+{
+}
+
+bool Scene3dLoadThread::IsRead() const
+{
+  return mRead;
+}
+
+void Scene3dLoadThread::Run()
+{
+  SetThreadName( "Scene3dLoadThread" );
+  mLogFactory.InstallLogFunction();
+
+  mRead = mLoader.ReadScene( mFilePath );
+
+  // wake up the event thread
+  mTrigger->Trigger();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,103 @@
+#ifndef DALI_TOOLKIT_INTERNAL_SCENE3D_LOAD_THREAD_H
+#define DALI_TOOLKIT_INTERNAL_SCENE3D_LOAD_THREAD_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <memory>
+#include <string>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace Gltf
+{
+
+class Loader;
+
+}
+
+/**
+ * The worker thread reading a scene format file, its buffer files and its images.
+ * It wakes up the event thread once the file is read, so that the scene can be created there.
+ */
+class Scene3dLoadThread : public Thread
+{
+public:
+
+  /**
+   * Constructor.
+   *
+   * @param[in] loader The loader reading the file, which must outlive the thread.
+   * @param[in] filePath The path of the scene format file.
+   * @param[in] trigger The trigger to wake up the event thread, owned by the thread.
+   */
+  Scene3dLoadThread( Gltf::Loader& loader, const std::string& filePath, EventThreadCallback* trigger );
+
+  /**
+   * Destructor.
+   */
+  ~Scene3dLoadThread() override;
+
+  /**
+   * Whether the file has been successfully read, called by the event thread once the thread is joined.
+   *
+   * @return true if the file has been successfully read.
+   */
+  bool IsRead() const;
+
+protected:
+
+  /**
+   * The entry function of the worker thread.
+   */
+  void Run() override;
+
+private:
+
+  // Undefined
+  Scene3dLoadThread( const Scene3dLoadThread& thread );
+
+  // Undefined
+  Scene3dLoadThread& operator=( const Scene3dLoadThread& thread );
+
+private:
+
+  Gltf::Loader&                          mLoader;
+  std::string                            mFilePath;
+  std::unique_ptr< EventThreadCallback > mTrigger;
+  const Dali::LogFactoryInterface&       mLogFactory;
+  bool                                   mRead;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_SCENE3D_LOAD_THREAD_H
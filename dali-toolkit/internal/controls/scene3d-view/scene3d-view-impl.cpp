@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/asset-manager/asset-manager.h>
+#include <dali-toolkit/internal/controls/scene3d-view/scene3d-load-thread.h>
 
 namespace Dali
 {
@@ -58,15 +59,21 @@ Scene3dView::Scene3dView()
   mAnimationArray(),
   mLightType( Toolkit::Scene3dView::LightType::NONE ),
   mLightVector( Vector3::ONE ),
-  mLightColor( Vector3::ONE )
+  mLightColor( Vector3::ONE ),
+  mSynchronousLoading( true )
 {
 }
 
 Scene3dView::~Scene3dView()
 {
+  if( mLoader )
+  {
+    // The loader must not be destroyed while the worker thread is reading the file.
+    mLoadThread->Join();
+  }
 }
 
-Toolkit::Scene3dView Scene3dView::New( const std::string& filePath )
+Toolkit::Scene3dView Scene3dView::New( const std::string& filePath, bool synchronousLoading )
 {
   Scene3dView* impl = new Scene3dView();
 
@@ -75,12 +82,13 @@ Toolkit::Scene3dView Scene3dView::New( const std::string& filePath )
   // Second-phase init of the implementation
   // This can only be done after the CustomActor connection has been made...
   impl->mFilePath = filePath;
+  impl->mSynchronousLoading = synchronousLoading;
   impl->Initialize();
 
   return handle;
 }
 
-Toolkit::Scene3dView Scene3dView::New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor )
+Toolkit::Scene3dView Scene3dView::New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor, bool synchronousLoading )
 {
   Scene3dView* impl = new Scene3dView();
 
@@ -89,6 +97,7 @@ Toolkit::Scene3dView Scene3dView::New( const std::string& filePath, const std::s
   // Second-phase init of the implementation
   // This can only be done after the CustomActor connection has been made...
   impl->mFilePath = filePath;
+  impl->mSynchronousLoading = synchronousLoading;
   impl->SetCubeMap( diffuseTexturePath, specularTexturePath, scaleFactor );
   impl->Initialize();
 
@@ -106,6 +115,45 @@ bool Scene3dView::CreateScene()
   return false;
 }
 
+void Scene3dView::ReadSceneAsynchronously()
+{
+  if( std::string::npos == mFilePath.rfind( GLTF_EXT ) )
+  {
+    DALI_LOG_ERROR( "Scene3dView: %s is not a glTF file\n", mFilePath.c_str() );
+
+    // The application connects to the ResourceReadySignal after New() returns, so it is emitted from the event loop
+    mReadFailedTrigger.reset( new EventThreadCallback( MakeCallback( this, &Scene3dView::OnSceneReadFailed ) ) );
+    mReadFailedTrigger->Trigger();
+    return;
+  }
+
+  mLoader.reset( new Internal::Gltf::Loader() );
+  mLoadThread.reset( new Scene3dLoadThread( *mLoader, mFilePath, new EventThreadCallback( MakeCallback( this, &Scene3dView::OnSceneRead ) ) ) );
+  mLoadThread->Start();
+}
+
+void Scene3dView::OnSceneRead()
+{
+  // The thread has woken up the event thread at the end of its run, so this does not wait for long.
+  // The thread is kept until the control is destroyed, as it owns the trigger calling this.
+  mLoadThread->Join();
+
+  if( !mLoadThread->IsRead() || !mLoader->CreateScene( *this ) )
+  {
+    DALI_LOG_ERROR( "Scene3dView: Fail to load %s\n", mFilePath.c_str() );
+  }
+  mLoader.reset();
+
+  Toolkit::Control handle( GetOwner() );
+  handle.ResourceReadySignal().Emit( handle );
+}
+
+void Scene3dView::OnSceneReadFailed()
+{
+  Toolkit::Control handle( GetOwner() );
+  handle.ResourceReadySignal().Emit( handle );
+}
+
 uint32_t Scene3dView::GetAnimationCount()
 {
   return mAnimationArray.size();
@@ -367,7 +415,14 @@ void Scene3dView::OnInitialize()
   self.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
   self.Add( layer );
 
-  CreateScene();
+  if( mSynchronousLoading )
+  {
+    CreateScene();
+  }
+  else
+  {
+    ReadSceneAsynchronously();
+  }
 }
 
 }//namespace Internal
@@ -20,9 +20,11 @@
 
 // EXTERNAL INCLUDES
 #include <cstring>
+#include <memory>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/rendering/shader.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 
 // INTERNAL INCLUDES
@@ -48,6 +50,8 @@ class Loader;
 
 }
 
+class Scene3dLoadThread;
+
 /**
  * Scene3dView implementation class
  */
@@ -74,14 +78,14 @@ public:
   virtual ~Scene3dView();
 
   /**
-   * @copydoc Dali::Toolkit::Scene3dView::New( const std::string& filePath )
+   * @copydoc Dali::Toolkit::Scene3dView::New( const std::string& filePath, bool synchronousLoading )
    */
-  static Dali::Toolkit::Scene3dView New( const std::string& filePath );
+  static Dali::Toolkit::Scene3dView New( const std::string& filePath, bool synchronousLoading );
 
   /**
-   * @copydoc Dali::Toolkit::Scene3dView::New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor )
+   * @copydoc Dali::Toolkit::Scene3dView::New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor, bool synchronousLoading )
    */
-  static Dali::Toolkit::Scene3dView New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor );
+  static Dali::Toolkit::Scene3dView New( const std::string& filePath, const std::string& diffuseTexturePath, const std::string& specularTexturePath, Vector4 scaleFactor, bool synchronousLoading );
 
   /**
    * @copydoc Dali::Toolkit::Scene3dView::CreateScene()
@@ -210,6 +214,20 @@ private:
 
   virtual void OnInitialize();
 
+  /**
+   * @brief Start reading the scene format file on a worker thread.
+   */
+  void ReadSceneAsynchronously();
+
+  /**
+   * @brief Create the scene once the worker thread has read the file, and emit the ResourceReadySignal.
+   */
+  void OnSceneRead();
+
+  /**
+   * @brief Emit the ResourceReadySignal when the file cannot be read asynchronously.
+   */
+  void OnSceneReadFailed();
 
   /**
    * @brief Load 2D texture.
@@ -222,6 +240,11 @@ private:
 private:
   Actor mRoot; // Root actor that contains scene graph
   std::string mFilePath; // Full file path of scene file
+  bool mSynchronousLoading; // Whether the scene is loaded in New() or on a worker thread
+
+  std::unique_ptr<Gltf::Loader> mLoader; // Loader of the scene until it is created from the data read on the worker thread
+  std::unique_ptr<Scene3dLoadThread> mLoadThread; // Worker thread reading the scene file
+  std::unique_ptr<EventThreadCallback> mReadFailedTrigger; // Trigger emitting the ResourceReadySignal after New() when the file is not read
 
   std::vector<Shader> mShaderArray; // Shader Array to change properties of scene such as lighting.
 
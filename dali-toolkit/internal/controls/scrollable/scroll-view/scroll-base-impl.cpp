@@ -18,8 +18,34 @@
 // CLASS HEADER
 #include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-base-impl.h>
 
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+
 using namespace Dali;
 
+namespace
+{
+
+/**
+ * Keeps a culled actor where the scroll constraints left it, without any input to update.
+ */
+struct CulledPositionConstraint
+{
+  CulledPositionConstraint(const Vector3& offset)
+  : mOffset(offset)
+  {
+  }
+
+  void operator()(Vector3& position, const PropertyInputContainer& inputs)
+  {
+    position += mOffset;
+  }
+
+  Vector3 mOffset;
+};
+
+} // unnamed namespace
+
 namespace Dali
 {
 
@@ -77,6 +103,7 @@ void ScrollBase::UnbindActor(Actor child)
 
     if( actorInfo->mActor == child )
     {
+      // The constraints are removed with the ActorInfo.
       mBoundActors.erase(iter);
       break;
     }
@@ -104,7 +131,11 @@ void ScrollBase::ApplyConstraintToBoundActors(Constraint constraint)
 
   for(ActorInfoIter i = mBoundActors.begin();i != mBoundActors.end(); ++i)
   {
-    (*i)->ApplyConstraint(constraint);
+    // Culled actors get the constraint when they are shown again.
+    if( !(*i)->mCulled )
+    {
+      (*i)->ApplyConstraint(constraint);
+    }
   }
 }
 
@@ -118,6 +149,48 @@ void ScrollBase::RemoveConstraintsFromBoundActors()
   }
 }
 
+void ScrollBase::SetBoundActorCulled(ActorInfo& actorInfo, bool culled, const Vector3& offset)
+{
+  if( culled == actorInfo.mCulled )
+  {
+    return;
+  }
+
+  actorInfo.mCulled = culled;
+  actorInfo.RemoveConstraints();
+
+  if( culled )
+  {
+    // The properties owned by the application, e.g. VISIBLE, are not changed.
+    // The actor is kept outside the view by a constraint without inputs instead.
+    Constraint constraint = Constraint::New< Vector3 >( actorInfo.mActor, Actor::Property::POSITION, CulledPositionConstraint( offset ) );
+    constraint.Apply();
+    actorInfo.mConstraints.push_back( constraint );
+  }
+  else
+  {
+    actorInfo.RemoveCullingNotifications();
+
+    for(ConstraintStack::iterator i = mConstraintStack.begin();i!=mConstraintStack.end();i++)
+    {
+      actorInfo.ApplyConstraint(*i);
+    }
+  }
+}
+
+ScrollBase::ActorInfo* ScrollBase::FindBoundActor(Actor actor) const
+{
+  for(ActorInfoConstIter iter = mBoundActors.begin(); iter != mBoundActors.end(); ++iter)
+  {
+    if( (*iter)->mActor == actor )
+    {
+      return iter->Get();
+    }
+  }
+
+  return NULL;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -22,6 +22,7 @@
 // TODO - Replace list with dali-vector.h
 #include <list>
 #include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/object/property-notification.h>
 
 // INTERNAL INCLUDES
 
@@ -57,17 +58,19 @@ public:
      * @param[in] actor The actor that this ActorInfo represents.
      */
     ActorInfo(Actor actor)
-    : mActor(actor)
+    : mActor(actor),
+      mCulled(false)
     {
     }
 
     /**
      * ActorInfo destructor
-     * removes scrollview-related constraints only.
+     * removes scrollview-related constraints and notifications only.
      */
     ~ActorInfo()
     {
       RemoveConstraints();
+      RemoveCullingNotifications();
     }
 
     /**
@@ -99,8 +102,39 @@ public:
       mConstraints.clear();
     }
 
+    /**
+     * Add a property notification to this actor while it is culled
+     * The ActorInfo will keep track of this notification.
+     * @param[in] index The index of the property to watch
+     * @param[in] componentIndex The component of the property to watch
+     * @param[in] condition The condition of the notification
+     * @return The notification
+     */
+    PropertyNotification AddCullingNotification(Property::Index index, int componentIndex, const PropertyCondition& condition)
+    {
+      PropertyNotification notification = mActor.AddPropertyNotification( index, componentIndex, condition );
+      mCullingNotifications.push_back( notification );
+      return notification;
+    }
+
+    /**
+     * Remove the property notifications added to this actor while it is culled.
+     */
+    void RemoveCullingNotifications()
+    {
+      std::vector<PropertyNotification>::iterator it = mCullingNotifications.begin();
+      std::vector<PropertyNotification>::iterator end = mCullingNotifications.end();
+      for(;it!=end;++it)
+      {
+        mActor.RemovePropertyNotification( *it );
+      }
+      mCullingNotifications.clear();
+    }
+
     Actor mActor;                                     ///< The Actor that this ActorInfo represents.
     std::vector<Constraint> mConstraints;       ///< A list keeping track of constraints applied to the actor via this delegate.
+    std::vector<PropertyNotification> mCullingNotifications; ///< A list keeping track of notifications added to the actor while it is culled.
+    bool mCulled;                               ///< Whether the actor is kept outside the view instead of being constrained by the scroll position.
   };
 
   typedef IntrusivePtr<ActorInfo> ActorInfoPtr;
@@ -180,10 +214,41 @@ public:
    */
   void RemoveConstraintsFromBoundActors();
 
+  /**
+   * Replaces the constraints of a bound actor by a constant offset of its position, or applies the constraints again.
+   * The visibility of the actor is not changed; a culled actor is kept outside the view by the offset.
+   * The notifications added to the actor while it is culled are removed when it is not culled anymore.
+   *
+   * @param[in] actorInfo The bound actor.
+   * @param[in] culled Whether the actor is culled.
+   * @param[in] offset The offset of the position of a culled actor, which keeps it where the constraints left it.
+   */
+  void SetBoundActorCulled(ActorInfo& actorInfo, bool culled, const Vector3& offset = Vector3::ZERO);
+
 protected:
 
   static const char* const SCROLL_DOMAIN_OFFSET_PROPERTY_NAME;
 
+protected:
+
+  /**
+   * Gets the actors bound to this ScrollView/Group.
+   *
+   * @return The bound actors.
+   */
+  const ActorInfoContainer& GetBoundActors() const
+  {
+    return mBoundActors;
+  }
+
+  /**
+   * Finds an actor bound to this ScrollView/Group.
+   *
+   * @param[in] actor The actor to find.
+   * @return The bound actor, or NULL if the actor is not bound.
+   */
+  ActorInfo* FindBoundActor(Actor actor) const;
+
 protected:
 
   /**
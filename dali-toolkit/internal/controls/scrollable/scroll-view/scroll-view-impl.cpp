@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <cstring> // for strcmp
+#include <set>
 #include <dali/public-api/animation/constraints.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/public-api/events/wheel-event.h>
@@ -33,6 +34,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
+#include <dali-toolkit/devel-api/controls/scroll-view/scroll-view-devel.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view-constraints.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-mode.h>
@@ -153,6 +155,49 @@ Vector3 GetPositionOfAnchor(Actor &actor, const Vector3 &anchor)
   return childPosition + childAnchor * childSize;
 }
 
+/**
+ * Returns the position of the anchor within an actor moved by the scroll position
+ *
+ * The current position of a culled actor is not constrained, so it is computed from its position and the scroll position.
+ *
+ * @param actor The Actor
+ * @param anchor The Anchor point of interest.
+ * @param scrollPosition The scroll position
+ * @return The position of the Anchor
+ */
+Vector3 GetScrolledPositionOfAnchor(Actor &actor, const Vector3 &anchor, const Vector2& scrollPosition)
+{
+  Vector3 childPosition = actor.GetProperty< Vector3 >( Actor::Property::POSITION ) + Vector3( scrollPosition );
+  Vector3 childAnchor = - actor.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT ) + anchor;
+  Vector3 childSize = actor.GetProperty< Vector3 >( Actor::Property::SIZE );
+
+  return childPosition + childAnchor * childSize;
+}
+
+/**
+ * Returns whether an actor moved by the scroll position is within the culling margin of the scroll view
+ *
+ * @param actor The Actor
+ * @param scrollPosition The scroll position
+ * @param size The size of the scroll view
+ * @param margin The culling margin
+ * @return True if the actor is within the margin
+ */
+bool IsWithinCullingMargin(Actor &actor, const Vector2& scrollPosition, const Vector2& size, float margin)
+{
+  const Vector3 position = actor.GetProperty< Vector3 >( Actor::Property::POSITION );
+  const Vector3 parentOrigin = actor.GetProperty< Vector3 >( Actor::Property::PARENT_ORIGIN );
+  const Vector3 anchorPoint = actor.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT );
+  const Vector3 actorSize = actor.GetProperty< Vector3 >( Actor::Property::SIZE ) * actor.GetProperty< Vector3 >( Actor::Property::SCALE );
+
+  // The top left corner of the actor from the top left corner of the scroll view
+  const float left = parentOrigin.x * size.width + position.x + scrollPosition.x - anchorPoint.x * actorSize.width;
+  const float top = parentOrigin.y * size.height + position.y + scrollPosition.y - anchorPoint.y * actorSize.height;
+
+  return ( left + actorSize.width >= -margin ) && ( left <= size.width + margin ) &&
+         ( top + actorSize.height >= -margin ) && ( top <= size.height + margin );
+}
+
 // AlphaFunctions /////////////////////////////////////////////////////////////////////////////////
 
 float FinalDefaultAlphaFunction(float offset)
@@ -253,6 +298,7 @@ DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "panningEnabled",             B
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "axisAutoLockEnabled",        BOOLEAN,   AXIS_AUTO_LOCK_ENABLED      )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "wheelScrollDistanceStep",    VECTOR2,   WHEEL_SCROLL_DISTANCE_STEP  )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollMode",                 MAP,       SCROLL_MODE )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, ScrollView, "cullingMargin",        FLOAT,     CULLING_MARGIN )
 
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPosition",  VECTOR2, SCROLL_POSITION)
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPrePosition",   VECTOR2, SCROLL_PRE_POSITION)
@@ -635,6 +681,7 @@ ScrollView::ScrollView()
   mScrollStateFlags(0),
   mLockAxis(LockPossible),
   mScrollUpdateDistance(DEFAULT_SCROLL_UPDATE_DISTANCE),
+  mCullingMargin(-1.0f),
   mMaxOvershoot(DEFAULT_MAX_OVERSHOOT, DEFAULT_MAX_OVERSHOOT),
   mUserMaxOvershoot(DEFAULT_MAX_OVERSHOOT, DEFAULT_MAX_OVERSHOOT),
   mSnapOvershootDuration(DEFAULT_SNAP_OVERSHOOT_DURATION),
@@ -803,6 +850,12 @@ void ScrollView::ApplyEffect(Toolkit::ScrollViewEffect effect)
 
   // invoke Attachment request to ScrollView first
   GetImpl(effect).Attach(self);
+
+  // The effects move the children, they are not culled anymore
+  if( mCullingMargin >= 0.0f )
+  {
+    UpdateCulling();
+  }
 }
 
 void ScrollView::RemoveEffect(Toolkit::ScrollViewEffect effect)
@@ -826,6 +879,11 @@ void ScrollView::RemoveEffect(Toolkit::ScrollViewEffect effect)
 
   // invoke Detachment request to ScrollView last
   GetImpl(effect).Detach(self);
+
+  if( mCullingMargin >= 0.0f )
+  {
+    UpdateCulling();
+  }
 }
 
 void ScrollView::RemoveAllEffects()
@@ -841,6 +899,11 @@ void ScrollView::RemoveAllEffects()
   }
 
   mEffects.clear();
+
+  if( mCullingMargin >= 0.0f )
+  {
+    UpdateCulling();
+  }
 }
 
 void ScrollView::ApplyConstraintToChildren(Constraint constraint)
@@ -1067,6 +1130,12 @@ void ScrollView::SetWrapMode(bool enable)
 {
   mWrapMode = enable;
   Self().SetProperty(Toolkit::ScrollView::Property::WRAP, enable);
+
+  // The wrapped children are not culled
+  if( mCullingMargin >= 0.0f )
+  {
+    UpdateCulling();
+  }
 }
 
 int ScrollView::GetScrollUpdateDistance() const
@@ -1079,6 +1148,32 @@ void ScrollView::SetScrollUpdateDistance(int distance)
   mScrollUpdateDistance = distance;
 }
 
+void ScrollView::SetCullingMargin(float margin)
+{
+  const bool cullingEnabled = mCullingMargin >= 0.0f;
+  mCullingMargin = margin;
+
+  SetCullingNotification();
+
+  // Constrain the culled children again if the culling is disabled
+  if( cullingEnabled || ( mCullingMargin >= 0.0f ) )
+  {
+    // The culled children watch their position with the step of the previous margin
+    const ActorInfoContainer& boundActors = GetBoundActors();
+    for( ActorInfoConstIter iter = boundActors.begin(); iter != boundActors.end(); ++iter )
+    {
+      SetChildCulled( **iter, false );
+    }
+
+    UpdateCulling();
+  }
+}
+
+float ScrollView::GetCullingMargin() const
+{
+  return mCullingMargin;
+}
+
 bool ScrollView::GetAxisAutoLock() const
 {
   return mAxisAutoLock;
@@ -1326,9 +1421,19 @@ void ScrollView::ScrollTo(Actor &actor, float duration)
 
   Actor self = Self();
   Vector3 size = self.GetCurrentProperty< Vector3 >( Actor::Property::SIZE );
-  Vector3 position = actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION );
-  Vector2 prePosition = GetPropertyPrePosition();
-  position.GetVectorXY() -= prePosition;
+  Vector3 position;
+  ActorInfo* actorInfo = FindBoundActor( actor );
+  if( actorInfo && actorInfo->mCulled )
+  {
+    // A culled actor is not moved by the scroll position
+    position = actor.GetProperty< Vector3 >( Actor::Property::POSITION );
+  }
+  else
+  {
+    position = actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION );
+    Vector2 prePosition = GetPropertyPrePosition();
+    position.GetVectorXY() -= prePosition;
+  }
 
   ScrollTo(Vector2(position.x - size.width * 0.5f, position.y - size.height * 0.5f), duration);
 }
@@ -1349,6 +1454,23 @@ Actor ScrollView::FindClosestActorToPosition(const Vector3& position, FindDirect
 
   unsigned int numChildren = Self().GetChildCount();
 
+  // The culled children are not moved by the constraints
+  std::set< Actor > culledChildren;
+  Vector2 scrollPosition;
+  if( IsCullingActive() )
+  {
+    scrollPosition = Self().GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION );
+
+    const ActorInfoContainer& boundActors = GetBoundActors();
+    for( ActorInfoConstIter iter = boundActors.begin(); iter != boundActors.end(); ++iter )
+    {
+      if( (*iter)->mCulled )
+      {
+        culledChildren.insert( (*iter)->mActor );
+      }
+    }
+  }
+
   for(unsigned int i = 0; i < numChildren; ++i)
   {
     Actor child = Self().GetChildAt(i);
@@ -1358,7 +1480,9 @@ Actor ScrollView::FindClosestActorToPosition(const Vector3& position, FindDirect
       continue;
     }
 
-    Vector3 childPosition = GetPositionOfAnchor(child, AnchorPoint::CENTER);
+    Vector3 childPosition = ( culledChildren.find( child ) != culledChildren.end() ) ?
+                            GetScrolledPositionOfAnchor(child, AnchorPoint::CENTER, scrollPosition) :
+                            GetPositionOfAnchor(child, AnchorPoint::CENTER);
 
     Vector3 delta = childPosition - actualPosition;
 
@@ -1916,6 +2040,98 @@ void ScrollView::OnScrollUpdateNotification(Dali::PropertyNotification& source)
   mScrollUpdatedSignal.Emit( currentScrollPosition );
 }
 
+bool ScrollView::IsCullingActive() const
+{
+  return ( mCullingMargin >= 0.0f ) && !mWrapMode && mEffects.empty();
+}
+
+void ScrollView::SetCullingNotification()
+{
+  Actor self = Self();
+  if( mCullingXNotification )
+  {
+    // disconnect now to avoid a notification before removed from update thread
+    mCullingXNotification.NotifySignal().Disconnect(this, &ScrollView::OnCullingNotification);
+    self.RemovePropertyNotification(mCullingXNotification);
+    mCullingXNotification.Reset();
+  }
+  if( mCullingYNotification )
+  {
+    mCullingYNotification.NotifySignal().Disconnect(this, &ScrollView::OnCullingNotification);
+    self.RemovePropertyNotification(mCullingYNotification);
+    mCullingYNotification.Reset();
+  }
+  if( mCullingMargin >= 0.0f )
+  {
+    // The children are shown before they scroll within half the margin
+    const float step = std::max( mCullingMargin * 0.5f, 1.0f );
+    mCullingXNotification = self.AddPropertyNotification(Toolkit::ScrollView::Property::SCROLL_POSITION, 0, StepCondition(step, 0.0f));
+    mCullingXNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+    mCullingYNotification = self.AddPropertyNotification(Toolkit::ScrollView::Property::SCROLL_POSITION, 1, StepCondition(step, 0.0f));
+    mCullingYNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+  }
+}
+
+void ScrollView::OnCullingNotification(Dali::PropertyNotification& source)
+{
+  UpdateCulling();
+}
+
+void ScrollView::UpdateCulling()
+{
+  Actor self = Self();
+  const Vector2 scrollPosition = self.GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION );
+  const Vector2 size = self.GetProperty< Vector3 >( Actor::Property::SIZE ).GetVectorXY();
+
+  const ActorInfoContainer& boundActors = GetBoundActors();
+  for( ActorInfoConstIter iter = boundActors.begin(); iter != boundActors.end(); ++iter )
+  {
+    UpdateCulling( **iter, scrollPosition, size );
+  }
+}
+
+void ScrollView::UpdateCulling(ActorInfo& actorInfo, const Vector2& scrollPosition, const Vector2& size)
+{
+  const bool culled = IsCullingActive() && !IsWithinCullingMargin( actorInfo.mActor, scrollPosition, size, mCullingMargin );
+  SetChildCulled( actorInfo, culled );
+}
+
+void ScrollView::SetChildCulled(ActorInfo& actorInfo, bool culled)
+{
+  if( culled == actorInfo.mCulled )
+  {
+    return;
+  }
+
+  if( culled )
+  {
+    // Keep the child where the scroll position moved it, which is outside the view plus the margin
+    const Vector2 scrollPosition = Self().GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION );
+    SetBoundActorCulled( actorInfo, true, Vector3( scrollPosition ) );
+
+    // The unconstrained position of a culled child only changes when the application moves it
+    const float step = std::max( mCullingMargin * 0.5f, 1.0f );
+    actorInfo.AddCullingNotification( Actor::Property::POSITION, 0, StepCondition( step, 0.0f ) ).NotifySignal().Connect( this, &ScrollView::OnCulledChildMoved );
+    actorInfo.AddCullingNotification( Actor::Property::POSITION, 1, StepCondition( step, 0.0f ) ).NotifySignal().Connect( this, &ScrollView::OnCulledChildMoved );
+  }
+  else
+  {
+    SetBoundActorCulled( actorInfo, false );
+  }
+}
+
+void ScrollView::OnCulledChildMoved(Dali::PropertyNotification& source)
+{
+  ActorInfo* actorInfo = FindBoundActor( Actor::DownCast( source.GetTarget() ) );
+  if( actorInfo )
+  {
+    Actor self = Self();
+    UpdateCulling( *actorInfo,
+                   self.GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION ),
+                   self.GetProperty< Vector3 >( Actor::Property::SIZE ).GetVectorXY() );
+  }
+}
+
 bool ScrollView::DoConnectSignal( BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor )
 {
   Dali::BaseHandle handle( object );
@@ -1961,6 +2177,11 @@ void ScrollView::OnSizeSet( const Vector3& size )
     mOvershootIndicator->Reset();
   }
 
+  if( IsCullingActive() )
+  {
+    UpdateCulling();
+  }
+
   ScrollBase::OnSizeSet( size );
 }
 
@@ -2002,11 +2223,26 @@ void ScrollView::OnChildAdd(Actor& child)
   else if(mAlterChild)
   {
     BindActor(child);
+
+    if( IsCullingActive() )
+    {
+      Actor self = Self();
+      UpdateCulling( *GetBoundActors().back(),
+                     self.GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION ),
+                     self.GetProperty< Vector3 >( Actor::Property::SIZE ).GetVectorXY() );
+    }
   }
 }
 
 void ScrollView::OnChildRemove(Actor& child)
 {
+  // Remove the notifications of a culled child
+  ActorInfo* actorInfo = FindBoundActor( child );
+  if( actorInfo )
+  {
+    SetChildCulled( *actorInfo, false );
+  }
+
   // TODO: Actor needs a RemoveConstraint method to take out an individual constraint.
   UnbindActor(child);
 
@@ -2920,6 +3156,12 @@ void ScrollView::SetProperty( BaseObject* object, Property::Index index, const P
         {
           scrollViewImpl.SetScrollMode( *map );
         }
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::CULLING_MARGIN:
+      {
+        scrollViewImpl.SetCullingMargin( value.Get<float>() );
+        break;
       }
     }
   }
@@ -2956,6 +3198,11 @@ Property::Value ScrollView::GetProperty( BaseObject* object, Property::Index ind
         value = scrollViewImpl.GetWheelScrollDistanceStep();
         break;
       }
+      case Toolkit::DevelScrollView::Property::CULLING_MARGIN:
+      {
+        value = scrollViewImpl.GetCullingMargin();
+        break;
+      }
     }
   }
 
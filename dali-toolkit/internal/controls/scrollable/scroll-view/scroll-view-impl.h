@@ -275,6 +275,18 @@ public:
    */
   void SetScrollUpdateDistance(int distance);
 
+  /**
+   * Sets the distance beyond the edges of the scroll view from which the children are culled.
+   * @param[in] margin The culling margin, a negative value disables the culling.
+   */
+  void SetCullingMargin(float margin);
+
+  /**
+   * Gets the distance beyond the edges of the scroll view from which the children are culled.
+   * @return The culling margin.
+   */
+  float GetCullingMargin() const;
+
   /**
    * @copydoc Toolkit::ScrollView::GetAxisAutoLock
    */
@@ -860,6 +872,50 @@ private:
    */
   void OnScrollUpdateNotification(Dali::PropertyNotification& source);
 
+  /**
+   * Whether the children outside the culling margin are culled.
+   * They are not when the children are not only moved by the scroll position, i.e. when wrapping or with effects.
+   * @return True if the culling is active.
+   */
+  bool IsCullingActive() const;
+
+  /**
+   * Adds the property notifications updating the culling of the children, or removes them if the culling is disabled.
+   */
+  void SetCullingNotification();
+
+  /**
+   * Called when the scroll position has moved by half the culling margin.
+   * @param[in] source The property notification.
+   */
+  void OnCullingNotification(Dali::PropertyNotification& source);
+
+  /**
+   * Culls the children outside the culling margin, and constrains the other ones by the scroll position.
+   */
+  void UpdateCulling();
+
+  /**
+   * Culls a bound actor if it is outside the culling margin, or constrains it by the scroll position.
+   * @param[in] actorInfo The bound actor.
+   * @param[in] scrollPosition The scroll position moving the children.
+   * @param[in] size The size of the scroll view.
+   */
+  void UpdateCulling(ActorInfo& actorInfo, const Vector2& scrollPosition, const Vector2& size);
+
+  /**
+   * Culls a bound actor and watches the changes of its position, or constrains it by the scroll position again.
+   * @param[in] actorInfo The bound actor.
+   * @param[in] culled Whether the actor is culled.
+   */
+  void SetChildCulled(ActorInfo& actorInfo, bool culled);
+
+  /**
+   * Called when a culled child has moved by half the culling margin.
+   * @param[in] source The property notification.
+   */
+  void OnCulledChildMoved(Dali::PropertyNotification& source);
+
   /**
    * Set up default rulers using a property map
    * @param[in] scrollModeMap A map defining the characteristics of X and Y scrolling
@@ -911,6 +967,10 @@ private:
   Dali::PropertyNotification mScrollXUpdateNotification; ///< scroll x position update notification
   Dali::PropertyNotification mScrollYUpdateNotification; ///< scroll y position update notification
 
+  float mCullingMargin;                 ///< Distance beyond the edges from which the children are culled, negative if disabled
+  Dali::PropertyNotification mCullingXNotification; ///< scroll x position notification updating the culling
+  Dali::PropertyNotification mCullingYNotification; ///< scroll y position notification updating the culling
+
   Actor mInternalActor;                 ///< Internal actor (we keep internal actors in here e.g. scrollbars, so we can ignore it in searches)
 
   ScrollViewEffectContainer mEffects;   ///< Container keeping track of all the applied effects.
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/controls/table-view/table-view-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <sstream>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/object/type-registry.h>
@@ -43,6 +44,16 @@ bool FitToChild( Actor actor, Dimension::Type dimension )
   return actor.GetResizePolicy( dimension ) != ResizePolicy::FILL_TO_PARENT && actor.GetRelayoutSize( dimension ) > 0.0f;
 }
 
+/**
+ * @brief Get the key of the actor in the child index
+ *
+ * @param[in] actor The child actor
+ */
+uint32_t GetActorId( const Actor& actor )
+{
+  return static_cast< uint32_t >( actor.GetProperty< int >( Actor::Property::ID ) );
+}
+
 #if defined(DEBUG_ENABLED)
 // debugging support, very useful when new features are added or bugs are hunted down
 // currently not called from code so compiler will optimize these away, kept here for future debugging
@@ -167,6 +178,56 @@ const Scripting::StringEnum VERTICAL_ALIGNMENT_STRING_TABLE[] =
 };
 const unsigned int VERTICAL_ALIGNMENT_STRING_TABLE_COUNT = sizeof(VERTICAL_ALIGNMENT_STRING_TABLE) / sizeof( VERTICAL_ALIGNMENT_STRING_TABLE[0] );
 
+/**
+ * @brief Find the first row affected by inserting or deleting the given row
+ *
+ * Actors spanning over the row start above it and have a cell in the row just above it.
+ * @param[in] cellData The cells of the table
+ * @param[in] rowIndex The inserted or deleted row
+ * @return The top row of the actors spanning over the row, or rowIndex if there are none
+ */
+unsigned int FindFirstSpanningRow( Array2d<TableView::CellData>& cellData, unsigned int rowIndex )
+{
+  unsigned int firstRow = rowIndex;
+  if( rowIndex > 0 )
+  {
+    for( unsigned int column = 0, columnCount = cellData.GetColumns(); column < columnCount; ++column )
+    {
+      const Toolkit::TableView::CellPosition& position = cellData[ rowIndex - 1 ][ column ].position;
+      if( ( position.rowSpan > 1 ) && ( position.rowIndex + position.rowSpan > rowIndex ) )
+      {
+        firstRow = std::min( firstRow, position.rowIndex );
+      }
+    }
+  }
+  return firstRow;
+}
+
+/**
+ * @brief Find the first column affected by inserting or deleting the given column
+ *
+ * Actors spanning over the column start left of it and have a cell in the column just left of it.
+ * @param[in] cellData The cells of the table
+ * @param[in] columnIndex The inserted or deleted column
+ * @return The leftmost column of the actors spanning over the column, or columnIndex if there are none
+ */
+unsigned int FindFirstSpanningColumn( Array2d<TableView::CellData>& cellData, unsigned int columnIndex )
+{
+  unsigned int firstColumn = columnIndex;
+  if( columnIndex > 0 )
+  {
+    for( unsigned int row = 0, rowCount = cellData.GetRows(); row < rowCount; ++row )
+    {
+      const Toolkit::TableView::CellPosition& position = cellData[ row ][ columnIndex - 1 ].position;
+      if( ( position.columnSpan > 1 ) && ( position.columnIndex + position.columnSpan > columnIndex ) )
+      {
+        firstColumn = std::min( firstColumn, position.columnIndex );
+      }
+    }
+  }
+  return firstColumn;
+}
+
 } // Unnamed namespace
 
 Toolkit::TableView TableView::New( unsigned int initialRows, unsigned int initialColumns )
@@ -244,6 +305,7 @@ bool TableView::AddChild( Actor& child, const Toolkit::TableView::CellPosition&
       mCellData[ row ][ column ] = data;
     }
   }
+  mChildIndex[ GetActorId( child ) ] = { position.rowIndex, position.columnIndex };
 
   // Relayout the whole table
   if( mRowData[position.rowIndex].sizePolicy == Toolkit::TableView::FIT && position.rowSpan == 1 )
@@ -305,19 +367,16 @@ bool TableView::FindChildPosition( const Actor& child, Toolkit::TableView::CellP
   // Only find valid child actors
   if( child )
   {
-    // Walk through the layout data
-    const unsigned int rowCount = mCellData.GetRows();
-    const unsigned int columnCount = mCellData.GetColumns();
-
-    for( unsigned int row = 0; row < rowCount; ++row )
+    // Look up the top left cell of the child
+    auto iter = mChildIndex.find( GetActorId( child ) );
+    if( iter != mChildIndex.end() )
     {
-      for( unsigned int column = 0; column < columnCount; ++column )
+      const CellIndex& cellIndex = iter->second;
+      if( ( cellIndex.rowIndex < mCellData.GetRows() ) && ( cellIndex.columnIndex < mCellData.GetColumns() ) &&
+          ( mCellData[ cellIndex.rowIndex ][ cellIndex.columnIndex ].actor == child ) )
       {
-        if( mCellData[ row ][ column ].actor == child )
-        {
-          positionOut = mCellData[ row ][ column ].position;
-          return true;
-        }
+        positionOut = mCellData[ cellIndex.rowIndex ][ cellIndex.columnIndex ].position;
+        return true;
       }
     }
   }
@@ -335,7 +394,11 @@ void TableView::InsertRow( unsigned int rowIndex )
   const unsigned int rowCount = mCellData.GetRows();
   const unsigned int columnCount = mCellData.GetColumns();
 
-  for( unsigned int row = 0; row < rowCount; ++row )
+  // Only the rows below the inserted one and the actors spanning over it change.
+  // The spanning actors all have a cell in the row above the inserted one.
+  const unsigned int firstRow = FindFirstSpanningRow( mCellData, rowIndex );
+
+  for( unsigned int row = firstRow; row < rowCount; ++row )
   {
     for( unsigned int column = 0; column < columnCount; ++column )
     {
@@ -359,6 +422,8 @@ void TableView::InsertRow( unsigned int rowIndex )
     }
   }
 
+  UpdateChildIndex( firstRow, rowCount, 0u );
+
   // Expand row data array
   mRowData.Insert( mRowData.Begin() + rowIndex, RowColumnData() );
 
@@ -380,12 +445,17 @@ void TableView::DeleteRow( unsigned int rowIndex, std::vector<Actor>& removed )
   // Delete the row
   std::vector< CellData > lost;
   mCellData.DeleteRow( rowIndex, lost );
+  RemoveLostFromChildIndex( lost );
 
   // Need to update the cell infos for the items that moved
   const unsigned int rowCount = mCellData.GetRows();
   const unsigned int columnCount = mCellData.GetColumns();
 
-  for( unsigned int row = 0; row < rowCount; ++row )
+  // Only the rows below the deleted one and the actors spanning over it change.
+  // The spanning actors all have a cell in the row above the deleted one.
+  const unsigned int firstRow = FindFirstSpanningRow( mCellData, rowIndex );
+
+  for( unsigned int row = firstRow; row < rowCount; ++row )
   {
     for( unsigned int column = 0; column < columnCount; ++column )
     {
@@ -412,6 +482,8 @@ void TableView::DeleteRow( unsigned int rowIndex, std::vector<Actor>& removed )
     }
   }
 
+  UpdateChildIndex( firstRow, rowCount, 0u );
+
   // 1 row removed, 0 columns
   RemoveAndGetLostActors( lost, removed, 1u, 0u );
 
@@ -437,9 +509,13 @@ void TableView::InsertColumn( unsigned int columnIndex )
   const unsigned int rowCount = mCellData.GetRows();
   const unsigned int columnCount = mCellData.GetColumns();
 
+  // Only the columns right of the inserted one and the actors spanning over it change.
+  // The spanning actors all have a cell in the column left of the inserted one.
+  const unsigned int firstColumn = FindFirstSpanningColumn( mCellData, columnIndex );
+
   for( unsigned int row = 0; row < rowCount; ++row )
   {
-    for( unsigned int column = 0; column < columnCount; ++column )
+    for( unsigned int column = firstColumn; column < columnCount; ++column )
     {
       Toolkit::TableView::CellPosition& position = mCellData[ row ][ column ].position;
 
@@ -461,6 +537,8 @@ void TableView::InsertColumn( unsigned int columnIndex )
     }
   }
 
+  UpdateChildIndex( 0u, rowCount, firstColumn );
+
   // Expand column data array
   mColumnData.Insert( mColumnData.Begin() + columnIndex, RowColumnData() );
 
@@ -482,14 +560,19 @@ void TableView::DeleteColumn( unsigned int columnIndex, std::vector<Actor>& remo
   // Remove the column
   std::vector< CellData > lost;
   mCellData.DeleteColumn( columnIndex, lost );
+  RemoveLostFromChildIndex( lost );
 
   // Need to update the cell infos for the items that moved
   const unsigned int rowCount = mCellData.GetRows();
   const unsigned int columnCount = mCellData.GetColumns();
 
+  // Only the columns right of the deleted one and the actors spanning over it change.
+  // The spanning actors all have a cell in the column left of the deleted one.
+  const unsigned int firstColumn = FindFirstSpanningColumn( mCellData, columnIndex );
+
   for( unsigned int row = 0; row < rowCount; ++row )
   {
-    for( unsigned int column = 0; column < columnCount; ++column )
+    for( unsigned int column = firstColumn; column < columnCount; ++column )
     {
       Toolkit::TableView::CellPosition& position = mCellData[ row ][ column ].position;
 
@@ -514,6 +597,8 @@ void TableView::DeleteColumn( unsigned int columnIndex, std::vector<Actor>& remo
     }
   }
 
+  UpdateChildIndex( 0u, rowCount, firstColumn );
+
   // 0 rows, 1 column removed
   RemoveAndGetLostActors( lost, removed, 0u, 1u );
 
@@ -815,69 +900,68 @@ void TableView::OnRelayout( const Vector2& size, RelayoutContainer& container )
     }
   }
 
-  for( unsigned int row = 0, rowCount = mCellData.GetRows(); row < rowCount; ++row )
+  // Only visit the main cell of each actor instead of walking through the whole table.
+  // An actor can be in multiple cells if its row or column span is more than 1.
+  // We however must lay out each actor only once.
+  for( auto&& child : mChildIndex )
   {
-    for( unsigned int column = 0, columnCount = mCellData.GetColumns(); column < columnCount; ++column )
+    const unsigned int row = child.second.rowIndex;
+    const unsigned int column = child.second.columnIndex;
+    CellData& cellData= mCellData[ row ][ column ];
+    Actor& actor = cellData.actor;
+    const Toolkit::TableView::CellPosition position = cellData.position;
+
+    if( actor &&  position.rowIndex == row && position.columnIndex == column )
     {
-      CellData& cellData= mCellData[ row ][ column ];
-      Actor& actor = cellData.actor;
-      const Toolkit::TableView::CellPosition position = cellData.position;
-
-      // If there is an actor and this is the main cell of the actor.
-      // An actor can be in multiple cells if its row or column span is more than 1.
-      // We however must lay out each actor only once.
-      if( actor &&  position.rowIndex == row && position.columnIndex == column )
+      // Anchor actor to top left of the cell
+      if( actor.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
       {
-        // Anchor actor to top left of the cell
-        if( actor.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
-        {
-          actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
-        }
-        actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+        actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+      }
+      actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
 
-        Padding padding = actor.GetProperty<Vector4>( Actor::Property::PADDING );
+      Padding padding = actor.GetProperty<Vector4>( Actor::Property::PADDING );
 
-        float left = (column > 0) ? mColumnData[column - 1].position : 0.f;
-        float right;
+      float left = (column > 0) ? mColumnData[column - 1].position : 0.f;
+      float right;
 
-        if( Dali::LayoutDirection::RIGHT_TO_LEFT == layoutDirection )
-        {
-          right = totalWidth - left;
-          left = right - mColumnData[column].size;
-        }
-        else
-        {
-          right = left + mColumnData[column].size;
-        }
+      if( Dali::LayoutDirection::RIGHT_TO_LEFT == layoutDirection )
+      {
+        right = totalWidth - left;
+        left = right - mColumnData[column].size;
+      }
+      else
+      {
+        right = left + mColumnData[column].size;
+      }
 
-        float top = row > 0 ? mRowData[row-1].position : 0.f;
-        float bottom = mRowData[row+position.rowSpan-1].position;
+      float top = row > 0 ? mRowData[row-1].position : 0.f;
+      float bottom = mRowData[row+position.rowSpan-1].position;
 
-        if( cellData.horizontalAlignment == HorizontalAlignment::LEFT )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  left + mPadding.width + padding.left );
-        }
-        else if( cellData.horizontalAlignment ==  HorizontalAlignment::RIGHT )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  right - mPadding.width - padding.right - actor.GetRelayoutSize( Dimension::WIDTH ) );
-        }
-        else //if( cellData.horizontalAlignment ==  HorizontalAlignment::CENTER )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  (left + right + padding.left - padding.right - actor.GetRelayoutSize( Dimension::WIDTH )) * 0.5f );
-        }
+      if( cellData.horizontalAlignment == HorizontalAlignment::LEFT )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  left + mPadding.width + padding.left );
+      }
+      else if( cellData.horizontalAlignment ==  HorizontalAlignment::RIGHT )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  right - mPadding.width - padding.right - actor.GetRelayoutSize( Dimension::WIDTH ) );
+      }
+      else //if( cellData.horizontalAlignment ==  HorizontalAlignment::CENTER )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  (left + right + padding.left - padding.right - actor.GetRelayoutSize( Dimension::WIDTH )) * 0.5f );
+      }
 
-        if( cellData.verticalAlignment == VerticalAlignment::TOP )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  top + mPadding.height + padding.top );
-        }
-        else if( cellData.verticalAlignment == VerticalAlignment::BOTTOM )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  bottom - mPadding.height - padding.bottom -  actor.GetRelayoutSize( Dimension::HEIGHT ) );
-        }
-        else //if( cellData.verticalAlignment = VerticalAlignment::CENTER )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize( Dimension::HEIGHT )) * 0.5f );
-        }
+      if( cellData.verticalAlignment == VerticalAlignment::TOP )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  top + mPadding.height + padding.top );
+      }
+      else if( cellData.verticalAlignment == VerticalAlignment::BOTTOM )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  bottom - mPadding.height - padding.bottom -  actor.GetRelayoutSize( Dimension::HEIGHT ) );
+      }
+      else //if( cellData.verticalAlignment = VerticalAlignment::CENTER )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize( Dimension::HEIGHT )) * 0.5f );
       }
     }
   }
@@ -1056,6 +1140,7 @@ void TableView::OnChildAdd( Actor& child )
             data.horizontalAlignment = horizontalAlignment;
             data.verticalAlignment = verticalAlignment;
             mCellData[ row ][ column ] = data;
+            mChildIndex[ GetActorId( child ) ] = { row, column };
 
             availableCellFound = true;
             break;
@@ -1077,6 +1162,7 @@ void TableView::OnChildAdd( Actor& child )
         data.horizontalAlignment = horizontalAlignment;
         data.verticalAlignment = verticalAlignment;
         mCellData[ rowCount ][ 0 ] = data;
+        mChildIndex[ GetActorId( child ) ] = { rowCount, 0u };
       }
 
       RelayoutRequest();
@@ -1104,6 +1190,7 @@ void TableView::OnChildRemove( Actor& child )
 TableView::TableView( unsigned int initialRows, unsigned int initialColumns )
 : Control( ControlBehaviour( CONTROL_BEHAVIOUR_DEFAULT ) ),
   mCellData( initialRows, initialColumns ),
+  mChildIndex(),
   mPreviousFocusedActor(),
   mLayoutingChild( false ),
   mRowDirty( true ),     // Force recalculation first time
@@ -1131,6 +1218,7 @@ void TableView::ResizeContainers( unsigned int rows, unsigned int columns, std::
 {
   // Resize cell data
   mCellData.Resize( rows, columns, removed );
+  RemoveLostFromChildIndex( removed );
 
   // We don't care if these go smaller, data will be regenerated or is not needed anymore
   mRowData.Resize( rows );
@@ -1188,24 +1276,68 @@ void TableView::RemoveAndGetLostActors( const std::vector<CellData>& lost, std::
 bool TableView::RemoveAllInstances( const Actor& child )
 {
   bool found = false;
-  // walk through the layout data
-  const unsigned int rowCount = mCellData.GetRows();
-  const unsigned int columnCount = mCellData.GetColumns();
-  for( unsigned int row = 0; row < rowCount; ++row )
+
+  Toolkit::TableView::CellPosition position;
+  if( FindChildPosition( child, position ) )
   {
-    for( unsigned int column = 0; column < columnCount; ++column )
+    // walk through the cells the child spans over
+    const unsigned int rowCount = std::min( position.rowIndex + position.rowSpan, mCellData.GetRows() );
+    const unsigned int columnCount = std::min( position.columnIndex + position.columnSpan, mCellData.GetColumns() );
+    for( unsigned int row = position.rowIndex; row < rowCount; ++row )
     {
-      if( mCellData[ row ][ column ].actor == child )
+      for( unsigned int column = position.columnIndex; column < columnCount; ++column )
       {
-        // clear the cell, NOTE that the cell might be spanning multiple cells
-        mCellData[ row ][ column ] = CellData();
-        found = true;
+        if( mCellData[ row ][ column ].actor == child )
+        {
+          // clear the cell, NOTE that the cell might be spanning multiple cells
+          mCellData[ row ][ column ] = CellData();
+          found = true;
+        }
       }
     }
   }
+
+  mChildIndex.erase( GetActorId( child ) );
+
   return found;
 }
 
+void TableView::UpdateChildIndex( unsigned int firstRow, unsigned int lastRow, unsigned int firstColumn )
+{
+  for( unsigned int row = firstRow; row < lastRow; ++row )
+  {
+    for( unsigned int column = firstColumn, columnCount = mCellData.GetColumns(); column < columnCount; ++column )
+    {
+      const CellData& cellData = mCellData[ row ][ column ];
+      if( cellData.actor && ( cellData.position.rowIndex == row ) && ( cellData.position.columnIndex == column ) )
+      {
+        mChildIndex[ GetActorId( cellData.actor ) ] = { row, column };
+      }
+    }
+  }
+}
+
+void TableView::RemoveLostFromChildIndex( const std::vector<CellData>& lost )
+{
+  for( auto&& cellData : lost )
+  {
+    if( cellData.actor )
+    {
+      auto iter = mChildIndex.find( GetActorId( cellData.actor ) );
+      if( iter != mChildIndex.end() )
+      {
+        // Keep the actor if its top left cell is still in the table, it may span over the lost cells
+        const CellIndex& cellIndex = iter->second;
+        if( ( cellIndex.rowIndex >= mCellData.GetRows() ) || ( cellIndex.columnIndex >= mCellData.GetColumns() ) ||
+            ( mCellData[ cellIndex.rowIndex ][ cellIndex.columnIndex ].actor != cellData.actor ) )
+        {
+          mChildIndex.erase( iter );
+        }
+      }
+    }
+  }
+}
+
 void TableView::SetHeightOrWidthProperty(TableView& tableViewImpl,
                                          void(TableView::*funcFixed)(unsigned int, float),
                                          void(TableView::*funcRelative)(unsigned int, float),
@@ -1667,30 +1799,34 @@ void TableView::CalculateFitSizes( RowColumnArray& data, Dimension::Type dimensi
 
     if( dataInstance.sizePolicy == Toolkit::TableView::FIT )
     {
-      // Find the size of the biggest actor in the row or column
-      float maxActorHeight = 0.0f;
-
-      unsigned int fitCount = ( dimension == Dimension::WIDTH ) ? mCellData.GetRows() : mCellData.GetColumns();
+      // Reset the size, it is the size of the biggest actor in the row or column
+      dataInstance.size = 0.0f;
+    }
+  }
 
-      for( unsigned int j = 0; j < fitCount; ++j )
+  // Walk through the children rather than all the cells of the FIT rows or columns
+  for( auto&& child : mChildIndex )
+  {
+    const CellData& cellData = mCellData[ child.second.rowIndex ][ child.second.columnIndex ];
+    const Actor& actor = cellData.actor;
+    if( actor )
+    {
+      if( FitToChild( actor, dimension ) && ( dimension == Dimension::WIDTH ) ? ( cellData.position.columnSpan == 1 ) : ( cellData.position.rowSpan == 1 )  )
       {
-        unsigned int row = ( dimension == Dimension::WIDTH ) ? j : i;
-        unsigned int column = ( dimension == Dimension::WIDTH ) ? i : j;
-        DALI_ASSERT_DEBUG( row < mCellData.GetRows() );
-        DALI_ASSERT_DEBUG( column < mCellData.GetColumns() );
-
-        const CellData& cellData = mCellData[ row ][ column ];
-        const Actor& actor = cellData.actor;
-        if( actor )
+        // The actor is in every row or column it spans over
+        const unsigned int first = ( dimension == Dimension::WIDTH ) ? cellData.position.columnIndex : cellData.position.rowIndex;
+        const unsigned int span = ( dimension == Dimension::WIDTH ) ? cellData.position.columnSpan : cellData.position.rowSpan;
+        const float actorSize = actor.GetRelayoutSize( dimension ) + cellPadding.x + cellPadding.y;
+
+        for( unsigned int i = first, last = std::min( first + span, dataCount ); i < last; ++i )
         {
-          if( FitToChild( actor, dimension ) && ( dimension == Dimension::WIDTH ) ? ( cellData.position.columnSpan == 1 ) : ( cellData.position.rowSpan == 1 )  )
+          RowColumnData& dataInstance = data[ i ];
+          if( dataInstance.sizePolicy == Toolkit::TableView::FIT )
           {
-            maxActorHeight = std::max( maxActorHeight, actor.GetRelayoutSize( dimension ) + cellPadding.x + cellPadding.y );
+            dataInstance.size = std::max( dataInstance.size, actorSize );
           }
         }
       }
-
-      dataInstance.size = maxActorHeight;
     }
   }
 }
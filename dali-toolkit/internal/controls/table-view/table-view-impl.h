@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
 #include <dali/public-api/object/weak-handle.h>
 
 // INTERNAL INCLUDES
@@ -332,6 +333,17 @@ public:
     VerticalAlignment::Type verticalAlignment;
   };
 
+  /**
+   * Location of the top left cell of a child
+   */
+  struct CellIndex
+  {
+    unsigned int rowIndex;
+    unsigned int columnIndex;
+  };
+
+  typedef std::unordered_map< uint32_t, CellIndex > ChildCellIndex; ///< Actor id to the top left cell of the actor
+
 private:
 
   /**
@@ -372,6 +384,20 @@ private:
    */
   bool RemoveAllInstances( const Actor& child );
 
+  /**
+   * Helper to update the child index for the actors whose top left cell lies within the given rows
+   * @param[in] firstRow The first row to update
+   * @param[in] lastRow One past the last row to update
+   * @param[in] firstColumn The first column to update
+   */
+  void UpdateChildIndex( unsigned int firstRow, unsigned int lastRow, unsigned int firstColumn );
+
+  /**
+   * Helper to remove the lost cells from the child index, unless the actor still has its top left cell in the table
+   * @param[in] lost The cells removed from the table
+   */
+  void RemoveLostFromChildIndex( const std::vector<CellData>& lost );
+
   /**
    * @brief Calculate the ratio of FILL rows/columns
    *
@@ -494,6 +520,7 @@ private:
 private: // Data
 
   Array2d<CellData> mCellData;   ///< Data for each cell: Actor, alignment settings etc
+  ChildCellIndex mChildIndex;    ///< The top left cell of each child, to avoid scanning the whole table
 
   RowColumnArray mRowData;       ///< Data for each row
   RowColumnArray mColumnData;    ///< Data for each column
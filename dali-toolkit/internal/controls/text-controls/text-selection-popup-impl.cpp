@@ -33,6 +33,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+#include <dali-toolkit/internal/controls/text-controls/text-selection-toolbar-impl.h>
 #include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/buttons/button-devel.h>
@@ -92,6 +93,24 @@ const char* const OPTION_COPY("optionCopy");
 const char* const OPTION_PASTE("optionPaste");                                    // "Paste" popup option.
 const char* const OPTION_CLIPBOARD("optionClipboard");                            // "Clipboard" popup option.
 
+const std::size_t NUMBER_OF_OPTIONS( 6u ); // CUT, COPY, PASTE, SELECT, SELECT_ALL and CLIPBOARD.
+
+/**
+ * @brief Retrieves the index of the option of the given button id, i.e. the position of its bit.
+ *
+ * @param[in] id The button id.
+ * @return The index of the option.
+ */
+std::size_t GetOptionIndex( Toolkit::TextSelectionPopup::Buttons id )
+{
+  std::size_t index = 0u;
+  for( unsigned int bits = id; bits > 1u; bits >>= 1u )
+  {
+    ++index;
+  }
+  return index;
+}
+
 const std::string IDS_LTR( "IDS_LTR" );
 const std::string RTL_DIRECTION( "RTL" );
 
@@ -145,6 +164,11 @@ Dali::Toolkit::TextSelectionPopup TextSelectionPopup::New( TextSelectionPopupCal
   return handle;
 }
 
+void TextSelectionPopup::SetCallbackInterface( TextSelectionPopupCallbackInterface* callbackInterface )
+{
+  mCallbackInterface = callbackInterface;
+}
+
 void TextSelectionPopup::SetProperty( BaseObject* object, Property::Index index, const Property::Value& value )
 {
   Toolkit::TextSelectionPopup selectionPopup = Toolkit::TextSelectionPopup::DownCast( Dali::BaseHandle( object ) );
@@ -208,6 +232,7 @@ void TextSelectionPopup::SetProperty( BaseObject* object, Property::Index index,
       case Toolkit::TextSelectionPopup::Property::POPUP_DIVIDER_COLOR:
       {
         impl.mDividerColor = value.Get< Vector4 >();
+        impl.ResetOptions();
         break;
       }
       case Toolkit::TextSelectionPopup::Property::POPUP_ICON_COLOR:
@@ -218,6 +243,7 @@ void TextSelectionPopup::SetProperty( BaseObject* object, Property::Index index,
       case Toolkit::TextSelectionPopup::Property::POPUP_PRESSED_COLOR:
       {
         impl.mPressedColor = value.Get< Vector4 >();
+        impl.ResetOptions();
         break;
       }
       case Toolkit::TextSelectionPopup::Property::POPUP_PRESSED_IMAGE:
@@ -394,7 +420,12 @@ void TextSelectionPopup::HideAnimationFinished( Animation& animation )
   if ( !mPopupShowing ) // During the Hide/Fade animation there could be a call to Show the Popup again, mPopupShowing will be true in this case.
   {
     DALI_LOG_INFO( gLogFilter, Debug::General, "TextSelectionPopup::HideAnimationFinished\n" );
-    UnparentAndReset( mToolbar );
+
+    // The toolbar and its options are kept to be shown again.
+    if( mToolbar )
+    {
+      mToolbar.Unparent();
+    }
   }
 }
 
@@ -616,6 +647,7 @@ const std::string& TextSelectionPopup::GetButtonImage( Toolkit::TextSelectionPop
 void TextSelectionPopup::SetPressedImage( const std::string& filename )
 {
   mPressedImage = filename;
+  ResetOptions();
 }
 
 std::string TextSelectionPopup::GetPressedImage() const
@@ -640,12 +672,34 @@ std::string TextSelectionPopup::GetPressedImage() const
    std::sort( mOrderListOfButtons.begin(), mOrderListOfButtons.end(), TextSelectionPopup::ButtonPriorityCompare() );
  }
 
- void TextSelectionPopup::AddOption( const ButtonRequirement& button, bool showDivider, bool showIcons, bool showCaption  )
+ Toolkit::PushButton TextSelectionPopup::GetOption( const ButtonRequirement& button, bool showIcons, bool showCaption )
  {
+   const std::size_t optionIndex = GetOptionIndex( button.id );
+   if( mOptions.empty() )
+   {
+     mOptions.resize( NUMBER_OF_OPTIONS );
+     mOptionCaptions.resize( NUMBER_OF_OPTIONS );
+   }
+
+   Toolkit::PushButton option = mOptions[optionIndex];
+   if( option )
+   {
+     // The caption may change with the language.
+     if( showCaption && ( button.caption != mOptionCaptions[optionIndex] ) )
+     {
+       Property::Map buttonLabelProperties;
+       buttonLabelProperties.Insert( Toolkit::TextVisual::Property::TEXT, button.caption );
+       option.SetProperty( Toolkit::Button::Property::LABEL, buttonLabelProperties );
+       mOptionCaptions[optionIndex] = button.caption;
+     }
+
+     return option;
+   }
+
    // 1. Create a option.
-   DALI_LOG_INFO( gLogFilter, Debug::General, "TextSelectionPopup::AddOption\n" );
+   DALI_LOG_INFO( gLogFilter, Debug::General, "TextSelectionPopup::GetOption creates the option %s\n", button.name.c_str() );
 
-   Toolkit::PushButton option = Toolkit::PushButton::New();
+   option = Toolkit::PushButton::New();
    option.SetProperty( Dali::Actor::Property::NAME, button.name );
    option.SetResizePolicy( ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS );
 
@@ -698,6 +752,7 @@ std::string TextSelectionPopup::GetPressedImage() const
      Property::Map buttonLabelProperties;
      buttonLabelProperties.Insert( Toolkit::TextVisual::Property::TEXT, button.caption );
      option.SetProperty( Toolkit::Button::Property::LABEL, buttonLabelProperties );
+     mOptionCaptions[optionIndex] = button.caption;
    }
    if( showIcons )
    {
@@ -723,21 +778,55 @@ std::string TextSelectionPopup::GetPressedImage() const
    option.SetProperty( Toolkit::Button::Property::SELECTED_BACKGROUND_VISUAL, selectedBackgroundValue );
    option.SetProperty( Toolkit::Control::Property::STYLE_NAME, TEXT_SELECTION_POPUP_BUTTON_STYLE_NAME );
 
-   // 5 Add option to tool bar
-   mToolbar.AddOption( option );
+   mOptions[optionIndex] = option;
 
-   // 6. Add the divider
-   if( showDivider )
-   {
-     const Size size( mOptionDividerSize.width, 0.0f ); // Height FILL_TO_PARENT
+   return option;
+ }
 
+ Toolkit::Control TextSelectionPopup::GetDivider( std::size_t index )
+ {
+   if( index >= mDividers.size() )
+   {
      Toolkit::Control divider = Toolkit::Control::New();
 #ifdef DECORATOR_DEBUG
      divider.SetProperty( Dali::Actor::Property::NAME,"Text's popup divider");
 #endif
-     divider.SetProperty( Actor::Property::SIZE, size );
      divider.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::HEIGHT );
      divider.SetBackgroundColor( mDividerColor  );
+     mDividers.push_back( divider );
+   }
+
+   Toolkit::Control divider = mDividers[index];
+
+   const Size size( mOptionDividerSize.width, 0.0f ); // Height FILL_TO_PARENT
+   divider.SetProperty( Actor::Property::SIZE, size );
+
+   return divider;
+ }
+
+ void TextSelectionPopup::ResetOptions()
+ {
+   // The options in the toolbar are released when the toolbar is filled again.
+   mOptions.clear();
+   mOptionCaptions.clear();
+   mDividers.clear();
+   mButtonsChanged = true;
+ }
+
+ void TextSelectionPopup::AddOption( const ButtonRequirement& button, bool showDivider, std::size_t dividerIndex, bool showIcons, bool showCaption  )
+ {
+   // 1. Get the option.
+   DALI_LOG_INFO( gLogFilter, Debug::General, "TextSelectionPopup::AddOption\n" );
+
+   Actor option = GetOption( button, showIcons, showCaption );
+
+   // 2. Add option to tool bar
+   mToolbar.AddOption( option );
+
+   // 3. Add the divider
+   if( showDivider )
+   {
+     Actor divider = GetDivider( dividerIndex );
      mToolbar.AddDivider( divider );
    }
  }
@@ -764,11 +853,14 @@ std::string TextSelectionPopup::GetPressedImage() const
    CreateOrderedListOfPopupOptions();
 
    mButtonsChanged = false;
-   UnparentAndReset( mToolbar);
 
-   if( !mToolbar )
+   if( mToolbar )
+   {
+     // Reuse the toolbar and the options, only the order of the options may change.
+     GetImpl( mToolbar ).RemoveAllOptions();
+   }
+   else
    {
-     Actor self = Self();
      mToolbar = Toolkit::TextSelectionToolbar::New();
      if ( mPopupMaxSize != Vector2::ZERO ) // If PopupMaxSize property set then apply to Toolbar. Toolbar currently is not retriving this from json
      {
@@ -778,7 +870,11 @@ std::string TextSelectionPopup::GetPressedImage() const
 #ifdef DECORATOR_DEBUG
      mToolbar.SetProperty( Dali::Actor::Property::NAME,"TextSelectionToolbar");
 #endif
-     self.Add( mToolbar );
+   }
+
+   if( !mToolbar.GetParent() )
+   {
+     Self().Add( mToolbar );
    }
 
    // Whether to mirror the list of buttons (for right to left languages)
@@ -805,7 +901,7 @@ std::string TextSelectionPopup::GetPressedImage() const
      if ( button.enabled )
      {
        numberOfOptionsAdded++;
-       AddOption(  button, ( numberOfOptionsAdded < numberOfOptionsRequired ) , showIcons, showCaptions );
+       AddOption(  button, ( numberOfOptionsAdded < numberOfOptionsRequired ), numberOfOptionsAdded - 1u, showIcons, showCaptions );
      }
    }
 
@@ -838,6 +934,10 @@ TextSelectionPopup::TextSelectionPopup( TextSelectionPopupCallbackInterface* cal
   mOptionMaxSize(),
   mOptionMinSize(),
   mOptionDividerSize(),
+  mOrderListOfButtons(),
+  mOptions(),
+  mOptionCaptions(),
+  mDividers(),
   mEnabledButtons( Toolkit::TextSelectionPopup::NONE ),
   mCallbackInterface( callbackInterface ),
   mPressedColor( DEFAULT_OPTION_PRESSED_COLOR ),
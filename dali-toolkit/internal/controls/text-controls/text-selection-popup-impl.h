@@ -95,6 +95,14 @@ public:
    */
   static Toolkit::TextSelectionPopup New( TextSelectionPopupCallbackInterface* callbackInterface );
 
+  /**
+   * @brief Sets the interface which receives the button click callbacks.
+   *
+   * Used when the popup is not created with New(), i.e. when it's acquired from the control pool.
+   * @param[in] callbackInterface The text popup callback interface.
+   */
+  void SetCallbackInterface( TextSelectionPopupCallbackInterface* callbackInterface );
+
   // Properties
 
   /**
@@ -234,7 +242,36 @@ private: // Implementation
 
   void CreateOrderedListOfPopupOptions();
 
-  void AddOption( const ButtonRequirement& button, bool showDivider, bool showIcons, bool showCaption );
+  /**
+   * @brief Retrieves the button of an option.
+   *
+   * The button is created the first time and reused every time the popup is shown.
+   *
+   * @param[in] button The option.
+   * @param[in] showIcons Whether the icon is shown.
+   * @param[in] showCaption Whether the caption is shown.
+   * @return The button of the option.
+   */
+  Toolkit::PushButton GetOption( const ButtonRequirement& button, bool showIcons, bool showCaption );
+
+  /**
+   * @brief Retrieves a divider.
+   *
+   * The dividers are created the first time and reused every time the popup is shown.
+   *
+   * @param[in] index The index of the divider in the toolbar.
+   * @return The divider.
+   */
+  Toolkit::Control GetDivider( std::size_t index );
+
+  /**
+   * @brief Discards the buttons and the dividers, i.e. when their style changes.
+   *
+   * They are created again the next time the popup is shown.
+   */
+  void ResetOptions();
+
+  void AddOption( const ButtonRequirement& button, bool showDivider, std::size_t dividerIndex, bool showIcons, bool showCaption );
 
   std::size_t GetNumberOfEnabledOptions() const;
 
@@ -284,6 +321,9 @@ private: // Data
   Size mOptionDividerSize;              // Size of divider line
 
   std::vector<ButtonRequirement> mOrderListOfButtons; // List of buttons in the order to be displayed and a flag to indicate if needed.
+  std::vector<Toolkit::PushButton> mOptions;          // The buttons of the options, indexed by the bit of the button id. Created once and reused.
+  std::vector<std::string> mOptionCaptions;           // The captions set to the buttons of the options.
+  std::vector<Toolkit::Control> mDividers;            // The dividers between the options. Created once and reused.
 
   Toolkit::TextSelectionPopup::Buttons mEnabledButtons; // stores enabled buttons
   Toolkit::TextSelectionPopupCallbackInterface* mCallbackInterface;
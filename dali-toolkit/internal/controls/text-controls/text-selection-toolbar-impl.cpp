@@ -306,6 +306,18 @@ void TextSelectionToolbar::AddDivider( Actor& divider )
   mDividerIndexes.PushBack( mIndexInTable - 1u );
 }
 
+void TextSelectionToolbar::RemoveAllOptions()
+{
+  // Shrinking the table removes the options of the lost columns.
+  mTableOfButtons.Resize( 1u, 1u );
+  mTableOfButtons.RemoveChildAt( Toolkit::TableView::CellPosition( 0u, 0u ) );
+
+  mIndexInTable = 0u;
+  mDividerIndexes.Clear();
+
+  mScrollView.ScrollTo( Vector2::ZERO, 0.f );
+}
+
 void TextSelectionToolbar::ResizeDividers( Size& size )
 {
   for( unsigned int i = 0; i < mDividerIndexes.Count(); ++i )
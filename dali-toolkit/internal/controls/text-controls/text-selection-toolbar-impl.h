@@ -75,6 +75,14 @@ public:
    */
   void AddDivider( Actor& divider );
 
+  /**
+   * @brief Removes all the options and dividers from the toolbar.
+   *
+   * The options and dividers are not destroyed if the caller keeps their handles, so they can be added again.
+   * The toolbar is scrolled back to its beginning.
+   */
+  void RemoveAllOptions();
+
   /**
    * @copydoc Toolkit::TextSelectionToolbar::ResizeDividers()
    */
@@ -33,6 +33,7 @@
 #include <dali-toolkit/devel-api/controls/tooltip/tooltip-properties.h>
 #include <dali-toolkit/public-api/visuals/text-visual-properties.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
+#include <dali-toolkit/internal/controls/control-pool/control-pool-impl.h>
 #include <dali-toolkit/internal/controls/popup/popup-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 
@@ -73,6 +74,8 @@ const char * const PROPERTY_TAIL_VISIBILITY           = "visibility";
 const char * const PROPERTY_TAIL_ABOVE_VISUAL         = "aboveVisual";
 const char * const PROPERTY_TAIL_BELOW_VISUAL         = "belowVisual";
 
+const char * const POPUP_TYPE_NAME                    = "Popup"; ///< The type of the popup in the control pool.
+
 } // unnamed namespace
 
 TooltipPtr Tooltip::New( Toolkit::Control control )
@@ -288,6 +291,13 @@ void Tooltip::SetContent( Toolkit::Control& control, const Property::Value& valu
     control.HoveredSignal().Connect( this, &Tooltip::OnHovered );
     control.SetProperty( Actor::Property::LEAVE_REQUIRED, true );
     mSignalsConnected = true;
+
+    // Keep a popup ready, so showing the tooltip doesn't create it.
+    Toolkit::ControlPool pool = Toolkit::ControlPool::Get();
+    if( pool )
+    {
+      GetImplementation( pool ).Prewarm( POPUP_TYPE_NAME, 1u );
+    }
   }
 }
 
@@ -469,7 +479,15 @@ bool Tooltip::OnTimeout()
   Toolkit::Control control = mControl.GetHandle();
   if( ! mPopup && control )
   {
-    mPopup = Toolkit::Popup::New();
+    Toolkit::ControlPool pool = Toolkit::ControlPool::Get();
+    if( pool )
+    {
+      mPopup = Toolkit::Popup::DownCast( pool.Acquire( POPUP_TYPE_NAME ) );
+    }
+    if( ! mPopup )
+    {
+      mPopup = Toolkit::Popup::New();
+    }
 
     // General set up of popup
     mPopup.SetResizePolicy( ResizePolicy::FIT_TO_CHILDREN, Dimension::ALL_DIMENSIONS );
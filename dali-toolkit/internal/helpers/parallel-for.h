@@ -0,0 +1,93 @@
+#ifndef DALI_TOOLKIT_INTERNAL_PARALLEL_FOR_H
+#define DALI_TOOLKIT_INTERNAL_PARALLEL_FOR_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Runs the function over the items, split between the available cores when there are enough of them.
+ *
+ * The calling thread processes the first range and returns once all the ranges are processed.
+ * The ranges that no thread can be created for are processed by the calling thread too.
+ *
+ * @param[in] count The number of items.
+ * @param[in] minimumItemsPerThread The minimum number of items worth a thread of their own.
+ * @param[in] function The function called with the first and past the last item of each range. It must only write data of its items.
+ */
+template< typename Function >
+void ParallelFor( uint32_t count, uint32_t minimumItemsPerThread, Function function )
+{
+  const uint32_t maximumThreadCount = std::max( std::thread::hardware_concurrency(), 1u );
+  const uint32_t threadCount = std::min( maximumThreadCount, std::max( count / std::max( minimumItemsPerThread, 1u ), 1u ) );
+  if( threadCount == 1u )
+  {
+    function( 0u, count );
+    return;
+  }
+
+  const uint32_t itemsPerThread = ( count + threadCount - 1u ) / threadCount;
+  std::vector< std::thread > threads;
+  threads.reserve( threadCount - 1u );
+
+  uint32_t begin = itemsPerThread;
+  try
+  {
+    for( ; begin < count; begin += itemsPerThread )
+    {
+      threads.emplace_back( function, begin, std::min( begin + itemsPerThread, count ) );
+    }
+  }
+  catch( const std::system_error& )
+  {
+    // Process the ranges without a thread in this thread
+  }
+
+  function( 0u, itemsPerThread );
+  for( ; begin < count; begin += itemsPerThread )
+  {
+    function( begin, std::min( begin + itemsPerThread, count ) );
+  }
+
+  for( auto&& thread : threads )
+  {
+    thread.join();
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_PARALLEL_FOR_H
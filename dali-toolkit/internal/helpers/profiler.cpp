@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/helpers/profiler.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace Profiler
+{
+
+bool gEnabled = false;
+
+namespace
+{
+
+const uint32_t DEFAULT_CAPACITY = 4096u;
+
+struct Counter
+{
+  uint32_t count;
+  uint64_t totalDuration;
+  uint32_t maxDuration;
+};
+
+struct RecordedEvent
+{
+  const char*        name;
+  const std::string* controlType; ///< A key of the counters, or nullptr
+  uint64_t           start;
+  uint32_t           duration;
+};
+
+/**
+ * @brief The scopes recorded on the event thread.
+ */
+struct Recorder
+{
+  Recorder()
+  : events(),
+    counters(),
+    capacity( DEFAULT_CAPACITY ),
+    next( 0u ),
+    count( 0u )
+  {
+  }
+
+  std::vector< RecordedEvent >               events;   ///< The ring buffer, allocated by the first scope
+  std::unordered_map< std::string, Counter > counters; ///< The counters by control type name
+  uint32_t                                   capacity;
+  uint32_t                                   next;     ///< The index the next scope is written to
+  uint32_t                                   count;    ///< The number of scopes in the ring buffer
+};
+
+Recorder& GetRecorder()
+{
+  static Recorder recorder;
+  return recorder;
+}
+
+void AppendString( std::ostringstream& stream, const char* string )
+{
+  stream << '"';
+  for( const char* character = string; *character != '\0'; ++character )
+  {
+    if( *character == '"' || *character == '\\' )
+    {
+      stream << '\\';
+    }
+    stream << *character;
+  }
+  stream << '"';
+}
+
+} // unnamed namespace
+
+uint64_t GetTime()
+{
+  return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+void Record( const char* name, const BaseHandle& handle, uint64_t start, uint64_t end )
+{
+  Recorder& recorder = GetRecorder();
+  const uint32_t duration = static_cast< uint32_t >( std::min< uint64_t >( end - start, std::numeric_limits< uint32_t >::max() ) );
+
+  const std::string* controlType = nullptr;
+  if( handle )
+  {
+    const std::string& typeName = handle.GetTypeName();
+    auto iter = recorder.counters.find( typeName );
+    if( iter == recorder.counters.end() )
+    {
+      iter = recorder.counters.insert( std::make_pair( typeName, Counter{ 0u, 0u, 0u } ) ).first;
+    }
+
+    Counter& counter = iter->second;
+    ++counter.count;
+    counter.totalDuration += duration;
+    counter.maxDuration = std::max( counter.maxDuration, duration );
+
+    controlType = &iter->first;
+  }
+
+  if( recorder.capacity > 0u )
+  {
+    if( recorder.events.empty() )
+    {
+      recorder.events.resize( recorder.capacity );
+    }
+
+    recorder.events[ recorder.next ] = { name, controlType, start, duration };
+    recorder.next = ( recorder.next + 1u ) % recorder.capacity;
+    recorder.count = std::min( recorder.count + 1u, recorder.capacity );
+  }
+}
+
+void Enable( bool enable )
+{
+#if defined( PROFILING_ENABLED )
+  gEnabled = enable;
+#else
+  DALI_LOG_ERROR( "The toolkit is built without the profiler\n" );
+#endif
+}
+
+void SetCapacity( uint32_t capacity )
+{
+  Recorder& recorder = GetRecorder();
+  recorder.capacity = capacity;
+  recorder.events.clear();
+  recorder.events.shrink_to_fit();
+  recorder.next = 0u;
+  recorder.count = 0u;
+}
+
+std::vector< Toolkit::Profiler::Event > GetEvents()
+{
+  const Recorder& recorder = GetRecorder();
+
+  std::vector< Toolkit::Profiler::Event > events;
+  events.reserve( recorder.count );
+
+  // The oldest scope is the one which will be overwritten next
+  const uint32_t first = ( recorder.next + recorder.capacity - recorder.count ) % std::max( recorder.capacity, 1u );
+  for( uint32_t i = 0u; i < recorder.count; ++i )
+  {
+    const RecordedEvent& event = recorder.events[ ( first + i ) % recorder.capacity ];
+    events.push_back( { event.name, event.controlType ? *event.controlType : std::string(), event.start, event.duration } );
+  }
+  return events;
+}
+
+std::vector< Toolkit::Profiler::ControlTypeCounter > GetControlTypeCounters()
+{
+  std::vector< Toolkit::Profiler::ControlTypeCounter > counters;
+  for( auto&& counter : GetRecorder().counters )
+  {
+    counters.push_back( { counter.first, counter.second.count, counter.second.totalDuration, counter.second.maxDuration } );
+  }
+
+  std::sort( counters.begin(), counters.end(),
+             []( const Toolkit::Profiler::ControlTypeCounter& lhs, const Toolkit::Profiler::ControlTypeCounter& rhs ) { return lhs.totalDuration > rhs.totalDuration; } );
+  return counters;
+}
+
+std::string GetChromeTrace()
+{
+  std::ostringstream stream;
+  stream << "{\"traceEvents\":[";
+
+  bool first = true;
+  for( auto&& event : GetEvents() )
+  {
+    stream << ( first ? "" : "," ) << "{\"name\":";
+    AppendString( stream, event.name.c_str() );
+    stream << ",\"cat\":\"dali-toolkit\",\"ph\":\"X\",\"ts\":" << event.start << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":1";
+    if( !event.controlType.empty() )
+    {
+      stream << ",\"args\":{\"control\":";
+      AppendString( stream, event.controlType.c_str() );
+      stream << "}";
+    }
+    stream << "}";
+    first = false;
+  }
+
+  stream << "],\"displayTimeUnit\":\"ms\"}";
+  return stream.str();
+}
+
+bool WriteChromeTrace( const std::string& filename )
+{
+  std::ofstream file( filename.c_str(), std::ios::out | std::ios::trunc );
+  if( !file.is_open() )
+  {
+    DALI_LOG_ERROR( "Can't open %s to write the trace\n", filename.c_str() );
+    return false;
+  }
+
+  file << GetChromeTrace();
+  return file.good();
+}
+
+void Clear()
+{
+  Recorder& recorder = GetRecorder();
+  recorder.next = 0u;
+  recorder.count = 0u;
+  recorder.counters.clear();
+}
+
+} // namespace Profiler
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,192 @@
+#ifndef DALI_TOOLKIT_INTERNAL_PROFILER_H
+#define DALI_TOOLKIT_INTERNAL_PROFILER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/utility/profiler.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace Profiler
+{
+
+/**
+ * @brief Whether the scopes are recorded, set by Toolkit::Profiler::Enable().
+ */
+extern bool gEnabled;
+
+/**
+ * @brief Gets the time of the event thread clock.
+ * @return The time in microseconds
+ */
+uint64_t GetTime();
+
+/**
+ * @brief Records a scope into the ring buffer and the counter of the control type, if any.
+ *
+ * @param[in] name The name of the scope, which must outlive the profiler, e.g. a string literal
+ * @param[in] handle The control the scope is attributed to, or an empty handle
+ * @param[in] start The start time in microseconds
+ * @param[in] end The end time in microseconds
+ */
+void Record( const char* name, const BaseHandle& handle, uint64_t start, uint64_t end );
+
+/**
+ * @copydoc Toolkit::Profiler::Enable()
+ */
+void Enable( bool enable );
+
+/**
+ * @copydoc Toolkit::Profiler::SetCapacity()
+ */
+void SetCapacity( uint32_t capacity );
+
+/**
+ * @copydoc Toolkit::Profiler::GetEvents()
+ */
+std::vector< Toolkit::Profiler::Event > GetEvents();
+
+/**
+ * @copydoc Toolkit::Profiler::GetControlTypeCounters()
+ */
+std::vector< Toolkit::Profiler::ControlTypeCounter > GetControlTypeCounters();
+
+/**
+ * @copydoc Toolkit::Profiler::GetChromeTrace()
+ */
+std::string GetChromeTrace();
+
+/**
+ * @copydoc Toolkit::Profiler::WriteChromeTrace()
+ */
+bool WriteChromeTrace( const std::string& filename );
+
+/**
+ * @copydoc Toolkit::Profiler::Clear()
+ */
+void Clear();
+
+/**
+ * @brief Measures the lifetime of a scope on the event thread.
+ *
+ * Nothing is measured while the profiler is disabled, which costs a single flag check.
+ * Use the DALI_TOOLKIT_PROFILE_SCOPE macros, so the scopes are removed unless PROFILING_ENABLED is defined.
+ */
+class Scope
+{
+public:
+
+  /**
+   * @brief Starts measuring a scope.
+   * @param[in] name The name of the scope, which must outlive the profiler, e.g. a string literal
+   */
+  explicit Scope( const char* name )
+  : mName( name ),
+    mHandle(),
+    mStart( gEnabled ? GetTime() : 0u ),
+    mActive( gEnabled )
+  {
+  }
+
+  /**
+   * @brief Starts measuring a scope attributed to the type of a control.
+   * @param[in] name The name of the scope, which must outlive the profiler, e.g. a string literal
+   * @param[in] handle The control
+   */
+  Scope( const char* name, const BaseHandle& handle )
+  : mName( name ),
+    mHandle( handle ),
+    mStart( gEnabled ? GetTime() : 0u ),
+    mActive( gEnabled )
+  {
+  }
+
+  /**
+   * @brief Records the scope.
+   */
+  ~Scope()
+  {
+    if( mActive )
+    {
+      Record( mName, mHandle, mStart, GetTime() );
+    }
+  }
+
+private:
+
+  // Undefined
+  Scope( const Scope& ) = delete;
+
+  // Undefined
+  Scope& operator=( const Scope& ) = delete;
+
+private:
+
+  const char* mName;
+  BaseHandle  mHandle;
+  uint64_t    mStart;
+  bool        mActive;
+};
+
+} // namespace Profiler
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#if defined( PROFILING_ENABLED )
+
+#define DALI_TOOLKIT_PROFILE_CONCATENATE_IMPL( a, b ) a##b
+#define DALI_TOOLKIT_PROFILE_CONCATENATE( a, b ) DALI_TOOLKIT_PROFILE_CONCATENATE_IMPL( a, b )
+
+/**
+ * @brief Measures the rest of the enclosing scope.
+ */
+#define DALI_TOOLKIT_PROFILE_SCOPE( name ) \
+  Dali::Toolkit::Internal::Profiler::Scope DALI_TOOLKIT_PROFILE_CONCATENATE( profilerScope, __LINE__ )( name )
+
+/**
+ * @brief Measures the rest of the enclosing scope and adds it to the counter of the type of the control.
+ *
+ * The handle expression is only evaluated while the profiler is enabled.
+ */
+#define DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE( name, handle ) \
+  Dali::Toolkit::Internal::Profiler::Scope DALI_TOOLKIT_PROFILE_CONCATENATE( profilerScope, __LINE__ )( name, Dali::Toolkit::Internal::Profiler::gEnabled ? Dali::BaseHandle( handle ) : Dali::BaseHandle() )
+
+#else
+
+#define DALI_TOOLKIT_PROFILE_SCOPE( name )
+#define DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE( name, handle )
+
+#endif
+
+#endif // DALI_TOOLKIT_INTERNAL_PROFILER_H
@@ -34,11 +34,21 @@ namespace Internal
 namespace
 {
 
+// The number of nodes allocated at once by the node pool
+const uint32_t NODES_PER_BLOCK( 64u );
+
 bool ApproximatelyEqual( uint32_t a, uint32_t b  )
 {
   return std::abs( static_cast<int32_t>( a - b ) ) <= 1;
 }
 
+// Whether the position is inside the area, allowing the same error as ApproximatelyEqual
+bool ApproximatelyContains( const AtlasPacker::RectArea& area, uint32_t x, uint32_t y )
+{
+  return x + 1u >= area.x && x <= area.x + area.width + 1u
+      && y + 1u >= area.y && y <= area.y + area.height + 1u;
+}
+
 uint16_t MaxDimension( const Uint16Pair& dimensions )
 {
   return dimensions.GetWidth() >= dimensions.GetHeight() ? dimensions.GetWidth() : dimensions.GetHeight();
@@ -53,6 +63,15 @@ void Swap( Uint16Pair& first, Uint16Pair& second )
 
 }
 
+AtlasPacker::Node::Node()
+: rectArea(),
+  parent( NULL ),
+  occupied( false )
+{
+  child[0] = NULL;
+  child[1] = NULL;
+}
+
 AtlasPacker::Node::Node( Node* parent, SizeType x, SizeType y, SizeType width, SizeType height  )
 : rectArea( x, y, width, height ),
   parent(parent),
@@ -63,25 +82,54 @@ AtlasPacker::Node::Node( Node* parent, SizeType x, SizeType y, SizeType width, S
 }
 
 AtlasPacker:: AtlasPacker( SizeType atlasWidth, SizeType atlasHeight )
-: mAvailableArea( atlasWidth * atlasHeight )
+: mRoot( NULL ),
+  mAvailableArea( atlasWidth * atlasHeight ),
+  mPackingPolicy( FIRST_FIT ),
+  mNodeBlocks(),
+  mFreeNodes()
 {
-  mRoot = new Node( NULL, 0u, 0u, atlasWidth, atlasHeight );
+  mRoot = NewNode( NULL, 0u, 0u, atlasWidth, atlasHeight );
 }
 
 AtlasPacker::~AtlasPacker()
 {
-  DeleteNode( mRoot );
+  for( auto&& block : mNodeBlocks )
+  {
+    delete[] block;
+  }
 }
 
 bool AtlasPacker::Pack( SizeType blockWidth, SizeType blockHeight,
                         SizeType& packPositionX, SizeType& packPositionY)
 {
-  Node* firstFit = InsertNode( mRoot, blockWidth, blockHeight );
-  if( firstFit != NULL )
+  // no node can be big enough, avoid searching the whole tree
+  if( blockWidth * blockHeight > mAvailableArea )
+  {
+    return false;
+  }
+
+  Node* fit = NULL;
+  if( mPackingPolicy == BEST_FIT )
+  {
+    SizeType bestShortSide = 0u;
+    SizeType bestArea = 0u;
+    SearchBestFitNode( mRoot, blockWidth, blockHeight, fit, bestShortSide, bestArea );
+    if( fit != NULL )
+    {
+      // split the free node if it is bigger than the block
+      fit = InsertNode( fit, blockWidth, blockHeight );
+    }
+  }
+  else
   {
-    firstFit->occupied = true;
-    packPositionX = firstFit->rectArea.x;
-    packPositionY = firstFit->rectArea.y;
+    fit = InsertNode( mRoot, blockWidth, blockHeight );
+  }
+
+  if( fit != NULL )
+  {
+    fit->occupied = true;
+    packPositionX = fit->rectArea.x;
+    packPositionY = fit->rectArea.y;
     mAvailableArea -= blockWidth*blockHeight;
     return true;
   }
@@ -103,6 +151,16 @@ unsigned int AtlasPacker::GetAvailableArea() const
   return mAvailableArea;
 }
 
+void AtlasPacker::SetPackingPolicy( PackingPolicy policy )
+{
+  mPackingPolicy = policy;
+}
+
+AtlasPacker::PackingPolicy AtlasPacker::GetPackingPolicy() const
+{
+  return mPackingPolicy;
+}
+
 AtlasPacker::Node* AtlasPacker::InsertNode( Node* root, SizeType blockWidth, SizeType blockHeight )
 {
   if( root == NULL )
@@ -139,6 +197,38 @@ AtlasPacker::Node* AtlasPacker::InsertNode( Node* root, SizeType blockWidth, Siz
   return InsertNode( root->child[0], blockWidth, blockHeight);
 }
 
+void AtlasPacker::SearchBestFitNode( Node* node, SizeType blockWidth, SizeType blockHeight,
+                                     Node*& bestNode, SizeType& bestShortSide, SizeType& bestArea )
+{
+  if( node == NULL )
+  {
+    return;
+  }
+
+  if( node->occupied )
+  {
+    SearchBestFitNode( node->child[0], blockWidth, blockHeight, bestNode, bestShortSide, bestArea );
+    SearchBestFitNode( node->child[1], blockWidth, blockHeight, bestNode, bestShortSide, bestArea );
+    return;
+  }
+
+  if( node->rectArea.width < blockWidth || node->rectArea.height < blockHeight )
+  {
+    return;
+  }
+
+  SizeType remainingWidth = node->rectArea.width - blockWidth;
+  SizeType remainingHeight = node->rectArea.height - blockHeight;
+  SizeType shortSide = remainingWidth < remainingHeight ? remainingWidth : remainingHeight;
+  SizeType area = node->rectArea.width * node->rectArea.height;
+  if( bestNode == NULL || shortSide < bestShortSide || ( shortSide == bestShortSide && area < bestArea ) )
+  {
+    bestNode = node;
+    bestShortSide = shortSide;
+    bestArea = area;
+  }
+}
+
 void AtlasPacker::SplitNode( Node* node, SizeType blockWidth, SizeType blockHeight )
 {
   node->occupied = true;
@@ -149,13 +239,13 @@ void AtlasPacker::SplitNode( Node* node, SizeType blockWidth, SizeType blockHeig
 
   if( remainingWidth > remainingHeight ) // split vertically
   {
-    node->child[0] = new Node( node, node->rectArea.x, node->rectArea.y, blockWidth, node->rectArea.height  );
-    node->child[1] = new Node( node, node->rectArea.x+blockWidth, node->rectArea.y, node->rectArea.width-blockWidth, node->rectArea.height );
+    node->child[0] = NewNode( node, node->rectArea.x, node->rectArea.y, blockWidth, node->rectArea.height  );
+    node->child[1] = NewNode( node, node->rectArea.x+blockWidth, node->rectArea.y, node->rectArea.width-blockWidth, node->rectArea.height );
   }
   else // split horizontally
   {
-    node->child[0] = new Node( node, node->rectArea.x, node->rectArea.y, node->rectArea.width, blockHeight  );
-    node->child[1] = new Node( node, node->rectArea.x, node->rectArea.y+blockHeight, node->rectArea.width, node->rectArea.height-blockHeight );
+    node->child[0] = NewNode( node, node->rectArea.x, node->rectArea.y, node->rectArea.width, blockHeight  );
+    node->child[1] = NewNode( node, node->rectArea.x, node->rectArea.y+blockHeight, node->rectArea.width, node->rectArea.height-blockHeight );
   }
 }
 
@@ -165,8 +255,13 @@ AtlasPacker::Node* AtlasPacker::SearchNode( Node* node, SizeType packPositionX,
   {
     if( node->child[0] != NULL) //not a leaf
     {
-      Node* newNode = SearchNode(node->child[0], packPositionX, packPositionY, blockWidth, blockHeight);
-      if( newNode == NULL )// try search from the second child.
+      // The children partition the area of the node, only search the ones containing the position.
+      Node* newNode = NULL;
+      if( ApproximatelyContains( node->child[0]->rectArea, packPositionX, packPositionY ) )
+      {
+        newNode = SearchNode(node->child[0], packPositionX, packPositionY, blockWidth, blockHeight);
+      }
+      if( newNode == NULL && ApproximatelyContains( node->child[1]->rectArea, packPositionX, packPositionY ) )// try search from the second child.
       {
         newNode = SearchNode(node->child[1], packPositionX, packPositionY, blockWidth, blockHeight);
       }
@@ -189,23 +284,37 @@ void AtlasPacker::MergeToNonOccupied( Node* node )
   // both child are not occupied, merge the space to parent
   if( parent != NULL && parent->child[0]->occupied == false && parent->child[1]->occupied == false)
   {
-    delete parent->child[0];
+    ReleaseNode( parent->child[0] );
     parent->child[0] = NULL;
-    delete parent->child[1];
+    ReleaseNode( parent->child[1] );
     parent->child[1] = NULL;
 
     MergeToNonOccupied( parent );
   }
 }
 
-void AtlasPacker::DeleteNode( Node *node )
+AtlasPacker::Node* AtlasPacker::NewNode( Node* parent, SizeType x, SizeType y, SizeType width, SizeType height )
 {
-  if( node != NULL )
+  if( mFreeNodes.Empty() )
   {
-    DeleteNode( node->child[0] );
-    DeleteNode( node->child[1] );
-    delete node;
+    Node* block = new Node[NODES_PER_BLOCK];
+    mNodeBlocks.PushBack( block );
+    mFreeNodes.Reserve( mFreeNodes.Count() + NODES_PER_BLOCK );
+    for( uint32_t i = NODES_PER_BLOCK; i > 0u; --i )
+    {
+      mFreeNodes.PushBack( block + i - 1u );
+    }
   }
+
+  Node* node = mFreeNodes[mFreeNodes.Count() - 1u];
+  mFreeNodes.Erase( mFreeNodes.End() - 1u );
+  *node = Node( parent, x, y, width, height );
+  return node;
+}
+
+void AtlasPacker::ReleaseNode( Node* node )
+{
+  mFreeNodes.PushBack( node );
 }
 
 Uint16Pair AtlasPacker::GroupPack( const Dali::Vector<Uint16Pair>& blockSizes, Dali::Vector<Uint16Pair>& packPositions )
@@ -282,19 +391,19 @@ void AtlasPacker::GrowNode( SizeType blockWidth, SizeType blockHeight )
 
   if( shouldGrowRight || ( canGrowRight && !shouldGrowDown ) )
   {
-    Node* newRoot = new Node( NULL, 0u, 0u, mRoot->rectArea.width+blockWidth, mRoot->rectArea.height );
+    Node* newRoot = NewNode( NULL, 0u, 0u, mRoot->rectArea.width+blockWidth, mRoot->rectArea.height );
     newRoot->occupied = true;
     newRoot->child[0] = mRoot;
-    newRoot->child[1] = new Node( newRoot, mRoot->rectArea.width, 0u, blockWidth, mRoot->rectArea.height );
+    newRoot->child[1] = NewNode( newRoot, mRoot->rectArea.width, 0u, blockWidth, mRoot->rectArea.height );
 
     mRoot = newRoot;
   }
   else if( shouldGrowDown || ( canGrowDown && !shouldGrowRight ) )
   {
-    Node* newRoot = new Node( NULL, 0u, 0u, mRoot->rectArea.width, mRoot->rectArea.height+blockHeight );
+    Node* newRoot = NewNode( NULL, 0u, 0u, mRoot->rectArea.width, mRoot->rectArea.height+blockHeight );
     newRoot->occupied = true;
     newRoot->child[0] = mRoot;
-    newRoot->child[1] = new Node( newRoot, 0u, mRoot->rectArea.height, mRoot->rectArea.width, blockHeight );
+    newRoot->child[1] = NewNode( newRoot, 0u, mRoot->rectArea.height, mRoot->rectArea.width, blockHeight );
 
     mRoot = newRoot;
   }
@@ -33,8 +33,10 @@ namespace Internal
 
 /**
  * Binary space tree based bin packing algorithm.
- * It is initialised with a fixed width and height and will fit each block into the first node where it fits
+ * It is initialised with a fixed width and height and will fit each block into the first node where it fits,
+ * or into the free node leaving the shortest remaining side with the BEST_FIT policy,
  * and then split that node into 2 parts (down and right) to track the remaining empty space.
+ * The nodes are allocated in blocks and reused once merged back, rather than allocated one by one.
  */
 class AtlasPacker
 {
@@ -46,11 +48,22 @@ public:
   typedef uint32_t SizeType;
   typedef Rect<SizeType> RectArea;
 
+  /**
+   * The policy choosing the free node to pack a block into.
+   */
+  enum PackingPolicy
+  {
+    FIRST_FIT, ///< The first free node found where the block fits
+    BEST_FIT   ///< The free node where the block leaves the shortest remaining side, fragmenting the atlas less
+  };
+
   /**
    * Tree node.
    */
   struct Node
   {
+    Node();
+
     Node( Node* parent, SizeType x, SizeType y, SizeType width, SizeType height );
 
     RectArea rectArea;
@@ -101,6 +114,20 @@ public:
    */
   unsigned int GetAvailableArea() const;
 
+  /**
+   * Set the policy choosing the free node to pack the blocks into.
+   *
+   * @param[in] policy The packing policy, FIRST_FIT by default.
+   */
+  void SetPackingPolicy( PackingPolicy policy );
+
+  /**
+   * Query the policy choosing the free node to pack the blocks into.
+   *
+   * @return The packing policy.
+   */
+  PackingPolicy GetPackingPolicy() const;
+
   /**
    * Pack a group of blocks with different sizes, calculate the required packing size and the position of each block.
    * @param[in] blockSizes The size list of the blocks .
@@ -122,6 +149,19 @@ private:
    */
   Node* InsertNode( Node* root, SizeType blockWidth, SizeType blockHeight );
 
+  /**
+   * Search the free node where the block leaves the shortest remaining side, then the smallest remaining area.
+   *
+   * @param[in] node The root node of the subtree to be searched.
+   * @param[in] blockWidth The width of the block to pack.
+   * @param[in] blockHeight The height of the block to pack.
+   * @param[in,out] bestNode The best node found so far, NULL if none.
+   * @param[in,out] bestShortSide The shortest remaining side of the best node found so far.
+   * @param[in,out] bestArea The remaining area of the best node found so far.
+   */
+  void SearchBestFitNode( Node* node, SizeType blockWidth, SizeType blockHeight,
+                          Node*& bestNode, SizeType& bestShortSide, SizeType& bestArea );
+
   /**
    * Split the node into two to fit the block width/size.
    *
@@ -150,11 +190,23 @@ private:
   void MergeToNonOccupied( Node* node );
 
   /**
-   * Delete a node and its subtree.
+   * Get a node from the pool, allocating a new block of nodes if none is free.
+   *
+   * @param[in] parent The parent of the node.
+   * @param[in] x The x coordinate of the node area.
+   * @param[in] y The y coordinate of the node area.
+   * @param[in] width The width of the node area.
+   * @param[in] height The height of the node area.
+   * @return The node.
+   */
+  Node* NewNode( Node* parent, SizeType x, SizeType y, SizeType width, SizeType height );
+
+  /**
+   * Return a node to the pool.
    *
-   * @parm[in] node The node to delete.
+   * @parm[in] node The node to release.
    */
-  void DeleteNode( Node* node );
+  void ReleaseNode( Node* node );
 
   /**
    * Pack a block into the atlas. If there is no enough room, grow the partition tree.
@@ -185,6 +237,10 @@ private:
 
   Node* mRoot; ///< The root of the binary space tree
   unsigned int mAvailableArea;
+  PackingPolicy mPackingPolicy;
+
+  Dali::Vector<Node*> mNodeBlocks; ///< The blocks of nodes owned by the pool
+  Dali::Vector<Node*> mFreeNodes;  ///< The nodes of the pool not in the tree
 
 };
 
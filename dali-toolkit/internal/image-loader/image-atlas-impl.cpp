@@ -133,6 +133,11 @@ void ImageAtlas::SetBrokenImage( const std::string& brokenImageUrl )
   }
 }
 
+void ImageAtlas::SetPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy )
+{
+  mPacker.SetPackingPolicy( policy == Toolkit::ImageAtlas::BEST_FIT ? AtlasPacker::BEST_FIT : AtlasPacker::FIRST_FIT );
+}
+
 bool ImageAtlas::Upload( Vector4& textureRect,
                          const std::string& url,
                          ImageDimensions size,
@@ -78,6 +78,11 @@ public:
    */
   void SetBrokenImage( const std::string& brokenImageUrl );
 
+  /**
+   * @copydoc Toolkit::ImageAtlas::SetPackingPolicy
+   */
+  void SetPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy );
+
   /**
    * @copydoc Toolkit::ImageAtlas::Upload( Vector4&, const std::string&, ImageDimensions,FittingMode::Type, bool )
    */
@@ -110,6 +110,7 @@ StyleManager::StyleManager()
 : mDefaultFontSize( -1 ),
   mDefaultFontFamily(""),
   mDefaultThemeFilePath(),
+  mThemeChanging( false ),
   mFeedbackStyle( nullptr )
 {
   // Add theme builder constants
@@ -140,11 +141,13 @@ StyleManager::~StyleManager()
 void StyleManager::ApplyTheme( const std::string& themeFile )
 {
   SetTheme( themeFile );
+  mPreviousThemeBuilder.Reset();
 }
 
 void StyleManager::ApplyDefaultTheme()
 {
   SetTheme(mDefaultThemeFilePath);
+  mPreviousThemeBuilder.Reset();
 }
 
 const std::string& StyleManager::GetDefaultFontFamily() const
@@ -178,7 +181,14 @@ void StyleManager::ApplyThemeStyle( Toolkit::Control control )
 
   if( mThemeBuilder )
   {
-    ApplyStyle( mThemeBuilder, control );
+    if( mThemeChanging && mPreviousThemeBuilder )
+    {
+      ApplyThemeStyleChanges( control );
+    }
+    else
+    {
+      ApplyStyle( mThemeBuilder, control );
+    }
   }
 }
 
@@ -246,9 +256,15 @@ void StyleManager::SetTheme( const std::string& themeFile )
   if( ! mThemeBuilder || mThemeFile.empty() || mThemeFile.compare( themeFile ) != 0 )
   {
     loading = true;
+    mPreviousThemeBuilder = mThemeBuilder;
     mThemeBuilder = CreateBuilder( mThemeBuilderConstants );
     themeLoaded = LoadJSON( mThemeBuilder, mDefaultThemeFilePath ); // Sets themeLoaded to true if theme exists
   }
+  else
+  {
+    // The theme is merged again into the current builder, the controls are styled again entirely
+    mPreviousThemeBuilder.Reset();
+  }
 
   if( themeFile.compare(mDefaultThemeFilePath) != 0 )
   {
@@ -275,6 +291,7 @@ void StyleManager::SetTheme( const std::string& themeFile )
     {
       // We tried to load a theme, but it failed. Ensure the builder is reset
       mThemeBuilder.Reset();
+      mPreviousThemeBuilder.Reset();
       mThemeFile.clear();
     }
   }
@@ -450,6 +467,45 @@ void StyleManager::ApplyStyle( Toolkit::Builder builder, Toolkit::Control contro
   }
 }
 
+/**
+ * @brief Apply a style to a control which is styled by the previous builder.
+ *
+ * @param[in] builder The builder to apply the style from
+ * @param[in] previousBuilder The builder which styled the control
+ * @param[in] styleName The name of the style
+ * @param[in] control The control to apply the style to
+ */
+static void ApplyStyleChanges( Toolkit::Builder builder, Toolkit::Builder previousBuilder, const std::string& styleName, Toolkit::Control control )
+{
+  // The previous builder records the style when it styles a control
+  const StylePtr previousStyle = GetImpl( previousBuilder ).GetStyle( styleName );
+  if( previousStyle )
+  {
+    GetImpl( builder ).ApplyStyleChanges( styleName, control, *previousStyle );
+  }
+  else
+  {
+    builder.ApplyStyle( styleName, control );
+  }
+}
+
+void StyleManager::ApplyThemeStyleChanges( Toolkit::Control control )
+{
+  std::string styleName = control.GetStyleName();
+  if( GetStyleNameForControl( mThemeBuilder, control, styleName ) )
+  {
+    ApplyStyleChanges( mThemeBuilder, mPreviousThemeBuilder, styleName, control );
+  }
+
+  if( mDefaultFontSize >= 0 )
+  {
+    // Apply the style for logical font size
+    std::stringstream fontSizeQualifier;
+    fontSizeQualifier << styleName << FONT_SIZE_QUALIFIER << mDefaultFontSize;
+    ApplyStyleChanges( mThemeBuilder, mPreviousThemeBuilder, fontSizeQualifier.str(), control );
+  }
+}
+
 const StylePtr StyleManager::GetRecordedStyle( Toolkit::Control control )
 {
   if( mThemeBuilder )
@@ -504,6 +560,9 @@ void StyleManager::StyleMonitorChange( StyleMonitor styleMonitor, StyleChange::T
     }
   }
   EmitStyleChangeSignals( styleChange );
+
+  // The theme change is complete
+  mPreviousThemeBuilder.Reset();
 }
 
 void StyleManager::EmitStyleChangeSignals( StyleChange::Type styleChange )
@@ -511,7 +570,10 @@ void StyleManager::EmitStyleChangeSignals( StyleChange::Type styleChange )
   Toolkit::StyleManager styleManager = StyleManager::Get();
 
   // Update Controls first
+  // After a theme change, the controls only apply what differs from the styles of the previous theme
+  mThemeChanging = ( styleChange == StyleChange::THEME_CHANGE );
   mControlStyleChangeSignal.Emit( styleManager, styleChange );
+  mThemeChanging = false;
 
   // Inform application last
   mStyleChangedSignal.Emit( styleManager, styleChange );
@@ -184,6 +184,16 @@ private:
    */
   void ApplyStyle( Toolkit::Builder builder, Toolkit::Control control );
 
+  /**
+   * @brief Apply the theme style of a control, which is already styled by the previous theme.
+   *
+   * Only the visuals and properties which differ between the styles of the two themes, or which
+   * the application has changed since the previous theme was applied, are applied.
+   *
+   * @param[in] control The control to apply style.
+   */
+  void ApplyThemeStyleChanges( Toolkit::Control control );
+
   /**
    * Search for a builder in the cache
    *
@@ -225,6 +235,7 @@ private:
   typedef std::map< std::string, Toolkit::Builder > BuilderMap;
 
   Toolkit::Builder mThemeBuilder;     ///< Builder for all default theme properties
+  Toolkit::Builder mPreviousThemeBuilder; ///< Builder of the previous theme, to apply only the styles changed by a theme change
   StyleMonitor mStyleMonitor;         ///< Style monitor handle
 
   int mDefaultFontSize;               ///< Logical size, not a point-size
@@ -237,6 +248,8 @@ private:
 
   BuilderMap mBuilderCache;           ///< Cache of builders keyed by JSON file name
 
+  bool mThemeChanging;                ///< Whether the controls are being styled after a theme change
+
   Toolkit::Internal::FeedbackStyle* mFeedbackStyle; ///< Feedback style
 
   // Signals
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/text/cursor-helper-functions.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
@@ -124,6 +125,56 @@ void FindEndOfWord( FindWordData& data )
   }
 }
 
+/**
+ * @brief Finds the character of a left to right line from where the touch point is hit tested.
+ *
+ * The pen position of the glyphs increases along the line, so the glyphs before the last glyph
+ * starting before the touch point can't be hit and are skipped with a binary search.
+ *
+ * @param[in] line The line.
+ * @param[in] glyphInfoBuffer The glyphs.
+ * @param[in] positionsBuffer The positions of the glyphs.
+ * @param[in] glyphsToCharactersBuffer The glyph to character conversion table.
+ * @param[in] visualX The touch point 'x' in line's coords.
+ *
+ * @return The first character of the last glyph starting before the touch point, or the first character of the line.
+ */
+Dali::Toolkit::Text::CharacterIndex FindFirstCharacterToHitTest( const Dali::Toolkit::Text::LineRun& line,
+                                                                 const Dali::Toolkit::Text::GlyphInfo* const glyphInfoBuffer,
+                                                                 const Dali::Vector2* const positionsBuffer,
+                                                                 const Dali::Toolkit::Text::CharacterIndex* const glyphsToCharactersBuffer,
+                                                                 float visualX )
+{
+  Dali::Toolkit::Text::GlyphIndex glyphIndex = line.glyphRun.glyphIndex;
+  Dali::Toolkit::Text::Length numberOfGlyphs = line.glyphRun.numberOfGlyphs;
+
+  // Find the first glyph whose pen position is after the touch point.
+  while( 0u != numberOfGlyphs )
+  {
+    const Dali::Toolkit::Text::Length step = numberOfGlyphs / 2u;
+    const Dali::Toolkit::Text::GlyphIndex middleIndex = glyphIndex + step;
+
+    const float penPosition = ( positionsBuffer + middleIndex )->x - ( glyphInfoBuffer + middleIndex )->xBearing;
+
+    if( penPosition <= visualX )
+    {
+      glyphIndex = middleIndex + 1u;
+      numberOfGlyphs -= step + 1u;
+    }
+    else
+    {
+      numberOfGlyphs = step;
+    }
+  }
+
+  if( glyphIndex == line.glyphRun.glyphIndex )
+  {
+    return line.characterRun.characterIndex;
+  }
+
+  return std::max( line.characterRun.characterIndex, *( glyphsToCharactersBuffer + glyphIndex - 1u ) );
+}
+
 } //namespace
 
 namespace Dali
@@ -139,8 +190,6 @@ LineIndex GetClosestLine( VisualModelPtr visualModel,
                           float visualY,
                           bool& matchedLine )
 {
-  float totalHeight = 0.f;
-  LineIndex lineIndex = 0;
   matchedLine = false;
 
   if( visualY < 0.f )
@@ -148,32 +197,26 @@ LineIndex GetClosestLine( VisualModelPtr visualModel,
     return 0;
   }
 
-  const Vector<LineRun>& lines = visualModel->mLines;
+  // The accumulated heights of the lines are sorted. Find the first line whose bottom is below the point.
+  const Vector<float>& lineOffsets = visualModel->GetLineOffsets();
 
-  for( Vector<LineRun>::ConstIterator it = lines.Begin(),
-         endIt = lines.End();
-       it != endIt;
-       ++it, ++lineIndex )
+  if( lineOffsets.Empty() )
   {
-    const LineRun& lineRun = *it;
-
-    // The line height is the addition of the line ascender and the line descender.
-    // However, the line descender has a negative value, hence the subtraction.
-    totalHeight += lineRun.ascender - lineRun.descender;
-
-    if( visualY < totalHeight )
-    {
-      matchedLine = true;
-      return lineIndex;
-    }
+    return 0;
   }
 
-  if( lineIndex == 0 )
+  const float* const lineOffsetsBuffer = lineOffsets.Begin();
+  const float* const it = std::upper_bound( lineOffsetsBuffer,
+                                            lineOffsets.End(),
+                                            visualY );
+
+  if( it != lineOffsets.End() )
   {
-    return 0;
+    matchedLine = true;
+    return it - lineOffsetsBuffer;
   }
 
-  return lineIndex - 1u;
+  return lineOffsets.Count() - 1u;
 }
 
 float CalculateLineOffset( const Vector<LineRun>& lines,
@@ -196,6 +239,18 @@ float CalculateLineOffset( const Vector<LineRun>& lines,
   return offset;
 }
 
+float CalculateLineOffset( VisualModelPtr visualModel,
+                           LineIndex lineIndex )
+{
+  if( 0u == lineIndex )
+  {
+    return 0.f;
+  }
+
+  // The offset of a line is the bottom of the previous one.
+  return *( visualModel->GetLineOffsets().Begin() + lineIndex - 1u );
+}
+
 CharacterIndex GetClosestCursorIndex( VisualModelPtr visualModel,
                                       LogicalModelPtr logicalModel,
                                       MetricsPtr metrics,
@@ -269,6 +324,16 @@ CharacterIndex GetClosestCursorIndex( VisualModelPtr visualModel,
 
   // Traverses glyphs in visual order. To do that use the visual to logical conversion table.
   CharacterIndex visualIndex = startCharacter;
+
+  if( !bidiLineFetched )
+  {
+    // The glyphs of a left to right line are in visual order, skip the ones before the touch point with a binary search.
+    visualIndex = FindFirstCharacterToHitTest( line,
+                                               glyphInfoBuffer,
+                                               positionsBuffer,
+                                               visualModel->mGlyphsToCharacters.Begin(),
+                                               visualX );
+  }
   Length numberOfVisualCharacters = 0;
   for( ; visualIndex < endCharacter; ++visualIndex )
   {
@@ -495,7 +560,7 @@ void GetCursorPosition( GetCursorPositionParameters& parameters,
     cursorInfo.isSecondaryCursor = false;
 
     // Set the line offset and height.
-    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel->mLines,
+    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel,
                                                  newLineIndex );
 
     // The line height is the addition of the line ascender and the line descender.
@@ -543,7 +608,7 @@ void GetCursorPosition( GetCursorPositionParameters& parameters,
                                      ( isFirstPositionOfLine && ( isRightToLeftParagraph != isCurrentRightToLeft ) ) );
 
     // Set the line offset and height.
-    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel->mLines,
+    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel,
                                                  lineIndex );
 
     // The line height is the addition of the line ascender and the line descender.
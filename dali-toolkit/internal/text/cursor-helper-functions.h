@@ -110,6 +110,19 @@ LineIndex GetClosestLine( VisualModelPtr visualModel,
 float CalculateLineOffset( const Vector<LineRun>& lines,
                            LineIndex lineIndex );
 
+/**
+ * @brief Calculates the vertical line's offset for a given line using the accumulated heights of the lines.
+ *
+ * @pre @p lineIndex must be between 0 and the number of lines (both inclusive).
+ *
+ * @param[in] visualModel The visual model.
+ * @param[in] lineIndex Index to the line.
+ *
+ * @return The vertical offset of the given line.
+ */
+float CalculateLineOffset( VisualModelPtr visualModel,
+                           LineIndex lineIndex );
+
 /**
  * @brief Retrieves the cursor's logical position for a given touch point x,y
  *
@@ -33,7 +33,9 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/image-view/image-view.h>
 #include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
+#include <dali-toolkit/internal/controls/control-pool/control-pool-impl.h>
 #include <dali-toolkit/internal/controls/image-view/image-view-impl.h>
+#include <dali-toolkit/internal/controls/text-controls/text-selection-popup-impl.h>
 
 #ifdef DEBUG_ENABLED
 #define DECORATOR_DEBUG
@@ -104,6 +106,8 @@ const float CURSOR_WIDTH = 1.f; ///< The cursor's width in pixels.
 
 const float POPUP_PADDING = 2.f; ///< Padding space between the highlight box and the text's popup.
 
+const char* const TEXT_SELECTION_POPUP_TYPE_NAME = "TextSelectionPopup"; ///< The type of the text's popup in the control pool.
+
 typedef Dali::Vector<Dali::Vector4> QuadContainer;
 
 /**
@@ -2274,7 +2278,20 @@ void Decorator::SetEnabledPopupButtons( TextSelectionPopup::Buttons& enabledButt
 
   if ( !mImpl->mCopyPastePopup.actor )
   {
-    mImpl->mCopyPastePopup.actor = TextSelectionPopup::New( &mImpl->mTextSelectionPopupCallbackInterface );
+    Toolkit::ControlPool pool = Toolkit::ControlPool::Get();
+    if( pool )
+    {
+      TextSelectionPopup popup = TextSelectionPopup::DownCast( pool.Acquire( TEXT_SELECTION_POPUP_TYPE_NAME ) );
+      if( popup )
+      {
+        GetImpl( popup ).SetCallbackInterface( &mImpl->mTextSelectionPopupCallbackInterface );
+        mImpl->mCopyPastePopup.actor = popup;
+      }
+    }
+    if( !mImpl->mCopyPastePopup.actor )
+    {
+      mImpl->mCopyPastePopup.actor = TextSelectionPopup::New( &mImpl->mTextSelectionPopupCallbackInterface );
+    }
 #ifdef DECORATOR_DEBUG
     mImpl->mCopyPastePopup.actor.SetProperty( Dali::Actor::Property::NAME,"mCopyPastePopup");
 #endif
@@ -2357,6 +2374,13 @@ Decorator::Decorator( ControllerInterface& controller,
 : mImpl( NULL )
 {
   mImpl = new Decorator::Impl( controller, callbackInterface );
+
+  // Keep a popup ready, so the first long press doesn't create it.
+  Toolkit::ControlPool pool = Toolkit::ControlPool::Get();
+  if( pool )
+  {
+    GetImplementation( pool ).Prewarm( TEXT_SELECTION_POPUP_TYPE_NAME, 1u );
+  }
 }
 
 } // namespace Text
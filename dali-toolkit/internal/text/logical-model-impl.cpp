@@ -468,6 +468,9 @@ void LogicalModel::CreateParagraphInfo( CharacterIndex startIndex,
   // Whether the current paragraphs are updated or set from scratch.
   const bool updateCurrentParagraphs = numberOfCharacters < totalNumberOfCharacters;
 
+  // The current paragraphs are sorted. Find the first one to be updated before the space for the new ones is reserved.
+  const ParagraphRunIndex firstParagraphIndex = FindFirstCharacterRun( startIndex, mParagraphInfo );
+
   // Reserve space for current paragraphs plus new ones.
   const Length numberOfNewParagraphs = paragraphs.Count();
   const Length totalNumberOfParagraphs = mParagraphInfo.Count() + numberOfNewParagraphs;
@@ -492,20 +495,11 @@ void LogicalModel::CreateParagraphInfo( CharacterIndex startIndex,
 
   if( updateCurrentParagraphs )
   {
-    for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin(),
-           endIt = mParagraphInfo.Begin() + totalNumberOfParagraphs - numberOfNewParagraphs;
-         it != endIt;
-         ++it )
-    {
-      const ParagraphRun& paragraph( *it );
-
-      if( startIndex < paragraph.characterRun.characterIndex + paragraph.characterRun.numberOfCharacters )
-      {
-        firstIndex = paragraph.characterRun.characterIndex;
-        break;
-      }
+    paragraphIndex = firstParagraphIndex;
 
-      ++paragraphIndex;
+    if( paragraphIndex < totalNumberOfParagraphs - numberOfNewParagraphs )
+    {
+      firstIndex = ( *( mParagraphInfo.Begin() + paragraphIndex ) ).characterRun.characterIndex;
     }
   }
 
@@ -555,20 +549,22 @@ void LogicalModel::FindParagraphs( CharacterIndex index,
   // Reserve som space for the paragraph indices.
   paragraphs.Reserve( mParagraphInfo.Count() );
 
-  // Traverse the paragraphs to find which ones contain the given characters.
-  ParagraphRunIndex paragraphIndex = 0u;
-  for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin(),
+  // The paragraphs are sorted. Traverse them from the first one which ends after the given index.
+  ParagraphRunIndex paragraphIndex = FindFirstCharacterRun( index, mParagraphInfo );
+  for( Vector<ParagraphRun>::ConstIterator it = mParagraphInfo.Begin() + paragraphIndex,
          endIt = mParagraphInfo.End();
        it != endIt;
        ++it, ++paragraphIndex )
   {
     const ParagraphRun& paragraph( *it );
 
-    if( ( paragraph.characterRun.characterIndex + paragraph.characterRun.numberOfCharacters > index ) &&
-        ( paragraph.characterRun.characterIndex < index + numberOfCharacters ) )
+    if( paragraph.characterRun.characterIndex >= index + numberOfCharacters )
     {
-      paragraphs.PushBack( paragraphIndex );
+      // The next paragraphs don't contain the given characters.
+      break;
     }
+
+    paragraphs.PushBack( paragraphIndex );
   }
 }
 
@@ -24,6 +24,7 @@
 #include <dali/public-api/common/constants.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
 
@@ -292,6 +293,8 @@ ViewModel* Typesetter::GetViewModel()
 
 PixelData Typesetter::Render( const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat )
 {
+  DALI_TOOLKIT_PROFILE_SCOPE( "Text::Typesetter::Render" );
+
   // @todo. This initial implementation for a TextLabel has only one visible page.
 
   // Elides the text if needed.
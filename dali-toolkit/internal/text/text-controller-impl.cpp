@@ -26,6 +26,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/text/bidirectional-support.h>
 #include <dali-toolkit/internal/text/character-set-conversion.h>
 #include <dali-toolkit/internal/text/color-segmentation.h>
@@ -831,6 +832,7 @@ void Controller::Impl::ClearModelData( CharacterIndex startIndex, CharacterIndex
 
 bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
 {
+  DALI_TOOLKIT_PROFILE_SCOPE( "Text::Controller::Impl::UpdateModel" );
   DALI_LOG_INFO( gLogFilter, Debug::General, "Controller::UpdateModel\n" );
 
   // Calculate the operations to be done.
@@ -2294,7 +2296,7 @@ void Controller::Impl::RepositionSelectionHandles()
   // Retrieve the first line and get the line's vertical offset, the line's height and the index to the last glyph.
 
   // The line's vertical offset of all the lines before the line where the first glyph is laid-out.
-  selectionBoxInfo->lineOffset = CalculateLineOffset( mModel->mVisualModel->mLines,
+  selectionBoxInfo->lineOffset = CalculateLineOffset( mModel->mVisualModel,
                                                       firstLineIndex );
 
   // Transform to decorator's (control) coords.
@@ -2773,6 +2773,9 @@ bool Controller::DoRelayout( const Size& size,
                                                    isAutoScrollEnabled );
     mImpl->mIsAutoScrollEnabled = isAutoScrollEnabled;
 
+    // Update the accumulated heights of the lines used to find the line of a touch point.
+    mImpl->mModel->mVisualModel->UpdateLineOffsets( layoutParameters.startLineIndex );
+
     viewUpdated = viewUpdated || ( newLayoutSize != layoutSize );
 
     if( viewUpdated )
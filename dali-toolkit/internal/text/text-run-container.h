@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-run.h>
 
@@ -30,9 +33,37 @@ namespace Toolkit
 namespace Text
 {
 
+/**
+ * @brief Finds the first run which ends after the given character index.
+ *
+ * The runs must be sorted and must not overlap, so a binary search can be used.
+ *
+ * @param[in] index The character index.
+ * @param[in] runs The text's runs.
+ *
+ * @return The index to the first run which ends after @p index, or the number of runs if there is none.
+ */
+template< typename T >
+uint32_t FindFirstCharacterRun( CharacterIndex index,
+                                const Vector<T>& runs )
+{
+  const T* const runsBuffer = runs.Begin();
+  const T* const run = std::upper_bound( runsBuffer,
+                                         runsBuffer + runs.Count(),
+                                         index,
+                                         []( CharacterIndex characterIndex, const T& run )
+                                         {
+                                           return characterIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters;
+                                         } );
+
+  return static_cast<uint32_t>( run - runsBuffer );
+}
+
 /**
  * @brief Clears the runs starting from the given character index.
  *
+ * The runs must be sorted and must not overlap, i.e. scripts, fonts, paragraphs, bidirectional info or lines.
+ *
  * @param[in] startIndex The starting character index used to remove runs.
  * @param[in] endIndex The ending character index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -47,25 +78,23 @@ void ClearCharacterRuns( CharacterIndex startIndex,
                          uint32_t& endRemoveIndex )
 {
   T* runsBuffer = runs.Begin();
-  T* run = runsBuffer;
 
   const Length length = runs.Count();
-  Length index = 0u;
-  for( index = 0u; index < length; ++index )
-  {
-    if( ( run->characterRun.characterIndex <= endIndex ) &&
-        ( startIndex < run->characterRun.characterIndex + run->characterRun.numberOfCharacters ) )
-    {
-      // Run found.
 
-      // Set the index to the first run to be removed.
-      startRemoveIndex = index;
-      break;
-    }
+  // The runs before the first one ending after the start index are not affected.
+  const uint32_t firstIndex = FindFirstCharacterRun( startIndex, runs );
 
-    ++run;
+  T* run = runsBuffer + firstIndex;
+  if( ( firstIndex < length ) &&
+      ( run->characterRun.characterIndex <= endIndex ) )
+  {
+    // Run found.
+
+    // Set the index to the first run to be removed.
+    startRemoveIndex = firstIndex;
   }
 
+  Length index = 0u;
   run = ( runsBuffer + startRemoveIndex );
   for( index = startRemoveIndex; index < length; ++index )
   {
@@ -83,8 +112,8 @@ void ClearCharacterRuns( CharacterIndex startIndex,
   const Length numberOfCharactersRemoved = 1u + endIndex - startIndex;
 
   // Update the character index of the next runs.
-  run = runsBuffer;
-  for( Length index = 0u; index < length; ++index )
+  run = runsBuffer + firstIndex;
+  for( Length index = firstIndex; index < length; ++index )
   {
     if( run->characterRun.characterIndex > startIndex )
     {
@@ -157,20 +186,13 @@ void UpdateCharacterRuns( CharacterIndex index,
       return;
     }
 
-    const VectorBase::SizeType size = runs.Count();
-    // Temporary vector used to remove runs.
-    Vector<T> tempRuns;
-    // Reserve some space for the temporary vector.
-    tempRuns.Reserve( size );
-    removedRuns.Reserve( size );
-
-    // Whether any run has to be removed.
-    bool runsRemoved = false;
+    removedRuns.Reserve( runs.Count() );
 
     // Index to the last character added/removed.
     const CharacterIndex lastIndex = index + numberOfRemovedCharacters - 1u;
 
-    // Update the style runs
+    // Update the style runs. The runs which are kept are moved in place to the front of the vector.
+    typename Vector<T>::Iterator keptIt = runs.Begin();
     for( typename Vector<T>::Iterator it = runs.Begin(),
            endIt = runs.End();
          it != endIt;
@@ -186,7 +208,7 @@ void UpdateCharacterRuns( CharacterIndex index,
       if( lastRunIndex < index )
       {
         // The style run is not affected by the removed text.
-        tempRuns.PushBack( run );
+        *keptIt++ = run;
         continue;
       }
 
@@ -195,9 +217,6 @@ void UpdateCharacterRuns( CharacterIndex index,
       {
         // Add the removed run into the vector.
         removedRuns.PushBack( run );
-
-        // All the characters are removed.
-        runsRemoved = true;
       }
       else
       {
@@ -221,15 +240,12 @@ void UpdateCharacterRuns( CharacterIndex index,
           }
         }
 
-        tempRuns.PushBack( run );
+        *keptIt++ = run;
       }
     }
 
-    // Copy the temporary vector if there are runs removed.
-    if( runsRemoved )
-    {
-      runs = tempRuns;
-    }
+    // Remove the runs which are not kept, i.e. the removed and the empty ones.
+    runs.Resize( static_cast<typename Vector<T>::SizeType>( keptIt - runs.Begin() ) );
   }
   else
   {
@@ -267,6 +283,8 @@ void UpdateCharacterRuns( CharacterIndex index,
 /**
  * @brief Clears the runs starting from the given glyph index.
  *
+ * The runs must be sorted and must not overlap.
+ *
  * @param[in] startIndex The starting glyph index used to remove runs.
  * @param[in] endIndex The ending glyph index used to remove runs.
  * @param[in,out] runs The text's runs.
@@ -281,24 +299,29 @@ void ClearGlyphRuns( GlyphIndex startIndex,
                      uint32_t& endRemoveIndex )
 {
   T* runsBuffer = runs.Begin();
-  T* run = runsBuffer;
 
   const Length length = runs.Count();
-  Length index = 0u;
-  for( index = 0u; index < length; ++index )
+
+  // The runs before the first one ending after the start index are not affected.
+  T* run = std::upper_bound( runsBuffer,
+                             runsBuffer + length,
+                             startIndex,
+                             []( GlyphIndex glyphIndex, const T& run )
+                             {
+                               return glyphIndex < run.glyphRun.glyphIndex + run.glyphRun.numberOfGlyphs;
+                             } );
+  const uint32_t firstIndex = static_cast<uint32_t>( run - runsBuffer );
+
+  if( ( firstIndex < length ) &&
+      ( run->glyphRun.glyphIndex <= endIndex ) )
   {
-    if( ( run->glyphRun.glyphIndex <= endIndex ) &&
-        ( startIndex < run->glyphRun.glyphIndex + run->glyphRun.numberOfGlyphs ) )
-    {
-      // Run found.
+    // Run found.
 
-      // Set the index to the first run to be removed.
-      startRemoveIndex = index;
-      break;
-    }
-    ++run;
+    // Set the index to the first run to be removed.
+    startRemoveIndex = firstIndex;
   }
 
+  Length index = 0u;
   run = ( runsBuffer + startRemoveIndex );
   for( index = startRemoveIndex; index < length; ++index )
   {
@@ -317,14 +340,15 @@ void ClearGlyphRuns( GlyphIndex startIndex,
   const Length numberOfGlyphsRemoved = 1u + endIndex - startIndex;
 
   // Update the glyph index of the next runs.
-  run = runsBuffer;
-  for( Length index = 0u; index < length; ++index )
+  run = runsBuffer + firstIndex;
+  for( Length index = firstIndex; index < length; ++index )
   {
-
     if( run->glyphRun.glyphIndex > startIndex )
     {
       run->glyphRun.glyphIndex -= numberOfGlyphsRemoved;
     }
+
+    ++run;
   }
 }
 
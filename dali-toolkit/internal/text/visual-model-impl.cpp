@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <algorithm>
 
 namespace Dali
 {
@@ -278,26 +279,60 @@ LineIndex VisualModel::GetLineOfCharacter( CharacterIndex characterIndex )
     return mCachedLineIndex;
   }
 
-  // 3) Is not in the cached line. Check in the other lines.
-  LineIndex index = characterIndex < lineRun.characterRun.characterIndex ? 0u : mCachedLineIndex + 1u;
+  // 3) Is not in the cached line. Binary search the first line which ends after the character.
+  Vector<LineRun>::ConstIterator beginIt = ( characterIndex < lineRun.characterRun.characterIndex ) ? mLines.Begin() : mLines.Begin() + mCachedLineIndex + 1u;
 
-  for( Vector<LineRun>::ConstIterator it = mLines.Begin() + index,
-         endIt = mLines.End();
-       it != endIt;
-       ++it, ++index )
-  {
-    const LineRun& lineRun = *it;
+  Vector<LineRun>::ConstIterator it = std::upper_bound( beginIt,
+                                                        mLines.End(),
+                                                        characterIndex,
+                                                        []( CharacterIndex index, const LineRun& line )
+                                                        {
+                                                          return index < line.characterRun.characterIndex + line.characterRun.numberOfCharacters;
+                                                        } );
 
-    if( characterIndex < lineRun.characterRun.characterIndex + lineRun.characterRun.numberOfCharacters )
-    {
-      mCachedLineIndex = index;
-      break;
-    }
+  const LineIndex index = it - mLines.Begin();
+  if( it != mLines.End() )
+  {
+    mCachedLineIndex = index;
   }
 
   return index;
 }
 
+void VisualModel::UpdateLineOffsets( LineIndex startLineIndex )
+{
+  const Length numberOfLines = mLines.Count();
+
+  // The accumulated heights before the start line are still valid if they have been calculated.
+  startLineIndex = std::min( startLineIndex, std::min( numberOfLines, mLineOffsets.Count() ) );
+
+  mLineOffsets.Resize( numberOfLines );
+
+  float offset = ( 0u == startLineIndex ) ? 0.f : *( mLineOffsets.Begin() + startLineIndex - 1u );
+
+  float* lineOffsetsBuffer = mLineOffsets.Begin();
+  for( LineIndex index = startLineIndex; index < numberOfLines; ++index )
+  {
+    const LineRun& lineRun = *( mLines.Begin() + index );
+
+    // The line height is the addition of the line ascender and the line descender.
+    // However, the line descender has a negative value, hence the subtraction.
+    offset += lineRun.ascender - lineRun.descender;
+
+    *( lineOffsetsBuffer + index ) = offset;
+  }
+}
+
+const Vector<float>& VisualModel::GetLineOffsets()
+{
+  if( mLineOffsets.Count() != mLines.Count() )
+  {
+    UpdateLineOffsets( 0u );
+  }
+
+  return mLineOffsets;
+}
+
 void VisualModel::GetUnderlineRuns( GlyphRun* underlineRuns,
                                     UnderlineRunIndex index,
                                     Length numberOfRuns ) const
@@ -477,6 +512,7 @@ VisualModel::VisualModel()
   mOutlineWidth( 0u ),
   mNaturalSize(),
   mLayoutSize(),
+  mLineOffsets(),
   mCachedLineIndex( 0u ),
   mUnderlineEnabled( false ),
   mUnderlineColorSet( false ),
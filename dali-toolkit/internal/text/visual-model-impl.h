@@ -148,6 +148,28 @@ public:
    */
   LineIndex GetLineOfCharacter( CharacterIndex characterIndex );
 
+  /**
+   * @brief Updates the accumulated heights of the lines.
+   *
+   * The accumulated heights of the lines before @p startLineIndex are not recalculated.
+   * Needs to be called every time the lines are laid-out.
+   *
+   * @param[in] startLineIndex Index to the first line which has been laid-out.
+   */
+  void UpdateLineOffsets( LineIndex startLineIndex );
+
+  /**
+   * @brief Retrieves the accumulated heights of the lines.
+   *
+   * The element @e i is the addition of the heights of the lines from 0 to @e i, i.e. the bottom of the line @e i.
+   * It's sorted so the line of a vertical position can be found with a binary search.
+   *
+   * The accumulated heights are recalculated if the number of lines has changed since the last update.
+   *
+   * @return The accumulated heights of the lines.
+   */
+  const Vector<float>& GetLineOffsets();
+
   // Underline runs
 
   /**
@@ -408,6 +430,8 @@ private:
   Size                   mNaturalSize;        ///< Size of the text with no line wrapping.
   Size                   mLayoutSize;         ///< Size of the laid-out text considering the layout properties set.
 
+  Vector<float>          mLineOffsets;        ///< For each line, the addition of the heights of the lines up to it.
+
   // Caches to increase performance in some consecutive operations.
   LineIndex mCachedLineIndex; ///< Used to increase performance in consecutive calls to GetLineOfGlyph() or GetLineOfCharacter() with consecutive glyphs or characters.
 
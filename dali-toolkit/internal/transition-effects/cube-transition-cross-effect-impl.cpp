@@ -31,6 +31,7 @@ CubeTransitionCrossEffect::CubeTransitionCrossEffect( unsigned int numRows, unsi
 : CubeTransitionEffect( numRows, numColumns ),
   mDisplacementSpreadFactor( 0.008f )
 {
+  mRotationAlphaFunction = ROTATION_EASE_IN_OUT_SINE;
 }
 
 Toolkit::CubeTransitionCrossEffect CubeTransitionCrossEffect::New(unsigned int numRows, unsigned int numColumns )
@@ -122,9 +123,6 @@ void CubeTransitionCrossEffect::OnStartTransition( Vector2 panPosition, Vector2
       SetupAnimation( idx, x, y, angle, Vector3::YAXIS, centre );
     }
   }
-
-  mAnimation.Play();
-  mIsAnimating = true;
 }
 
 void CubeTransitionCrossEffect::SetupAnimation( unsigned int actorIndex, unsigned int x, unsigned int y, float angle, const Vector3 axis, const Vector3& displacementCentre )
@@ -144,11 +142,7 @@ void CubeTransitionCrossEffect::SetupAnimation( unsigned int actorIndex, unsigne
   Vector3 newPosition = ( direction * (length + deltaLength ) ) + displacementCentre;
   Vector3 newLocalPosition = newPosition - position;
 
-  mAnimation.AnimateTo( Property( mBoxes[ actorIndex ], Actor::Property::ORIENTATION ), Quaternion( Radian( -angle ), axis ), AlphaFunction::EASE_IN_OUT_SINE );
-  mAnimation.AnimateTo( Property( mBoxes[ actorIndex ], Actor::Property::POSITION ), newLocalPosition, AlphaFunction::BOUNCE );
-
-  mAnimation.AnimateTo( Property( mCurrentTiles[ actorIndex ], Actor::Property::COLOR ), HALF_BRIGHTNESS, AlphaFunction::EASE_OUT );
-  mAnimation.AnimateTo( Property( mTargetTiles[ actorIndex ], Actor::Property::COLOR ), FULL_BRIGHTNESS, AlphaFunction::EASE_IN );
+  SetTileAnimation( actorIndex, axis, -angle, newLocalPosition );
 }
 
 } // namespace Internal
@@ -70,7 +70,7 @@ private:
    CubeTransitionCrossEffect( unsigned int numRows, unsigned int numColumns );
 
    /**
-    * @brief Set up animation to an Actor
+    * @brief Set up the animation of a cube
     * This will also displace the cubes in the z direction by mCubeDisplacement and spread them apart on the xy plane
     * given by the closeness of displacementCentre to the XY plane at 0.
     *
@@ -19,7 +19,11 @@
 #include "cube-transition-effect-impl.h"
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring> // for strcmp
+#include <limits>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/object/type-registry.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
@@ -79,23 +83,103 @@ const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
   }\n
 );
 
-Actor CreateTile( const Vector4& samplerRect )
+// The tiles of all the cubes are drawn at once: the animation of every cube is computed from its own attributes
+// and the progress of the whole transition.
+// The rotation uses the alpha function of the effect, the displacement a BOUNCE alpha function,
+// the brightness of the current face goes from full to half with EASE_OUT, the target face from half to full with EASE_IN.
+const char* TILE_VERTEX_SHADER = DALI_COMPOSE_SHADER(
+  attribute mediump vec3 aPosition;\n
+  attribute mediump vec2 aTexCoord;\n
+  attribute mediump vec3 aBoxCentre;\n
+  attribute mediump vec4 aRotation;\n
+  attribute mediump vec3 aDisplacement;\n
+  attribute mediump vec2 aTiming;\n
+  attribute mediump float aTarget;\n
+  varying mediump vec2 vTexCoord;\n
+  varying mediump float vTarget;\n
+  varying lowp float vBrightness;\n
+  uniform mediump mat4 uMvpMatrix;\n
+  uniform mediump float uProgress;\n
+  uniform mediump float uRotationAlphaFunction;\n
+  \n
+  const mediump float PI = 3.1415926;\n
+  \n
+  void main()\n
+  {\n
+    mediump float progress = clamp( ( uProgress - aTiming.x ) / aTiming.y, 0.0, 1.0 );\n
+    mediump float rotationProgress = progress;\n
+    if( uRotationAlphaFunction > 1.5 )\n
+    {\n
+      rotationProgress = -0.5 * ( cos( PI * progress ) - 1.0 );\n
+    }\n
+    else if( uRotationAlphaFunction > 0.5 )\n
+    {\n
+      rotationProgress = sin( progress * PI * 0.5 );\n
+    }\n
+    \n
+    mediump float angle = aRotation.w * rotationProgress;\n
+    mediump float cosAngle = cos( angle );\n
+    mediump float sinAngle = sin( angle );\n
+    mediump vec3 position = aPosition * cosAngle + cross( aRotation.xyz, aPosition ) * sinAngle + aRotation.xyz * dot( aRotation.xyz, aPosition ) * ( 1.0 - cosAngle );\n
+    position += aBoxCentre + aDisplacement * sin( PI * progress );\n
+    gl_Position = uMvpMatrix * vec4( position, 1.0 );\n
+    \n
+    mediump float easeOut = progress - 1.0;\n
+    easeOut = easeOut * easeOut * easeOut + 1.0;\n
+    vBrightness = mix( 1.0 - 0.5 * easeOut, 0.5 + 0.5 * progress * progress * progress, aTarget );\n
+    vTexCoord = aTexCoord;\n
+    vTarget = aTarget;\n
+  }\n
+);
+
+const char* TILE_FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+  varying mediump vec2 vTexCoord;\n
+  varying mediump float vTarget;\n
+  varying lowp float vBrightness;\n
+  uniform sampler2D sCurrentTexture;\n
+  uniform sampler2D sTargetTexture;\n
+  uniform lowp vec4 uColor;\n
+  \n
+  void main()\n
+  {\n
+    lowp vec4 color = mix( texture2D( sCurrentTexture, vTexCoord ), texture2D( sTargetTexture, vTexCoord ), vTarget );\n
+    gl_FragColor = vec4( color.rgb * vBrightness, color.a ) * uColor;\n
+  }\n
+);
+
+const unsigned int VERTICES_PER_FACE = 4u;
+const unsigned int FACES_PER_TILE = 2u; // the current face and the target face of a cube
+
+// The corners of a face, in the order of the FACE_INDICES
+const Vector2 FACE_CORNERS[ VERTICES_PER_FACE ] =
 {
- Actor tile = Actor::New();
-  tile.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
-  tile.RegisterProperty( "uTextureRect", samplerRect );
-  return tile;
-}
+  Vector2( -0.5f, -0.5f ),
+  Vector2( -0.5f,  0.5f ),
+  Vector2(  0.5f,  0.5f ),
+  Vector2(  0.5f, -0.5f )
+};
+const unsigned short FACE_INDICES[] = { 0, 1, 2, 0, 2, 3 };
+const unsigned int INDICES_PER_FACE = sizeof( FACE_INDICES ) / sizeof( FACE_INDICES[0] );
+
+struct TileVertex
+{
+  Vector3 position;     ///< The position of the corner in the cube, before the rotation
+  Vector2 texCoord;
+  Vector3 boxCentre;    ///< The centre of the cube in the effect
+  Vector4 rotation;     ///< The rotation axis and the final angle of the cube
+  Vector3 displacement;
+  Vector2 timing;       ///< The delay and the duration of the cube animation
+  float   target;       ///< 1.0 for the target face, 0.0 for the current face
+};
 
 }
 
-const Vector4 CubeTransitionEffect::FULL_BRIGHTNESS( 1.0f, 1.0f, 1.0f, 1.0f );
-const Vector4 CubeTransitionEffect::HALF_BRIGHTNESS( 0.5f, 0.5f, 0.5f, 1.0f );
-
 CubeTransitionEffect::CubeTransitionEffect( unsigned int rows, unsigned int columns )
 : Control( ControlBehaviour( DISABLE_STYLE_CHANGE_SIGNALS ) ),
   mRows( rows ),
   mColumns( columns ),
+  mProgressIndex( Property::INVALID_INDEX ),
+  mRotationAlphaFunction( ROTATION_LINEAR ),
   mIsAnimating( false ),
   mIsPaused( false ),
   mAnimationDuration( 1.f ),
@@ -109,85 +193,41 @@ CubeTransitionEffect::~CubeTransitionEffect()
 
 void CubeTransitionEffect::SetTargetRight( unsigned int idx )
 {
-  mBoxType[ idx ] = RIGHT;
-
-  mBoxes[ idx ].SetProperty(Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.x * 0.5f );
-
-  mTargetTiles[ idx ].SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 1.f, 0.5f, 0.5f) );
-  mTargetTiles[ idx ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Degree( 90.f ), Vector3::YAXIS ) );
+  mTiles[ idx ].targetFace = RIGHT;
 }
 
 void CubeTransitionEffect::SetTargetLeft( unsigned int idx )
 {
-  mBoxType[ idx ] = LEFT;
-
-  mBoxes[ idx ].SetProperty(Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.x * 0.5f );
-
-  mTargetTiles[ idx ].SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 0.f, 0.5f, 0.5f) );
-  mTargetTiles[ idx ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Degree( -90.f ), Vector3::YAXIS ) );
+  mTiles[ idx ].targetFace = LEFT;
 }
 
 void CubeTransitionEffect::SetTargetBottom( unsigned int idx )
 {
-  mBoxType[ idx ] = BOTTOM;
-
-  mBoxes[ idx ].SetProperty(Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.y * 0.5f );
-
-  mTargetTiles[ idx ].SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 0.5f, 0.f, 0.5f) );
-  mTargetTiles[ idx ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Degree( 90.f ), Vector3::XAXIS ) );
+  mTiles[ idx ].targetFace = BOTTOM;
 }
 
 void CubeTransitionEffect::SetTargetTop( unsigned int idx )
 {
-  mBoxType[ idx ] = TOP;
-
-  mBoxes[ idx ].SetProperty(Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.y * 0.5f );
+  mTiles[ idx ].targetFace = TOP;
+}
 
-  mTargetTiles[ idx ].SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 0.5f, 1.f, 0.5f) );
-  mTargetTiles[ idx ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Degree( -90.f ), Vector3::XAXIS ) );
+void CubeTransitionEffect::SetTileAnimation( unsigned int idx, const Vector3& axis, float angle, const Vector3& displacement, float delay, float duration )
+{
+  Tile& tile = mTiles[ idx ];
+  tile.axis = axis;
+  tile.angle = angle;
+  tile.displacement = displacement;
+  tile.delay = delay;
+  tile.duration = std::max( duration, Math::MACHINE_EPSILON_1000 );
 }
 
 void CubeTransitionEffect::OnRelayout( const Vector2& size, RelayoutContainer& container )
 {
   mTileSize = Vector2( size.x / mColumns, size.y / mRows );
 
-  mBoxRoot.SetProperty( Actor::Property::SIZE_WIDTH, size.x );
-  mBoxRoot.SetProperty( Actor::Property::SIZE_HEIGHT, size.y );
-  mBoxRoot.SetProperty( Actor::Property::SIZE_DEPTH, 1.0f );
-
-  for( size_t i = 0; i < mBoxes.size(); ++i )
+  if( mIsAnimating )
   {
-    mBoxes[ i ].SetProperty( Actor::Property::SIZE_WIDTH, mTileSize.x );
-    mBoxes[ i ].SetProperty( Actor::Property::SIZE_HEIGHT, mTileSize.y );
-
-    switch( mBoxType[i] )
-    {
-      case LEFT:
-      case RIGHT:
-      {
-        mBoxes[ i ].SetProperty( Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.x * 0.5f );
-        mBoxes[ i ].SetProperty( Actor::Property::SIZE_DEPTH, mTileSize.x );
-        break;
-      }
-      case BOTTOM:
-      case TOP:
-      {
-        mBoxes[ i ].SetProperty( Actor::Property::PARENT_ORIGIN_Z, 1.0f - mTileSize.y * 0.5f );
-        mBoxes[ i ].SetProperty( Actor::Property::SIZE_DEPTH, mTileSize.y );
-        break;
-      }
-    }
-  }
-
-  for( ActorArray::iterator it = mCurrentTiles.begin(); it != mCurrentTiles.end(); ++it )
-  {
-    it->SetProperty( Actor::Property::SIZE_WIDTH, mTileSize.x );
-    it->SetProperty( Actor::Property::SIZE_HEIGHT, mTileSize.y );
-  }
-  for( ActorArray::iterator it = mTargetTiles.begin(); it != mTargetTiles.end(); ++it )
-  {
-    it->SetProperty( Actor::Property::SIZE_WIDTH, mTileSize.x );
-    it->SetProperty( Actor::Property::SIZE_HEIGHT, mTileSize.y );
+    UpdateTileGeometry();
   }
 }
 
@@ -195,53 +235,137 @@ void CubeTransitionEffect::Initialize()
 {
   Self().RegisterProperty( "uTextureRect", Vector4( 0.0f, 0.0f, 1.0f, 1.0f ) );
 
-  mBoxType.Resize(mColumns * mRows);
+  // The indices of the tile geometry are unsigned short
+  DALI_ASSERT_ALWAYS( mColumns * mRows * FACES_PER_TILE * VERTICES_PER_FACE <= std::numeric_limits< unsigned short >::max() + 1u && "Too many cubes" );
+
+  mTiles.clear();
+  mTiles.resize( mColumns * mRows );
 
-  //create the box parents
-  mBoxRoot = Actor::New();
-  mBoxRoot.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
-  mBoxRoot.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
+  OnInitialize();
+}
 
-  mCurrentTiles.clear();
-  mTargetTiles.clear();
+void CubeTransitionEffect::CreateTileRenderer()
+{
+  Property::Map vertexFormat;
+  vertexFormat[ "aPosition" ] = Property::VECTOR3;
+  vertexFormat[ "aTexCoord" ] = Property::VECTOR2;
+  vertexFormat[ "aBoxCentre" ] = Property::VECTOR3;
+  vertexFormat[ "aRotation" ] = Property::VECTOR4;
+  vertexFormat[ "aDisplacement" ] = Property::VECTOR3;
+  vertexFormat[ "aTiming" ] = Property::VECTOR2;
+  vertexFormat[ "aTarget" ] = Property::FLOAT;
+  mTileVertices = VertexBuffer::New( vertexFormat );
+
+  const unsigned int numberOfFaces = static_cast< unsigned int >( mTiles.size() ) * FACES_PER_TILE;
+  Vector< unsigned short > indices;
+  indices.Reserve( numberOfFaces * INDICES_PER_FACE );
+  for( unsigned int face = 0u; face < numberOfFaces; ++face )
+  {
+    for( unsigned int i = 0u; i < INDICES_PER_FACE; ++i )
+    {
+      indices.PushBack( static_cast< unsigned short >( face * VERTICES_PER_FACE + FACE_INDICES[ i ] ) );
+    }
+  }
 
-  mCurrentTiles.reserve( mColumns * mRows );
-  mTargetTiles.reserve( mColumns * mRows );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( mTileVertices );
+  geometry.SetIndexBuffer( &indices[0], indices.Count() );
 
-  Vector2 gridSizeInv( 1.0f / mColumns, 1.0f / mRows );
-  Vector3 offset( 0.5f * gridSizeInv.x, 0.5f * gridSizeInv.y, 0.0f );
+  Shader shader = Shader::New( TILE_VERTEX_SHADER, TILE_FRAGMENT_SHADER );
+  mTileRenderer = Renderer::New( geometry, shader );
+  mProgressIndex = mTileRenderer.RegisterProperty( "uProgress", 0.f );
+  mTileRenderer.RegisterProperty( "uRotationAlphaFunction", static_cast< float >( mRotationAlphaFunction ) );
+}
 
-  Vector3 anchor;
-  for( unsigned int y = 0; y < mRows; ++y, anchor.y += 1.0f / mRows )
+void CubeTransitionEffect::UpdateTileGeometry()
+{
+  if( !mTileVertices )
   {
-    anchor.x = 0.0f;
-    for( unsigned int x = 0; x <mColumns; ++x, anchor.x += 1.0f / mColumns )
-    {
-      Vector4 textureRect( anchor.x, anchor.y, anchor.x + gridSizeInv.x, anchor.y + gridSizeInv.y );
+    return;
+  }
 
-      Actor currentTile = CreateTile( textureRect );
-      currentTile.SetProperty( Actor::Property::COLOR, FULL_BRIGHTNESS );
-      currentTile.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
-      mCurrentTiles.push_back( currentTile );
+  const Vector2 gridSizeInv( 1.0f / mColumns, 1.0f / mRows );
+  const Vector2 halfSize( mTileSize.x * mColumns * 0.5f, mTileSize.y * mRows * 0.5f );
 
-      Actor targetTile = CreateTile( textureRect );
-      targetTile.SetProperty( Actor::Property::COLOR, HALF_BRIGHTNESS );
-      mTargetTiles.push_back( targetTile );
+  Vector< TileVertex > vertices;
+  vertices.Resize( mTiles.size() * FACES_PER_TILE * VERTICES_PER_FACE );
+  TileVertex* vertex = vertices.Begin();
 
-      Actor box = Actor::New();
-      box.SetProperty( Actor::Property::PARENT_ORIGIN, anchor + offset );
-      box.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
+  unsigned int idx = 0u;
+  for( unsigned int y = 0; y < mRows; ++y )
+  {
+    for( unsigned int x = 0; x < mColumns; ++x, ++idx )
+    {
+      const Tile& tile = mTiles[ idx ];
 
-      box.Add( currentTile );
-      box.Add( targetTile );
+      // The target face is placed on a side of the cube, facing outwards
+      Vector3 targetOffset;
+      Quaternion targetOrientation;
+      float depth = mTileSize.x;
+      switch( tile.targetFace )
+      {
+        case RIGHT:
+        {
+          targetOffset.x = mTileSize.x * 0.5f;
+          targetOrientation = Quaternion( Degree( 90.f ), Vector3::YAXIS );
+          break;
+        }
+        case LEFT:
+        {
+          targetOffset.x = -mTileSize.x * 0.5f;
+          targetOrientation = Quaternion( Degree( -90.f ), Vector3::YAXIS );
+          break;
+        }
+        case BOTTOM:
+        {
+          depth = mTileSize.y;
+          targetOffset.y = -mTileSize.y * 0.5f;
+          targetOrientation = Quaternion( Degree( 90.f ), Vector3::XAXIS );
+          break;
+        }
+        case TOP:
+        {
+          depth = mTileSize.y;
+          targetOffset.y = mTileSize.y * 0.5f;
+          targetOrientation = Quaternion( Degree( -90.f ), Vector3::XAXIS );
+          break;
+        }
+      }
 
-      mBoxRoot.Add( box );
+      // The cube is behind the effect, so its current face is in the plane of the effect
+      const Vector3 boxCentre( ( x + 0.5f ) * mTileSize.x - halfSize.x, ( y + 0.5f ) * mTileSize.y - halfSize.y, -depth * 0.5f );
+      const Vector4 rotation( tile.axis.x, tile.axis.y, tile.axis.z, tile.angle );
+      const Vector2 timing( tile.delay, tile.duration );
+      const Vector2 textureOrigin( x * gridSizeInv.x, y * gridSizeInv.y );
 
-      mBoxes.push_back( box );
+      for( unsigned int face = 0u; face < FACES_PER_TILE; ++face )
+      {
+        for( unsigned int corner = 0u; corner < VERTICES_PER_FACE; ++corner, ++vertex )
+        {
+          const Vector2& cornerPosition = FACE_CORNERS[ corner ];
+          Vector3 position( cornerPosition.x * mTileSize.x, cornerPosition.y * mTileSize.y, 0.f );
+          if( face == 0u )
+          {
+            position.z = depth * 0.5f;
+          }
+          else
+          {
+            position = targetOrientation.Rotate( position ) + targetOffset;
+          }
+
+          vertex->position = position;
+          vertex->texCoord = textureOrigin + ( cornerPosition + Vector2( 0.5f, 0.5f ) ) * gridSizeInv;
+          vertex->boxCentre = boxCentre;
+          vertex->rotation = rotation;
+          vertex->displacement = tile.displacement;
+          vertex->timing = timing;
+          vertex->target = static_cast< float >( face );
+        }
+      }
     }
   }
 
-  OnInitialize();
+  mTileVertices.SetData( &vertices[0], vertices.Count() );
 }
 
 void CubeTransitionEffect::OnSceneConnection( int depth )
@@ -259,7 +383,16 @@ void CubeTransitionEffect::OnSceneConnection( int depth )
   mCurrentRenderer.SetTextures( textureSet );
 
   mCurrentRenderer.SetProperty( Renderer::Property::DEPTH_INDEX, depth );
-  Self().AddRenderer( mCurrentRenderer );
+
+  if( mIsAnimating )
+  {
+    mTileRenderer.SetProperty( Renderer::Property::DEPTH_INDEX, depth );
+    Self().AddRenderer( mTileRenderer );
+  }
+  else
+  {
+    Self().AddRenderer( mCurrentRenderer );
+  }
 
   Control::OnSceneConnection( depth );
 }
@@ -269,21 +402,12 @@ void CubeTransitionEffect::OnSceneDisconnection()
   if( mCurrentRenderer )
   {
     Self().RemoveRenderer( mCurrentRenderer );
-
-    for( ActorArray::iterator it = mCurrentTiles.begin(); it != mCurrentTiles.end(); ++it )
-    {
-      it->RemoveRenderer( mCurrentRenderer );
-    }
     mCurrentRenderer.Reset();
   }
 
-  if( mTargetRenderer )
+  if( mTileRenderer )
   {
-    for( ActorArray::iterator it = mTargetTiles.begin(); it != mTargetTiles.end(); ++it )
-    {
-      it->RemoveRenderer( mTargetRenderer );
-    }
-    mTargetRenderer.Reset();
+    Self().RemoveRenderer( mTileRenderer );
   }
 
   Control::OnSceneDisconnection();
@@ -323,16 +447,22 @@ void CubeTransitionEffect::SetCurrentTexture( Texture texture )
     TextureSet textureSet = mCurrentRenderer.GetTextures();
     textureSet.SetTexture( 0u, mCurrentTexture);
   }
+
+  if( mTileRenderer )
+  {
+    TextureSet textureSet = mTileRenderer.GetTextures();
+    textureSet.SetTexture( 0u, mCurrentTexture );
+  }
 }
 
 void CubeTransitionEffect::SetTargetTexture( Texture texture )
 {
   mTargetTexture = texture;
 
-  if( mTargetRenderer )
+  if( mTileRenderer )
   {
-    TextureSet textureSet = mTargetRenderer.GetTextures();
-    textureSet.SetTexture( 0u, mTargetTexture );
+    TextureSet textureSet = mTileRenderer.GetTextures();
+    textureSet.SetTexture( 1u, mTargetTexture );
   }
 }
 
@@ -357,39 +487,33 @@ void CubeTransitionEffect::StartTransition( Vector2 panPosition, Vector2 panDisp
     return;
   }
 
-  //create the target renderer
-  TextureSet textureSet = TextureSet::New();
-  if( mTargetTexture )
+  if( !mTileRenderer )
   {
-    textureSet.SetTexture( 0u, mTargetTexture );
+    CreateTileRenderer();
   }
-  Geometry geometry = mCurrentRenderer.GetGeometry();
-  Shader shader( mCurrentRenderer.GetShader() );
-  mTargetRenderer = Renderer::New( geometry, shader );
-  mTargetRenderer.SetTextures( textureSet );
 
-  int depthIndex = mCurrentRenderer.GetProperty<int>(Renderer::Property::DEPTH_INDEX);
-  mTargetRenderer.SetProperty( Dali::Renderer::Property::DEPTH_INDEX, depthIndex );
-
-  for( size_t i = 0; i < mBoxes.size(); ++i )
+  //the tile renderer samples the current texture for the front faces and the target texture for the others
+  TextureSet textureSet = TextureSet::New();
+  if( mCurrentTexture )
   {
-    mBoxes[ i ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Radian( 0.0f ), Vector3::XAXIS ) );
+    textureSet.SetTexture( 0u, mCurrentTexture );
   }
-
-  for( ActorArray::iterator it = mCurrentTiles.begin(); it != mCurrentTiles.end(); ++it )
+  if( mTargetTexture )
   {
-    it->SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 0.5f, 0.5f, 1.0f) );
-    it->SetProperty( Actor::Property::ORIENTATION, Quaternion( Radian( 0.0f ), Vector3::XAXIS ) );
-    it->AddRenderer( mCurrentRenderer );
+    textureSet.SetTexture( 1u, mTargetTexture );
   }
-  for( ActorArray::iterator it = mTargetTiles.begin(); it != mTargetTiles.end(); ++it )
+  mTileRenderer.SetTextures( textureSet );
+
+  int depthIndex = mCurrentRenderer.GetProperty<int>(Renderer::Property::DEPTH_INDEX);
+  mTileRenderer.SetProperty( Dali::Renderer::Property::DEPTH_INDEX, depthIndex );
+  mTileRenderer.SetProperty( mProgressIndex, 0.f );
+
+  if( !mIsAnimating )
   {
-    it->AddRenderer( mTargetRenderer );
+    Self().RemoveRenderer( mCurrentRenderer );
+    Self().AddRenderer( mTileRenderer );
   }
 
-  Self().RemoveRenderer( mCurrentRenderer );
-  Self().Add( mBoxRoot );
-
   if(mAnimation)
   {
     mAnimation.Clear();
@@ -400,6 +524,12 @@ void CubeTransitionEffect::StartTransition( Vector2 panPosition, Vector2 panDisp
   mAnimation.FinishedSignal().Connect( this, &CubeTransitionEffect::OnTransitionFinished );
 
   OnStartTransition( panPosition, panDisplacement );
+
+  //every cube is animated from the single progress property, with its own delay and duration
+  UpdateTileGeometry();
+  mAnimation.AnimateTo( Property( mTileRenderer, mProgressIndex ), 1.f, AlphaFunction::LINEAR );
+  mAnimation.Play();
+  mIsAnimating = true;
 }
 
 void CubeTransitionEffect::PauseTransition()
@@ -427,52 +557,35 @@ void CubeTransitionEffect::StopTransition()
 
 void CubeTransitionEffect::ResetToInitialState()
 {
-  mAnimation.Clear();
-  mAnimation.Reset();
-  mIsAnimating = false;
-
-  Self().Remove( mBoxRoot );
-
-  for( size_t i = 0; i < mBoxes.size(); ++i )
+  if( mAnimation )
   {
-    mBoxes[ i ].SetProperty( Actor::Property::ORIENTATION, Quaternion( Radian( 0.0f ), Vector3::XAXIS ) );
+    mAnimation.Clear();
+    mAnimation.Reset();
   }
 
-  for( ActorArray::iterator it = mCurrentTiles.begin(); it != mCurrentTiles.end(); ++it )
+  if( mIsAnimating )
   {
-    it->SetProperty( Actor::Property::PARENT_ORIGIN, Vector3( 0.5f, 0.5f, 1.0f) );
-    it->SetProperty( Actor::Property::ORIENTATION, Quaternion( Radian( 0.0f ), Vector3::XAXIS ) );
-    it->SetProperty( Actor::Property::COLOR, FULL_BRIGHTNESS );
-  }
-  if( mCurrentRenderer )
-  {
-    for( ActorArray::iterator it = mCurrentTiles.begin(); it != mCurrentTiles.end(); ++it )
-    {
-      it->RemoveRenderer( mCurrentRenderer );
-    }
-    Self().AddRenderer( mCurrentRenderer );
-  }
+    Self().RemoveRenderer( mTileRenderer );
+    mTileRenderer.SetProperty( mProgressIndex, 0.f );
 
-  for( ActorArray::iterator it = mTargetTiles.begin(); it != mTargetTiles.end(); ++it )
-  {
-    it->SetProperty( Actor::Property::COLOR, HALF_BRIGHTNESS );
-  }
-  if( mTargetRenderer )
-  {
-    for( ActorArray::iterator it = mTargetTiles.begin(); it != mTargetTiles.end(); ++it )
+    if( mCurrentRenderer )
     {
-      it->RemoveRenderer( mTargetRenderer );
+      Self().AddRenderer( mCurrentRenderer );
     }
+    mIsAnimating = false;
   }
 }
 
 void CubeTransitionEffect::OnTransitionFinished(Animation& source)
 {
-
-  std::swap( mCurrentTiles, mTargetTiles );
-  std::swap( mCurrentRenderer, mTargetRenderer );
   std::swap( mCurrentTexture, mTargetTexture );
 
+  if( mCurrentRenderer && mCurrentTexture )
+  {
+    TextureSet textureSet = mCurrentRenderer.GetTextures();
+    textureSet.SetTexture( 0u, mCurrentTexture );
+  }
+
   ResetToInitialState();
 
   //Emit signal
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/animation/animation.h>
 #include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/transition-effects/cube-transition-effect.h>
@@ -150,8 +151,8 @@ protected:
   CubeTransitionEffect( unsigned int numRows, unsigned int numColumns );
 
   /**
-   * Initialization steps: creating a layer, two groups of tiles,
-   * and one group of actors (cubes) serving as parents of every two tiles (one from each image).
+   * Initialization steps: creating the description of the tiles, one per cube.
+   * The tiles are drawn by a single renderer whose geometry holds the current and the target face of every cube.
    */
   void Initialize();
 
@@ -162,6 +163,19 @@ protected:
   void SetTargetTop( unsigned int idx );
   void SetTargetBottom( unsigned int idx );
 
+  /**
+   * Set the animation of a cube, called by the derived classes in OnStartTransition().
+   * The cube is rotated from its rest orientation to the given angle, and displaced by the given vector and back
+   * with a BOUNCE alpha function. The delay and the duration are fractions of the transition duration.
+   * @param[in] idx The index of the cube
+   * @param[in] axis The normalized rotation axis
+   * @param[in] angle The rotation angle at the end of the animation
+   * @param[in] displacement The displacement at the middle of the animation
+   * @param[in] delay The delay before the cube starts to rotate, in the range [0,1]
+   * @param[in] duration The rotation duration, in the range (0,1]
+   */
+  void SetTileAnimation( unsigned int idx, const Vector3& axis, float angle, const Vector3& displacement, float delay = 0.f, float duration = 1.f );
+
 private:
 
   /**
@@ -179,7 +193,8 @@ private:
 
   /**
    * This method is called after the a new transition is activated.
-   * Derived classes should do any specialized transition process by overriding this method.
+   * Derived classes should do any specialized transition process by overriding this method,
+   * setting the target face and the animation of every cube with SetTileAnimation().
    * @param[in] panPosition The press down position of panGesture
    * @param[in] panDisplacement The displacement vector of panGesture
    */
@@ -196,23 +211,63 @@ private:
 
   void ResetToInitialState();
 
+  /**
+   * Create the renderer drawing the tiles during the transition.
+   */
+  void CreateTileRenderer();
+
+  /**
+   * Fill the vertex buffer of the tile renderer from the tile descriptions and the current tile size.
+   */
+  void UpdateTileGeometry();
+
 
 protected:
-  typedef std::vector< Actor > ActorArray;
   enum FACE { TOP, BOTTOM, LEFT, RIGHT };
 
-  ActorArray                 mBoxes;
-  Vector< FACE >             mBoxType;
-  ActorArray                 mCurrentTiles;
-  ActorArray                 mTargetTiles;
+  /**
+   * The alpha function of the cube rotation, evaluated in the vertex shader.
+   */
+  enum RotationAlphaFunction
+  {
+    ROTATION_LINEAR,
+    ROTATION_EASE_OUT_SINE,
+    ROTATION_EASE_IN_OUT_SINE
+  };
 
-  Actor                      mBoxRoot;
+  /**
+   * The description of a cube, turned into the vertex attributes of its two faces.
+   */
+  struct Tile
+  {
+    Tile()
+    : targetFace( RIGHT ),
+      axis( Vector3::YAXIS ),
+      angle( 0.f ),
+      displacement(),
+      delay( 0.f ),
+      duration( 1.f )
+    {
+    }
+
+    FACE    targetFace;   ///< The face of the cube showing the target texture
+    Vector3 axis;         ///< The rotation axis
+    float   angle;        ///< The rotation angle at the end of the animation
+    Vector3 displacement; ///< The displacement at the middle of the animation
+    float   delay;        ///< The rotation delay, as a fraction of the transition duration
+    float   duration;     ///< The rotation duration, as a fraction of the transition duration
+  };
+
+  std::vector< Tile >        mTiles;
 
   unsigned int               mRows;
   unsigned int               mColumns;
 
   Renderer                   mCurrentRenderer;
-  Renderer                   mTargetRenderer;
+  Renderer                   mTileRenderer;
+  VertexBuffer               mTileVertices;
+  Property::Index            mProgressIndex;
+  RotationAlphaFunction      mRotationAlphaFunction;
 
   Texture                    mCurrentTexture;
   Texture                    mTargetTexture;
@@ -227,9 +282,6 @@ protected:
   float                      mAnimationDuration;
   float                      mCubeDisplacement;
 
-  static const Vector4       FULL_BRIGHTNESS;
-  static const Vector4       HALF_BRIGHTNESS;
-
 private:
 
   Toolkit::CubeTransitionEffect::TransitionCompletedSignalType mTransitionCompletedSignal;
@@ -29,6 +29,7 @@ namespace Internal
 CubeTransitionFoldEffect::CubeTransitionFoldEffect( unsigned int numRows, unsigned int numColumns )
 : CubeTransitionEffect( numRows, numColumns )
 {
+  mRotationAlphaFunction = ROTATION_LINEAR;
 }
 
 Toolkit::CubeTransitionFoldEffect CubeTransitionFoldEffect::New(unsigned int numRows, unsigned int numColumns )
@@ -112,9 +113,6 @@ void CubeTransitionFoldEffect::OnStartTransition( Vector2 panPosition, Vector2 p
       SetupAnimation( idx + x, x, -angle );
     }
   }
-
-  mAnimation.Play();
-  mIsAnimating = true;
 }
 
 void CubeTransitionFoldEffect::SetupAnimation( unsigned int actorIndex, unsigned int x, float angle )
@@ -132,12 +130,7 @@ void CubeTransitionFoldEffect::SetupAnimation( unsigned int actorIndex, unsigned
 
   float delta = (float)x * mTileSize.x * ( 1.4142f - 1.0f );
 
-  Vector3 position( mBoxes[ actorIndex ].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ) );
-  mAnimation.AnimateTo( Property( mBoxes[ actorIndex ], Actor::Property::ORIENTATION ), Quaternion( Radian( angle ), Vector3::YAXIS ), AlphaFunction::LINEAR );
-  mAnimation.AnimateTo( Property( mBoxes[ actorIndex ], Actor::Property::POSITION_X ), position.x + delta, AlphaFunction::BOUNCE );
-
-  mAnimation.AnimateTo( Property( mCurrentTiles[ actorIndex ], Actor::Property::COLOR ), HALF_BRIGHTNESS, AlphaFunction::EASE_OUT );
-  mAnimation.AnimateTo( Property( mTargetTiles[ actorIndex ], Actor::Property::COLOR ), FULL_BRIGHTNESS, AlphaFunction::EASE_IN );
+  SetTileAnimation( actorIndex, Vector3::YAXIS, angle, Vector3( delta, 0.f, 0.f ) );
 }
 
 } // namespace Internal
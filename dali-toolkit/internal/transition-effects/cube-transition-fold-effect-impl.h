@@ -69,7 +69,7 @@ private:
    CubeTransitionFoldEffect( unsigned int numRows, unsigned int numColumns );
 
    /**
-    * Set up animation to an Actor
+    * Set up the animation of a cube
     * @param[in] actorIndex The index of the cube in the cube array
     * @param[in] angle The angle of the rotation animation
     */
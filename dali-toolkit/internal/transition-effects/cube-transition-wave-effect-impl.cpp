@@ -33,6 +33,7 @@ CubeTransitionWaveEffect::CubeTransitionWaveEffect( unsigned int numRows, unsign
   mSaddleBB( 1.f ),
   mSaddleB( 1.f )
 {
+  mRotationAlphaFunction = ROTATION_EASE_OUT_SINE;
 }
 
 Toolkit::CubeTransitionWaveEffect CubeTransitionWaveEffect::New(unsigned int numRows, unsigned int numColumns )
@@ -51,7 +52,7 @@ Toolkit::CubeTransitionWaveEffect CubeTransitionWaveEffect::New(unsigned int num
 
 void CubeTransitionWaveEffect::OnInitialize()
 {
-  for( unsigned int idx = 0; idx < mTargetTiles.size(); idx++ )
+  for( unsigned int idx = 0; idx < mTiles.size(); idx++ )
   {
     SetTargetRight( idx );
   }
@@ -67,7 +68,7 @@ void CubeTransitionWaveEffect::OnStartTransition( Vector2 panPosition, Vector2 p
   unsigned int idx;
   if( forward )
   {
-    for( idx = 0; idx < mTargetTiles.size(); idx++ )
+    for( idx = 0; idx < mTiles.size(); idx++ )
     {
       SetTargetRight( idx );
     }
@@ -75,36 +76,25 @@ void CubeTransitionWaveEffect::OnStartTransition( Vector2 panPosition, Vector2 p
   else
   {
     angle = -angle;
-    for( idx = 0; idx < mTargetTiles.size(); idx++ )
+    for( idx = 0; idx < mTiles.size(); idx++ )
     {
       SetTargetLeft( idx );
     }
   }
 
-  float thirdAnimationDuration = mAnimationDuration / 3.f;
+  const float third = 1.f / 3.f;
 
   for( unsigned int y = 0; y < mRows; y++ )
   {
     idx = y * mColumns;
     for( unsigned int x = 0; x < mColumns; x++, idx++)
     {
-      // the delay value is within 0.f ~ 2.f*thirdAnimationDuration
-      float delay = thirdAnimationDuration * CalculateDelay( x * mTileSize.width, y * mTileSize.height, forward );
-
-      mAnimation.AnimateTo( Property( mBoxes[ idx ], Actor::Property::ORIENTATION ), Quaternion( Radian( -angle ), Vector3::YAXIS ),
-                            AlphaFunction::EASE_OUT_SINE, TimePeriod( delay, thirdAnimationDuration ) );
-      mAnimation.AnimateBy( Property( mBoxes[idx], Actor::Property::POSITION ), Vector3( 0.f, 0.f, -mCubeDisplacement ),
-                         AlphaFunction::BOUNCE, TimePeriod( delay, thirdAnimationDuration ) );
-
-      mAnimation.AnimateTo( Property( mCurrentTiles[ idx ], Actor::Property::COLOR ), HALF_BRIGHTNESS,
-                          AlphaFunction::EASE_OUT, TimePeriod( delay, thirdAnimationDuration ) );
-      mAnimation.AnimateTo( Property( mTargetTiles[ idx ], Actor::Property::COLOR ), FULL_BRIGHTNESS,
-                          AlphaFunction::EASE_IN, TimePeriod( delay, thirdAnimationDuration ) );
+      // the delay value is within 0.f ~ 2.f*third of the transition duration
+      float delay = third * CalculateDelay( x * mTileSize.width, y * mTileSize.height, forward );
+
+      SetTileAnimation( idx, Vector3::YAXIS, -angle, Vector3( 0.f, 0.f, -mCubeDisplacement ), delay, third );
     }
   }
-
-  mAnimation.Play();
-  mIsAnimating = true;
 }
 
 void  CubeTransitionWaveEffect::CalculateSaddleSurfaceParameters( Vector2 position, Vector2 displacement )
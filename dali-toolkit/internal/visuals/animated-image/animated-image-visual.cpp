@@ -21,6 +21,8 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 // INTERNAL INCLUDES
@@ -66,6 +68,7 @@ DALI_ENUM_TO_STRING_TABLE_END( WRAP_MODE )
 
 const Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 constexpr auto LOOP_FOREVER = -1;
+constexpr int ALPHA_COMPONENT_INDEX = 3;
 
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gAnimImgLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_ANIMATED_IMAGE");
@@ -170,6 +173,10 @@ AnimatedImageVisual::AnimatedImageVisual( VisualFactoryCache& factoryCache, Imag
 : Visual::Base( factoryCache, Visual::FittingMode::FIT_KEEP_ASPECT_RATIO, Toolkit::Visual::ANIMATED_IMAGE ),
   mFrameDelayTimer(),
   mPlacementActor(),
+  mCulledNotification(),
+  mOpacityNotification(),
+  mSuspendedTime(),
+  mSuspendedPlayingTime( 0u ),
   mImageVisualShaderFactory( shaderFactory ),
   mPixelArea( FULL_TEXTURE_RECT ),
   mImageUrl(),
@@ -184,13 +191,15 @@ AnimatedImageVisual::AnimatedImageVisual( VisualFactoryCache& factoryCache, Imag
   mCurrentLoopIndex( 0 ),
   mUrlIndex( 0 ),
   mFrameCount( 0 ),
+  mSkippedFrameCount( 0 ),
   mImageSize(),
   mWrapModeU( WrapMode::DEFAULT ),
   mWrapModeV( WrapMode::DEFAULT ),
   mActionStatus( DevelAnimatedImageVisual::Action::PLAY ),
   mStopBehavior( DevelImageVisual::StopBehavior::CURRENT_FRAME ),
   mStartFirstFrame(false),
-  mIsJumpTo( false )
+  mIsJumpTo( false ),
+  mSuspended( false )
 {}
 
 AnimatedImageVisual::~AnimatedImageVisual()
@@ -251,6 +260,7 @@ void AnimatedImageVisual::DoCreatePropertyMap( Property::Map& map ) const
   map.Insert( Toolkit::DevelImageVisual::Property::LOOP_COUNT, static_cast<int>(mLoopCount) );
 
   map.Insert( Toolkit::DevelImageVisual::Property::STOP_BEHAVIOR, mStopBehavior );
+  map.Insert( Toolkit::DevelImageVisual::Property::SKIPPED_FRAME_COUNT, static_cast<int>(mSkippedFrameCount) );
 }
 
 void AnimatedImageVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
@@ -266,13 +276,17 @@ void AnimatedImageVisual::OnDoAction( const Dali::Property::Index actionId, cons
   {
     case DevelAnimatedImageVisual::Action::PAUSE:
     {
+      AccumulateSuspendedPlayingTime();
+
       // Pause will be executed on next timer tick
       mActionStatus = DevelAnimatedImageVisual::Action::PAUSE;
       break;
     }
     case DevelAnimatedImageVisual::Action::PLAY:
     {
-      if( mFrameDelayTimer && IsOnScene() && mActionStatus != DevelAnimatedImageVisual::Action::PLAY )
+      AccumulateSuspendedPlayingTime();
+
+      if( mFrameDelayTimer && IsOnScene() && mActionStatus != DevelAnimatedImageVisual::Action::PLAY && !mSuspended )
       {
         mFrameDelayTimer.Start();
       }
@@ -281,6 +295,10 @@ void AnimatedImageVisual::OnDoAction( const Dali::Property::Index actionId, cons
     }
     case DevelAnimatedImageVisual::Action::STOP:
     {
+      // The stopped animation does not skip the frames played while suspended
+      AccumulateSuspendedPlayingTime();
+      mSuspendedPlayingTime = 0u;
+
       // STOP reset functionality will actually be done in a future change
       // Stop will be executed on next timer tick
       mActionStatus = DevelAnimatedImageVisual::Action::STOP;
@@ -301,6 +319,10 @@ void AnimatedImageVisual::OnDoAction( const Dali::Property::Index actionId, cons
         }
         else
         {
+          // The animation continues from the new frame, so the time it played while suspended before is not skipped
+          AccumulateSuspendedPlayingTime();
+          mSuspendedPlayingTime = 0u;
+
           mIsJumpTo = true;
           mCurrentFrameIndex = frameNumber;
           if( IsOnScene() )
@@ -487,6 +509,15 @@ void AnimatedImageVisual::DoSetOnScene( Actor& actor )
   TextureSet textureSet = PrepareTextureSet();
   CreateRenderer(); // Always create a renderer when on stage
 
+  // Suspend the animation while the actor is culled or fully transparent
+  mCulledNotification = actor.AddPropertyNotification( Actor::Property::CULLED, LessThanCondition( 0.5f ) );
+  mCulledNotification.SetNotifyMode( PropertyNotification::NOTIFY_ON_CHANGED );
+  mCulledNotification.NotifySignal().Connect( this, &AnimatedImageVisual::OnVisibilityNotification );
+
+  mOpacityNotification = actor.AddPropertyNotification( Actor::Property::WORLD_COLOR, ALPHA_COMPONENT_INDEX, GreaterThanCondition( 0.0f ) );
+  mOpacityNotification.SetNotifyMode( PropertyNotification::NOTIFY_ON_CHANGED );
+  mOpacityNotification.NotifySignal().Connect( this, &AnimatedImageVisual::OnVisibilityNotification );
+
   if( textureSet ) // if the image loading is successful
   {
     StartFirstFrame( textureSet );
@@ -507,6 +538,12 @@ void AnimatedImageVisual::DoSetOffScene( Actor& actor )
     mFrameDelayTimer.Reset();
   }
 
+  actor.RemovePropertyNotification( mCulledNotification );
+  actor.RemovePropertyNotification( mOpacityNotification );
+  mCulledNotification.Reset();
+  mOpacityNotification.Reset();
+  mSuspended = false;
+
   actor.RemoveRenderer( mImpl->mRenderer );
   mImpl->mRenderer.Reset();
   mPlacementActor.Reset();
@@ -629,7 +666,10 @@ void AnimatedImageVisual::StartFirstFrame( TextureSet& textureSet )
     }
     mFrameDelayTimer = Timer::New( frameDelay );
     mFrameDelayTimer.TickSignal().Connect( this, &AnimatedImageVisual::DisplayNextFrame );
-    mFrameDelayTimer.Start();
+    if( !mSuspended )
+    {
+      mFrameDelayTimer.Start();
+    }
   }
   DALI_LOG_INFO(gAnimImgLogFilter,Debug::Concise,"ResourceReady(ResourceStatus::READY)\n");
   ResourceReady( Toolkit::Visual::ResourceStatus::READY );
@@ -766,6 +806,149 @@ bool AnimatedImageVisual::DisplayNextFrame()
 }
 
 
+uint32_t AnimatedImageVisual::GetFrameInterval( uint32_t frameIndex ) const
+{
+  if( mAnimatedImageLoading && mImageCache )
+  {
+    return mImageCache->GetFrameInterval( frameIndex );
+  }
+  return mFrameDelay;
+}
+
+void AnimatedImageVisual::OnVisibilityNotification( PropertyNotification& source )
+{
+  Actor actor = Actor::DownCast( source.GetTarget() );
+  if( actor )
+  {
+    bool culled = actor.GetCurrentProperty< bool >( Actor::Property::CULLED );
+    bool transparent = actor.GetCurrentProperty< Vector4 >( Actor::Property::WORLD_COLOR ).a <= 0.0f;
+
+    SetSuspended( culled || transparent );
+  }
+}
+
+void AnimatedImageVisual::SetSuspended( bool suspended )
+{
+  if( mSuspended == suspended )
+  {
+    return;
+  }
+
+  if( suspended )
+  {
+    mSuspended = true;
+    mSuspendedTime = std::chrono::steady_clock::now();
+    mSuspendedPlayingTime = 0u;
+  }
+  else
+  {
+    // Only the time the animation was playing is skipped, not the time it was paused or stopped
+    AccumulateSuspendedPlayingTime();
+    mSuspended = false;
+  }
+
+  DALI_LOG_INFO( gAnimImgLogFilter, Debug::Concise, "AnimatedImageVisual::SetSuspended(this:%p) suspended:%d\n", this, suspended );
+
+  if( !mFrameDelayTimer )
+  {
+    // The first frame is not displayed yet
+    return;
+  }
+
+  if( suspended )
+  {
+    mFrameDelayTimer.Stop();
+  }
+  else
+  {
+    if( mActionStatus == DevelAnimatedImageVisual::Action::PLAY || mSuspendedPlayingTime > 0u )
+    {
+      SkipFrames( mSuspendedPlayingTime );
+
+      // Display the frame the animation would have reached
+      mIsJumpTo = true;
+      DisplayNextFrame();
+    }
+    mSuspendedPlayingTime = 0u;
+
+    if( mActionStatus == DevelAnimatedImageVisual::Action::PLAY )
+    {
+      mFrameDelayTimer.Start();
+    }
+  }
+}
+
+void AnimatedImageVisual::AccumulateSuspendedPlayingTime()
+{
+  if( !mSuspended )
+  {
+    return;
+  }
+
+  const auto current = std::chrono::steady_clock::now();
+  if( mActionStatus == DevelAnimatedImageVisual::Action::PLAY )
+  {
+    mSuspendedPlayingTime += static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::milliseconds >( current - mSuspendedTime ).count() );
+  }
+  mSuspendedTime = current;
+}
+
+void AnimatedImageVisual::SkipFrames( uint64_t elapsedTime )
+{
+  if( mFrameCount <= 1 )
+  {
+    return;
+  }
+
+  uint64_t skippedFrameCount = 0;
+
+  // Skip the whole loops at once if the animation loops forever
+  if( mLoopCount < 0 )
+  {
+    uint64_t loopDuration = 0;
+    for( uint32_t i = 0; i < mFrameCount; ++i )
+    {
+      loopDuration += GetFrameInterval( i );
+    }
+
+    if( loopDuration > 0 )
+    {
+      skippedFrameCount += ( elapsedTime / loopDuration ) * mFrameCount;
+      elapsedTime %= loopDuration;
+    }
+  }
+
+  while( true )
+  {
+    uint32_t interval = GetFrameInterval( mCurrentFrameIndex );
+    if( interval == 0 || elapsedTime < interval )
+    {
+      break;
+    }
+
+    elapsedTime -= interval;
+    ++skippedFrameCount;
+
+    if( ++mCurrentFrameIndex >= mFrameCount )
+    {
+      mCurrentFrameIndex = 0;
+      ++mCurrentLoopIndex;
+
+      if( mLoopCount >= 0 && mCurrentLoopIndex >= mLoopCount )
+      {
+        // The animation would have finished
+        mActionStatus = DevelAnimatedImageVisual::Action::STOP;
+        mCurrentLoopIndex = 0;
+        mCurrentFrameIndex = ( mStopBehavior == DevelImageVisual::StopBehavior::FIRST_FRAME ) ? 0 : mFrameCount - 1;
+        break;
+      }
+    }
+  }
+
+  // Saturate rather than wrap around after a very long suspension
+  mSkippedFrameCount = static_cast< uint32_t >( std::min< uint64_t >( mSkippedFrameCount + skippedFrameCount, std::numeric_limits< uint32_t >::max() ) );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -24,7 +24,9 @@
 #include <dali/public-api/math/vector4.h>
 #include <dali/public-api/object/weak-handle.h>
 #include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/object/property-notification.h>
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
+#include <chrono>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
@@ -224,6 +226,38 @@ private:
    */
   bool DisplayNextFrame();
 
+  /**
+   * Get the interval of the frame.
+   * @param[in] frameIndex The index of the frame
+   * @return The interval in milliseconds
+   */
+  uint32_t GetFrameInterval( uint32_t frameIndex ) const;
+
+  /**
+   * Callback when the actor is culled or becomes fully transparent, or vice versa.
+   */
+  void OnVisibilityNotification( PropertyNotification& source );
+
+  /**
+   * Suspend or resume the animation.
+   * The frame timer is stopped and no frame is decoded while the animation is suspended.
+   * When it is resumed, the frames which would have been displayed while it was playing in the meantime are skipped.
+   * @param[in] suspended Whether the animation is suspended
+   */
+  void SetSuspended( bool suspended );
+
+  /**
+   * Add the time the animation has been playing since the suspended time, and restart it.
+   * Called before the action status changes while the animation is suspended.
+   */
+  void AccumulateSuspendedPlayingTime();
+
+  /**
+   * Move the current frame forward as if the frames had been displayed for the given time.
+   * @param[in] elapsedTime The elapsed time in milliseconds
+   */
+  void SkipFrames( uint64_t elapsedTime );
+
   /**
    * Initialize the animated image variables.
    * @param[in] imageUrl The url of the animated image
@@ -240,6 +274,10 @@ private:
 
   Timer mFrameDelayTimer;
   WeakHandle<Actor> mPlacementActor;
+  PropertyNotification mCulledNotification;
+  PropertyNotification mOpacityNotification;
+  std::chrono::steady_clock::time_point mSuspendedTime; // Since when the playing time while suspended is not accumulated yet
+  uint64_t mSuspendedPlayingTime; // The time in milliseconds the animation has been playing while suspended
   ImageVisualShaderFactory& mImageVisualShaderFactory;
 
   // Variables for Animated Image player
@@ -260,6 +298,7 @@ private:
 
   // Shared variables
   uint32_t mFrameCount; // Number of frames
+  uint32_t mSkippedFrameCount; // Number of frames skipped while suspended, saturated at the maximum value
   ImageDimensions mImageSize;
 
   Dali::WrapMode::Type mWrapModeU:3;
@@ -268,6 +307,7 @@ private:
   DevelImageVisual::StopBehavior::Type   mStopBehavior:2;
   bool mStartFirstFrame:1;
   bool mIsJumpTo:1;
+  bool mSuspended:1;
 };
 
 } // namespace Internal
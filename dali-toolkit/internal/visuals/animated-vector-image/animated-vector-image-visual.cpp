@@ -48,6 +48,7 @@ namespace
 {
 
 const Dali::Vector4 FULL_TEXTURE_RECT( 0.f, 0.f, 1.f, 1.f );
+constexpr int ALPHA_COMPONENT_INDEX = 3;
 
 // stop behavior
 DALI_ENUM_TO_STRING_TABLE_BEGIN( STOP_BEHAVIOR )
@@ -79,6 +80,7 @@ AnimatedVectorImageVisualPtr AnimatedVectorImageVisual::New( VisualFactoryCache&
 AnimatedVectorImageVisualPtr AnimatedVectorImageVisual::New( VisualFactoryCache& factoryCache, ImageVisualShaderFactory& shaderFactory, const VisualUrl& imageUrl )
 {
   AnimatedVectorImageVisualPtr visual( new AnimatedVectorImageVisual( factoryCache, shaderFactory, imageUrl ) );
+  visual->UpdateTaskUsage();
 
   return visual;
 }
@@ -87,20 +89,20 @@ AnimatedVectorImageVisual::AnimatedVectorImageVisual( VisualFactoryCache& factor
 : Visual::Base( factoryCache, Visual::FittingMode::FILL, static_cast<Toolkit::Visual::Type>( Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE ) ),
   mUrl( imageUrl ),
   mAnimationData(),
-  mVectorAnimationTask( new VectorAnimationTask( factoryCache, imageUrl.GetUrl() ) ),
+  mVectorAnimationTask(),
+  mSharedVectorAnimationTask(),
   mImageVisualShaderFactory( shaderFactory ),
   mVisualSize(),
   mVisualScale( Vector2::ONE ),
   mPlacementActor(),
   mPlayState( DevelImageVisual::PlayState::STOPPED ),
   mEventCallback( nullptr ),
-  mRendererAdded( false )
+  mRendererAdded( false ),
+  mSharedRasterization( false ),
+  mUseSharedTask( false )
 {
   // the rasterized image is with pre-multiplied alpha format
   mImpl->mFlags |= Impl::IS_PREMULTIPLIED_ALPHA;
-
-  mVectorAnimationTask->UploadCompletedSignal().Connect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
-  mVectorAnimationTask->SetAnimationFinishedCallback( new EventThreadCallback( MakeCallback( this, &AnimatedVectorImageVisual::OnAnimationFinished ) ) );
 }
 
 AnimatedVectorImageVisual::~AnimatedVectorImageVisual()
@@ -110,9 +112,9 @@ AnimatedVectorImageVisual::~AnimatedVectorImageVisual()
     mFactoryCache.GetVectorAnimationManager().UnregisterEventCallback( mEventCallback );
   }
 
-  // Finalize animation task and disconnect the signal in the main thread
-  mVectorAnimationTask->UploadCompletedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
-  mVectorAnimationTask->Finalize();
+  ReleaseSharedTask();
+
+  DestroyVectorAnimationTask();
 }
 
 void AnimatedVectorImageVisual::GetNaturalSize( Vector2& naturalSize )
@@ -123,8 +125,16 @@ void AnimatedVectorImageVisual::GetNaturalSize( Vector2& naturalSize )
   }
   else
   {
+    VectorAnimationTaskPtr task = GetActiveTask();
+    if( !task )
+    {
+      // The default size is known only by loading the file
+      CreateVectorAnimationTask();
+      task = mVectorAnimationTask;
+    }
+
     uint32_t width, height;
-    mVectorAnimationTask->GetDefaultSize( width, height );
+    task->GetDefaultSize( width, height );
     naturalSize.x = width;
     naturalSize.y = height;
   }
@@ -142,24 +152,40 @@ void AnimatedVectorImageVisual::DoCreatePropertyMap( Property::Map& map ) const
   }
   map.Insert( Toolkit::DevelImageVisual::Property::LOOP_COUNT, mAnimationData.loopCount );
 
-  uint32_t startFrame, endFrame;
-  mVectorAnimationTask->GetPlayRange( startFrame, endFrame );
-
-  Property::Array playRange;
-  playRange.PushBack( static_cast< int32_t >( startFrame ) );
-  playRange.PushBack( static_cast< int32_t >( endFrame ) );
-  map.Insert( Toolkit::DevelImageVisual::Property::PLAY_RANGE, playRange );
-
   map.Insert( Toolkit::DevelImageVisual::Property::PLAY_STATE, static_cast< int32_t >( mPlayState ) );
-  map.Insert( Toolkit::DevelImageVisual::Property::CURRENT_FRAME_NUMBER, static_cast< int32_t >( mVectorAnimationTask->GetCurrentFrameNumber() ) );
-  map.Insert( Toolkit::DevelImageVisual::Property::TOTAL_FRAME_NUMBER, static_cast< int32_t >( mVectorAnimationTask->GetTotalFrameNumber() ) );
-
   map.Insert( Toolkit::DevelImageVisual::Property::STOP_BEHAVIOR, mAnimationData.stopBehavior );
   map.Insert( Toolkit::DevelImageVisual::Property::LOOPING_MODE, mAnimationData.loopingMode );
+  map.Insert( Toolkit::DevelImageVisual::Property::SHARED_RASTERIZATION, mSharedRasterization );
+
+  VectorAnimationTaskPtr task = GetActiveTask();
+  if( task )
+  {
+    uint32_t startFrame, endFrame;
+    task->GetPlayRange( startFrame, endFrame );
 
-  Property::Map layerInfo;
-  mVectorAnimationTask->GetLayerInfo( layerInfo );
-  map.Insert( Toolkit::DevelImageVisual::Property::CONTENT_INFO, layerInfo );
+    Property::Array playRange;
+    playRange.PushBack( static_cast< int32_t >( startFrame ) );
+    playRange.PushBack( static_cast< int32_t >( endFrame ) );
+    map.Insert( Toolkit::DevelImageVisual::Property::PLAY_RANGE, playRange );
+
+    map.Insert( Toolkit::DevelImageVisual::Property::CURRENT_FRAME_NUMBER, static_cast< int32_t >( task->GetCurrentFrameNumber() ) );
+    map.Insert( Toolkit::DevelImageVisual::Property::TOTAL_FRAME_NUMBER, static_cast< int32_t >( task->GetTotalFrameNumber() ) );
+
+    Property::Map layerInfo;
+    task->GetLayerInfo( layerInfo );
+    map.Insert( Toolkit::DevelImageVisual::Property::CONTENT_INFO, layerInfo );
+
+    map.Insert( Toolkit::DevelImageVisual::Property::SKIPPED_FRAME_COUNT, static_cast< int32_t >( task->GetSkippedFrameCount() ) );
+  }
+  else
+  {
+    // No task has loaded the file yet, so report the state of this visual
+    map.Insert( Toolkit::DevelImageVisual::Property::PLAY_RANGE, mAnimationData.playRange );
+    map.Insert( Toolkit::DevelImageVisual::Property::CURRENT_FRAME_NUMBER, static_cast< int32_t >( mAnimationData.currentFrame ) );
+    map.Insert( Toolkit::DevelImageVisual::Property::TOTAL_FRAME_NUMBER, 0 );
+    map.Insert( Toolkit::DevelImageVisual::Property::CONTENT_INFO, Property::Map() );
+    map.Insert( Toolkit::DevelImageVisual::Property::SKIPPED_FRAME_COUNT, 0 );
+  }
 }
 
 void AnimatedVectorImageVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
@@ -195,9 +221,19 @@ void AnimatedVectorImageVisual::DoSetProperties( const Property::Map& propertyMa
        {
           DoSetProperty( Toolkit::DevelImageVisual::Property::LOOPING_MODE, keyValue.second );
        }
+       else if( keyValue.first == SHARED_RASTERIZATION_NAME )
+       {
+          DoSetProperty( Toolkit::DevelImageVisual::Property::SHARED_RASTERIZATION, keyValue.second );
+       }
     }
   }
 
+  if( !IsOnScene() )
+  {
+    // The usage is kept while the visual is on scene
+    UpdateTaskUsage();
+  }
+
   TriggerVectorRasterization();
 }
 
@@ -245,6 +281,15 @@ void AnimatedVectorImageVisual::DoSetProperty( Property::Index index, const Prop
       }
       break;
     }
+    case Toolkit::DevelImageVisual::Property::SHARED_RASTERIZATION:
+    {
+      bool sharedRasterization;
+      if( value.Get( sharedRasterization ) )
+      {
+        mSharedRasterization = sharedRasterization;
+      }
+      break;
+    }
   }
 }
 
@@ -280,7 +325,12 @@ void AnimatedVectorImageVisual::DoSetOnScene( Actor& actor )
   // Hold the weak handle of the placement actor and delay the adding of renderer until the rasterization is finished.
   mPlacementActor = actor;
 
-  mVectorAnimationTask->SetRenderer( mImpl->mRenderer );
+  // The shared task is acquired when the size is given
+  UpdateTaskUsage();
+  if( !mUseSharedTask )
+  {
+    mVectorAnimationTask->SetRenderer( mImpl->mRenderer );
+  }
 
   // Add property notification for scaling & size
   mScaleNotification = actor.AddPropertyNotification( Actor::Property::WORLD_SCALE, StepCondition( 0.1f, 1.0f ) );
@@ -289,6 +339,15 @@ void AnimatedVectorImageVisual::DoSetOnScene( Actor& actor )
   mSizeNotification = actor.AddPropertyNotification( Actor::Property::SIZE, StepCondition( 3.0f ) );
   mSizeNotification.NotifySignal().Connect( this, &AnimatedVectorImageVisual::OnSizeNotification );
 
+  // Add property notification for the effective visibility
+  mCulledNotification = actor.AddPropertyNotification( Actor::Property::CULLED, LessThanCondition( 0.5f ) );
+  mCulledNotification.SetNotifyMode( PropertyNotification::NOTIFY_ON_CHANGED );
+  mCulledNotification.NotifySignal().Connect( this, &AnimatedVectorImageVisual::OnVisibilityNotification );
+
+  mOpacityNotification = actor.AddPropertyNotification( Actor::Property::WORLD_COLOR, ALPHA_COMPONENT_INDEX, GreaterThanCondition( 0.0f ) );
+  mOpacityNotification.SetNotifyMode( PropertyNotification::NOTIFY_ON_CHANGED );
+  mOpacityNotification.NotifySignal().Connect( this, &AnimatedVectorImageVisual::OnVisibilityNotification );
+
   DevelActor::VisibilityChangedSignal( actor ).Connect( this, &AnimatedVectorImageVisual::OnControlVisibilityChanged );
 
   Window window = DevelWindow::Get( actor );
@@ -303,8 +362,17 @@ void AnimatedVectorImageVisual::DoSetOnScene( Actor& actor )
 void AnimatedVectorImageVisual::DoSetOffScene( Actor& actor )
 {
   StopAnimation();
+
+  if( mAnimationData.suspended )
+  {
+    mAnimationData.suspended = false;
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SUSPENDED;
+  }
+
   SendAnimationData();
 
+  ReleaseSharedTask();
+
   if( mImpl->mRenderer )
   {
     actor.RemoveRenderer( mImpl->mRenderer );
@@ -316,6 +384,8 @@ void AnimatedVectorImageVisual::DoSetOffScene( Actor& actor )
   // Remove property notification
   actor.RemovePropertyNotification( mScaleNotification );
   actor.RemovePropertyNotification( mSizeNotification );
+  actor.RemovePropertyNotification( mCulledNotification );
+  actor.RemovePropertyNotification( mOpacityNotification );
 
   DevelActor::VisibilityChangedSignal( actor ).Disconnect( this, &AnimatedVectorImageVisual::OnControlVisibilityChanged );
 
@@ -424,6 +494,16 @@ void AnimatedVectorImageVisual::OnUploadCompleted()
   Actor actor = mPlacementActor.GetHandle();
   if( actor && !mRendererAdded )
   {
+    if( mSharedVectorAnimationTask )
+    {
+      // The shader of the renderer displaying the shared result may have been replaced, e.g. for the native image.
+      Renderer sharedRenderer = mFactoryCache.GetVectorAnimationManager().GetSharedTaskRenderer( mSharedVectorAnimationTask );
+      if( sharedRenderer && sharedRenderer != mImpl->mRenderer )
+      {
+        mImpl->mRenderer.SetShader( sharedRenderer.GetShader() );
+      }
+    }
+
     actor.AddRenderer( mImpl->mRenderer );
     mRendererAdded = true;
 
@@ -459,11 +539,39 @@ void AnimatedVectorImageVisual::SendAnimationData()
 {
   if( mAnimationData.resendFlag )
   {
-    mVectorAnimationTask->SetAnimationData( mAnimationData );
+    if( mUseSharedTask && mSharedVectorAnimationTask )
+    {
+      if( mAnimationData.resendFlag & VectorAnimationTask::RESEND_CURRENT_FRAME )
+      {
+        // The frame of the shared animation can't be moved by an owner, so stop sharing until the visual is staged again
+        UseOwnTask();
+      }
+      else if( mAnimationData.resendFlag & ( VectorAnimationTask::RESEND_PLAY_RANGE | VectorAnimationTask::RESEND_LOOP_COUNT |
+                                             VectorAnimationTask::RESEND_STOP_BEHAVIOR | VectorAnimationTask::RESEND_LOOPING_MODE ) )
+      {
+        // Share the task which has the new playback settings
+        AcquireSharedTask( mAnimationData.width, mAnimationData.height );
+      }
+    }
+
+    if( mUseSharedTask )
+    {
+      if( !mSharedVectorAnimationTask )
+      {
+        // Keep the data until the shared task is acquired
+        return;
+      }
+
+      mFactoryCache.GetVectorAnimationManager().SetSharedAnimationData( mSharedVectorAnimationTask, this, mAnimationData );
+    }
+    else
+    {
+      mVectorAnimationTask->SetAnimationData( mAnimationData );
+    }
 
     if( mImpl->mRenderer )
     {
-      if( mAnimationData.playState == DevelImageVisual::PlayState::PLAYING )
+      if( mAnimationData.playState == DevelImageVisual::PlayState::PLAYING && !mAnimationData.suspended )
       {
         mImpl->mRenderer.SetProperty( DevelRenderer::Property::RENDERING_BEHAVIOR, DevelRenderer::Rendering::CONTINUOUSLY );
       }
@@ -485,6 +593,11 @@ void AnimatedVectorImageVisual::SetVectorImageSize()
   mAnimationData.width = width;
   mAnimationData.height = height;
   mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SIZE;
+
+  if( mUseSharedTask )
+  {
+    AcquireSharedTask( width, height );
+  }
 }
 
 void AnimatedVectorImageVisual::StopAnimation()
@@ -498,6 +611,142 @@ void AnimatedVectorImageVisual::StopAnimation()
   }
 }
 
+void AnimatedVectorImageVisual::UpdateTaskUsage()
+{
+  mUseSharedTask = mSharedRasterization && !mImpl->mCustomShader;
+  if( !mUseSharedTask && !mVectorAnimationTask )
+  {
+    CreateVectorAnimationTask();
+  }
+}
+
+void AnimatedVectorImageVisual::CreateVectorAnimationTask()
+{
+  if( !mVectorAnimationTask )
+  {
+    mVectorAnimationTask = new VectorAnimationTask( mFactoryCache, mUrl.GetUrl() );
+    mVectorAnimationTask->UploadCompletedSignal().Connect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
+    mVectorAnimationTask->SetAnimationFinishedCallback( new EventThreadCallback( MakeCallback( this, &AnimatedVectorImageVisual::OnAnimationFinished ) ) );
+
+    // The data may have been sent to a shared task before
+    ResendAnimationData();
+  }
+}
+
+void AnimatedVectorImageVisual::DestroyVectorAnimationTask()
+{
+  if( mVectorAnimationTask )
+  {
+    // Finalize animation task and disconnect the signal in the main thread
+    mVectorAnimationTask->UploadCompletedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
+    mVectorAnimationTask->Finalize();
+    mVectorAnimationTask.Reset();
+  }
+}
+
+void AnimatedVectorImageVisual::UseOwnTask()
+{
+  ReleaseSharedTask();
+
+  mUseSharedTask = false;
+  CreateVectorAnimationTask();
+
+  if( mImpl->mRenderer )
+  {
+    mVectorAnimationTask->SetRenderer( mImpl->mRenderer );
+  }
+}
+
+void AnimatedVectorImageVisual::ResendAnimationData()
+{
+  mAnimationData.resendFlag |= VectorAnimationTask::RESEND_LOOP_COUNT | VectorAnimationTask::RESEND_STOP_BEHAVIOR | VectorAnimationTask::RESEND_LOOPING_MODE;
+  if( mAnimationData.width != 0 && mAnimationData.height != 0 )
+  {
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SIZE;
+  }
+  if( !mAnimationData.playRange.Empty() )
+  {
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PLAY_RANGE;
+  }
+  if( mAnimationData.playState == DevelImageVisual::PlayState::PLAYING )
+  {
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PLAY_STATE;
+  }
+  if( mAnimationData.suspended )
+  {
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SUSPENDED;
+  }
+}
+
+void AnimatedVectorImageVisual::AcquireSharedTask( uint32_t width, uint32_t height )
+{
+  if( !mImpl->mRenderer || width == 0 || height == 0 )
+  {
+    return;
+  }
+
+  VectorAnimationManager& manager = mFactoryCache.GetVectorAnimationManager();
+
+  if( mSharedVectorAnimationTask )
+  {
+    if( manager.IsSharedTaskCompatible( mSharedVectorAnimationTask, mUrl.GetUrl(), mAnimationData ) )
+    {
+      return;
+    }
+
+    ReleaseSharedTask();
+  }
+
+  TextureSet textureSet;
+  mSharedVectorAnimationTask = manager.AcquireSharedTask( mFactoryCache, mUrl.GetUrl(), mAnimationData, this, mImpl->mRenderer,
+                                                          MakeCallback( this, &AnimatedVectorImageVisual::OnAnimationFinished ), textureSet );
+  mImpl->mRenderer.SetTextures( textureSet );
+
+  mSharedVectorAnimationTask->UploadCompletedSignal().Connect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
+
+  // The own task may have been created only to get the information of the animation
+  DestroyVectorAnimationTask();
+
+  // Send all the playback data to the new task
+  ResendAnimationData();
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::AcquireSharedTask: width = %d, height = %d [%p]\n", width, height, this );
+
+  if( manager.IsSharedTaskUploaded( mSharedVectorAnimationTask ) )
+  {
+    OnUploadCompleted();
+  }
+}
+
+void AnimatedVectorImageVisual::ReleaseSharedTask()
+{
+  if( mSharedVectorAnimationTask )
+  {
+    mSharedVectorAnimationTask->UploadCompletedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
+    mFactoryCache.GetVectorAnimationManager().ReleaseSharedTask( mSharedVectorAnimationTask, this );
+    mSharedVectorAnimationTask.Reset();
+
+    // Stop displaying the shared result
+    if( mImpl->mRenderer )
+    {
+      mImpl->mRenderer.SetTextures( TextureSet::New() );
+    }
+  }
+}
+
+VectorAnimationTaskPtr AnimatedVectorImageVisual::GetActiveTask() const
+{
+  if( mSharedVectorAnimationTask )
+  {
+    return mSharedVectorAnimationTask;
+  }
+  if( mVectorAnimationTask )
+  {
+    return mVectorAnimationTask;
+  }
+  return mFactoryCache.GetVectorAnimationManager().GetSharedTask( mUrl.GetUrl(), mAnimationData );
+}
+
 void AnimatedVectorImageVisual::TriggerVectorRasterization()
 {
   if( !mEventCallback )
@@ -544,6 +793,32 @@ void AnimatedVectorImageVisual::OnSizeNotification( PropertyNotification& source
   }
 }
 
+void AnimatedVectorImageVisual::OnVisibilityNotification( PropertyNotification& source )
+{
+  Actor actor = mPlacementActor.GetHandle();
+  if( actor )
+  {
+    UpdateSuspension( actor );
+  }
+}
+
+void AnimatedVectorImageVisual::UpdateSuspension( Actor actor )
+{
+  bool culled = actor.GetCurrentProperty< bool >( Actor::Property::CULLED );
+  bool transparent = actor.GetCurrentProperty< Vector4 >( Actor::Property::WORLD_COLOR ).a <= 0.0f;
+  bool suspended = culled || transparent;
+
+  if( mAnimationData.suspended != suspended )
+  {
+    mAnimationData.suspended = suspended;
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SUSPENDED;
+
+    SendAnimationData();
+
+    DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::UpdateSuspension: culled = %d, transparent = %d [%p]\n", culled, transparent, this );
+  }
+}
+
 void AnimatedVectorImageVisual::OnControlVisibilityChanged( Actor actor, bool visible, DevelActor::VisibilityChange::Type type )
 {
   if( !visible )
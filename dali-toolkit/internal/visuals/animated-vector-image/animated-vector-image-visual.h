@@ -172,6 +172,52 @@ private:
    */
   void StopAnimation();
 
+  /**
+   * @brief Decide whether the shared task is used and create the own task of this visual if it is not.
+   */
+  void UpdateTaskUsage();
+
+  /**
+   * @brief Create the own task of this visual if it was not created yet.
+   */
+  void CreateVectorAnimationTask();
+
+  /**
+   * @brief Finalize and release the own task of this visual.
+   */
+  void DestroyVectorAnimationTask();
+
+  /**
+   * @brief Release the shared task and rasterize with the own task of this visual until it is staged again.
+   */
+  void UseOwnTask();
+
+  /**
+   * @brief Mark all the playback data to be sent to a new task.
+   */
+  void ResendAnimationData();
+
+  /**
+   * @brief Acquire the task shared with the other visuals rasterizing the same url at the same size with the same playback settings.
+   *
+   * The current shared task is released if it is not compatible any more.
+   * @param[in] width The width of the rasterized image
+   * @param[in] height The height of the rasterized image
+   */
+  void AcquireSharedTask( uint32_t width, uint32_t height );
+
+  /**
+   * @brief Release the shared task if it was acquired.
+   */
+  void ReleaseSharedTask();
+
+  /**
+   * @brief Get the task which rasterizes the frames of this visual.
+   * @return The shared task if it was acquired, the own task of this visual or the shared task compatible with this visual otherwise.
+   * @note An empty handle is returned if the visual shares the rasterization and no task is available yet.
+   */
+  VectorAnimationTaskPtr GetActiveTask() const;
+
   /**
    * @brief Trigger rasterization of the vector content.
    */
@@ -187,6 +233,17 @@ private:
    */
   void OnSizeNotification( PropertyNotification& source );
 
+  /**
+   * @brief Callback when the actor is culled or becomes fully transparent, or vice versa.
+   */
+  void OnVisibilityNotification( PropertyNotification& source );
+
+  /**
+   * @brief Suspend or resume the rasterization according to the effective visibility.
+   * @param[in] actor The placement actor
+   */
+  void UpdateSuspension( Actor actor );
+
   /**
    * @brief Callback when the visibility of the actor is changed.
    */
@@ -211,16 +268,21 @@ private:
 private:
   VisualUrl                                    mUrl;
   VectorAnimationTask::AnimationData           mAnimationData;
-  VectorAnimationTaskPtr                       mVectorAnimationTask;
+  VectorAnimationTaskPtr                       mVectorAnimationTask;  ///< The own task. It is not created while the shared task is used
+  VectorAnimationTaskPtr                       mSharedVectorAnimationTask;
   ImageVisualShaderFactory&                    mImageVisualShaderFactory;
   PropertyNotification                         mScaleNotification;
   PropertyNotification                         mSizeNotification;
+  PropertyNotification                         mCulledNotification;
+  PropertyNotification                         mOpacityNotification;
   Vector2                                      mVisualSize;
   Vector2                                      mVisualScale;
   WeakHandle< Actor >                          mPlacementActor;
   DevelImageVisual::PlayState::Type            mPlayState;
   CallbackBase*                                mEventCallback;    // Not owned
   bool                                         mRendererAdded;
+  bool                                         mSharedRasterization;  ///< Whether the shared rasterization is requested
+  bool                                         mUseSharedTask;        ///< Whether the shared task is used while the visual is on scene
 };
 
 } // namespace Internal
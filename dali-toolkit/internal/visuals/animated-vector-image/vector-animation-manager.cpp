@@ -21,6 +21,8 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <algorithm>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-thread.h>
@@ -41,10 +43,55 @@ namespace
 Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_VECTOR_ANIMATION" );
 #endif
 
+constexpr uint32_t PLAYBACK_SETTING_FLAGS = VectorAnimationTask::RESEND_PLAY_RANGE | VectorAnimationTask::RESEND_LOOP_COUNT |
+                                            VectorAnimationTask::RESEND_STOP_BEHAVIOR | VectorAnimationTask::RESEND_LOOPING_MODE;
+
+bool IsSamePlayRange( const Property::Array& lhs, const Property::Array& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( Property::Array::SizeType index = 0; index < lhs.Count(); ++index )
+  {
+    const Property::Value& left = lhs.GetElementAt( index );
+    const Property::Value& right = rhs.GetElementAt( index );
+    if( left.GetType() != right.GetType() )
+    {
+      return false;
+    }
+
+    int32_t leftFrame, rightFrame;
+    std::string leftMarker, rightMarker;
+    if( left.Get( leftFrame ) && right.Get( rightFrame ) )
+    {
+      if( leftFrame != rightFrame )
+      {
+        return false;
+      }
+    }
+    else if( left.Get( leftMarker ) && right.Get( rightMarker ) )
+    {
+      if( leftMarker != rightMarker )
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 } // unnamed namespace
 
 VectorAnimationManager::VectorAnimationManager()
 : mEventCallbacks(),
+  mSharedTasks(),
+  mUnusedSharedTasks(),
   mVectorAnimationThread( nullptr ),
   mProcessorRegistered( false )
 {
@@ -58,6 +105,18 @@ VectorAnimationManager::~VectorAnimationManager()
   }
   mEventCallbacks.clear();
 
+  for( auto&& info : mSharedTasks )
+  {
+    info->mTask->Finalize();
+  }
+  mSharedTasks.clear();
+
+  for( auto&& info : mUnusedSharedTasks )
+  {
+    info->mTask->Finalize();
+  }
+  mUnusedSharedTasks.clear();
+
   if( mProcessorRegistered )
   {
     Adaptor::Get().UnregisterProcessor( *this );
@@ -92,7 +151,7 @@ void VectorAnimationManager::UnregisterEventCallback( CallbackBase* callback )
   {
     mEventCallbacks.erase( iter );
 
-    if( mEventCallbacks.empty() )
+    if( mEventCallbacks.empty() && mUnusedSharedTasks.empty() )
     {
       if( Adaptor::IsAvailable() )
       {
@@ -103,6 +162,212 @@ void VectorAnimationManager::UnregisterEventCallback( CallbackBase* callback )
   }
 }
 
+VectorAnimationTaskPtr VectorAnimationManager::AcquireSharedTask( VisualFactoryCache& factoryCache, const std::string& url, const VectorAnimationTask::AnimationData& data,
+                                                                  const void* owner, Renderer renderer, CallbackBase* animationFinishedCallback, TextureSet& textureSet )
+{
+  SharedTaskInfo* sharedInfo = nullptr;
+  auto iter = FindCompatibleSharedTask( url, data );
+  if( iter != mSharedTasks.end() )
+  {
+    sharedInfo = iter->get();
+  }
+  else
+  {
+    VectorAnimationTaskPtr task = new VectorAnimationTask( factoryCache, url );
+
+    mSharedTasks.push_back( std::unique_ptr< SharedTaskInfo >( new SharedTaskInfo( *this, task, url, data ) ) );
+    sharedInfo = mSharedTasks.back().get();
+
+    task->UploadCompletedSignal().Connect( sharedInfo, &SharedTaskInfo::OnUploadCompleted );
+    task->SetAnimationFinishedCallback( new EventThreadCallback( MakeCallback( sharedInfo, &SharedTaskInfo::OnAnimationFinished ) ) );
+
+    // The playback settings are fixed while the task is shared
+    VectorAnimationTask::AnimationData settings = sharedInfo->mSettings;
+    settings.resendFlag = VectorAnimationTask::RESEND_SIZE | VectorAnimationTask::RESEND_LOOP_COUNT |
+                          VectorAnimationTask::RESEND_STOP_BEHAVIOR | VectorAnimationTask::RESEND_LOOPING_MODE;
+    if( !settings.playRange.Empty() )
+    {
+      settings.resendFlag |= VectorAnimationTask::RESEND_PLAY_RANGE;
+    }
+    task->SetAnimationData( settings );
+
+    renderer.SetTextures( sharedInfo->mTextureSet );
+    task->SetRenderer( renderer );
+
+    DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationManager::AcquireSharedTask: Create [%s, %d x %d] [%p]\n", url.c_str(), data.width, data.height, task.Get() );
+  }
+
+  sharedInfo->mOwners.push_back( SharedTaskInfo::Owner{ owner, renderer, std::unique_ptr< CallbackBase >( animationFinishedCallback ), false, false } );
+
+  textureSet = sharedInfo->mTextureSet;
+
+  return sharedInfo->mTask;
+}
+
+void VectorAnimationManager::ReleaseSharedTask( VectorAnimationTaskPtr task, const void* owner )
+{
+  auto iter = FindSharedTask( task.Get() );
+  if( iter != mSharedTasks.end() )
+  {
+    SharedTaskInfo* info = iter->get();
+
+    auto ownerIter = info->FindOwner( owner );
+    if( ownerIter != info->mOwners.end() )
+    {
+      bool wasPlaying = info->IsPlaying();
+      bool wasSuspended = info->IsSuspended();
+      bool wasDisplaying = ( ownerIter == info->mOwners.begin() );
+
+      if( info->mNotifying )
+      {
+        // The callback may be running now, so delete it after notifying the owners
+        info->mReleasedCallbacks.push_back( std::move( ownerIter->animationFinishedCallback ) );
+      }
+
+      info->mOwners.erase( ownerIter );
+
+      if( !info->mOwners.empty() )
+      {
+        if( wasDisplaying )
+        {
+          // Don't keep the renderer of the released owner
+          task->SetRenderer( info->mOwners.front().renderer );
+        }
+
+        VectorAnimationTask::AnimationData data;
+        if( wasPlaying && !info->IsPlaying() )
+        {
+          data.playState = DevelImageVisual::PlayState::STOPPED;
+          data.resendFlag |= VectorAnimationTask::RESEND_PLAY_STATE;
+        }
+        if( !wasSuspended && info->IsSuspended() )
+        {
+          data.suspended = true;
+          data.resendFlag |= VectorAnimationTask::RESEND_SUSPENDED;
+        }
+
+        if( data.resendFlag )
+        {
+          task->SetAnimationData( data );
+        }
+      }
+    }
+
+    RemoveSharedTaskIfUnused( info );
+  }
+}
+
+void VectorAnimationManager::SetSharedAnimationData( VectorAnimationTaskPtr task, const void* owner, const VectorAnimationTask::AnimationData& data )
+{
+  auto iter = FindSharedTask( task.Get() );
+  if( iter != mSharedTasks.end() )
+  {
+    SharedTaskInfo* info = iter->get();
+
+    VectorAnimationTask::AnimationData sharedData = data;
+    sharedData.resendFlag &= ~( VectorAnimationTask::RESEND_SIZE | PLAYBACK_SETTING_FLAGS );  // The size and the playback settings of the shared task are fixed
+
+    if( data.resendFlag & VectorAnimationTask::RESEND_PLAY_STATE )
+    {
+      auto ownerIter = info->FindOwner( owner );
+      if( ownerIter != info->mOwners.end() )
+      {
+        ownerIter->playing = ( data.playState == DevelImageVisual::PlayState::PLAYING );
+      }
+
+      if( data.playState != DevelImageVisual::PlayState::PLAYING && info->IsPlaying() )
+      {
+        // Keep playing for the other owners
+        sharedData.resendFlag &= ~VectorAnimationTask::RESEND_PLAY_STATE;
+      }
+    }
+
+    if( data.resendFlag & VectorAnimationTask::RESEND_SUSPENDED )
+    {
+      auto ownerIter = info->FindOwner( owner );
+      if( ownerIter != info->mOwners.end() )
+      {
+        ownerIter->suspended = data.suspended;
+      }
+
+      if( data.suspended && !info->IsSuspended() )
+      {
+        // Keep rasterizing for the other owners
+        sharedData.resendFlag &= ~VectorAnimationTask::RESEND_SUSPENDED;
+      }
+    }
+
+    if( sharedData.resendFlag )
+    {
+      task->SetAnimationData( sharedData );
+    }
+  }
+}
+
+bool VectorAnimationManager::IsSharedTaskUploaded( VectorAnimationTaskPtr task ) const
+{
+  auto iter = std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                            [&task]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->mTask == task; } );
+  return iter != mSharedTasks.end() && ( *iter )->mUploaded;
+}
+
+Renderer VectorAnimationManager::GetSharedTaskRenderer( VectorAnimationTaskPtr task ) const
+{
+  auto iter = std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                            [&task]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->mTask == task; } );
+  return iter != mSharedTasks.end() && !( *iter )->mOwners.empty() ? ( *iter )->mOwners.front().renderer : Renderer();
+}
+
+bool VectorAnimationManager::IsSharedTaskCompatible( VectorAnimationTaskPtr task, const std::string& url, const VectorAnimationTask::AnimationData& data ) const
+{
+  auto iter = std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                            [&task]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->mTask == task; } );
+  return iter != mSharedTasks.end() && ( *iter )->IsCompatible( url, data );
+}
+
+VectorAnimationTaskPtr VectorAnimationManager::GetSharedTask( const std::string& url, const VectorAnimationTask::AnimationData& data ) const
+{
+  auto iter = std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                            [&url, &data]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->IsCompatible( url, data ); } );
+  return iter != mSharedTasks.end() ? ( *iter )->mTask : VectorAnimationTaskPtr();
+}
+
+std::vector< std::unique_ptr< VectorAnimationManager::SharedTaskInfo > >::iterator VectorAnimationManager::FindSharedTask( const VectorAnimationTask* task )
+{
+  return std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                       [task]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->mTask.Get() == task; } );
+}
+
+std::vector< std::unique_ptr< VectorAnimationManager::SharedTaskInfo > >::iterator VectorAnimationManager::FindCompatibleSharedTask( const std::string& url, const VectorAnimationTask::AnimationData& data )
+{
+  return std::find_if( mSharedTasks.begin(), mSharedTasks.end(),
+                       [&url, &data]( const std::unique_ptr< SharedTaskInfo >& info ) { return info->IsCompatible( url, data ); } );
+}
+
+void VectorAnimationManager::RemoveSharedTaskIfUnused( SharedTaskInfo* info )
+{
+  if( info->mOwners.empty() )
+  {
+    auto iter = FindSharedTask( info->mTask.Get() );
+    if( iter != mSharedTasks.end() )
+    {
+      DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationManager::RemoveSharedTaskIfUnused: Remove [%s, %d x %d] [%p]\n", info->mUrl.c_str(), info->mSettings.width, info->mSettings.height, info->mTask.Get() );
+
+      info->mTask->UploadCompletedSignal().Disconnect( info, &SharedTaskInfo::OnUploadCompleted );
+
+      // The animation finished callback of the task may be running now, so finalize the task and delete the information later
+      mUnusedSharedTasks.push_back( std::move( *iter ) );
+      mSharedTasks.erase( iter );
+
+      if( !mProcessorRegistered )
+      {
+        Adaptor::Get().RegisterProcessor( *this );
+        mProcessorRegistered = true;
+      }
+    }
+  }
+}
+
 void VectorAnimationManager::Process()
 {
   for( auto&& iter : mEventCallbacks )
@@ -112,10 +377,91 @@ void VectorAnimationManager::Process()
   }
   mEventCallbacks.clear();
 
+  for( auto&& info : mUnusedSharedTasks )
+  {
+    info->mTask->Finalize();
+  }
+  mUnusedSharedTasks.clear();
+
   Adaptor::Get().UnregisterProcessor( *this );
   mProcessorRegistered = false;
 }
 
+VectorAnimationManager::SharedTaskInfo::SharedTaskInfo( VectorAnimationManager& manager, VectorAnimationTaskPtr task, const std::string& url, const VectorAnimationTask::AnimationData& data )
+: mManager( manager ),
+  mTask( task ),
+  mUrl( url ),
+  mTextureSet( TextureSet::New() ),
+  mOwners(),
+  mReleasedCallbacks(),
+  mSettings(),
+  mUploaded( false ),
+  mNotifying( false )
+{
+  mSettings.playRange = data.playRange;
+  mSettings.stopBehavior = data.stopBehavior;
+  mSettings.loopingMode = data.loopingMode;
+  mSettings.width = data.width;
+  mSettings.height = data.height;
+  mSettings.loopCount = data.loopCount;
+}
+
+void VectorAnimationManager::SharedTaskInfo::OnUploadCompleted()
+{
+  mUploaded = true;
+}
+
+void VectorAnimationManager::SharedTaskInfo::OnAnimationFinished()
+{
+  for( auto&& owner : mOwners )
+  {
+    owner.playing = false;
+  }
+
+  // An owner may be released while it is notified, so notify the owners which remain.
+  std::vector< const void* > owners;
+  owners.reserve( mOwners.size() );
+  for( auto&& owner : mOwners )
+  {
+    owners.push_back( owner.owner );
+  }
+
+  mNotifying = true;
+  for( auto&& owner : owners )
+  {
+    auto iter = FindOwner( owner );
+    if( iter != mOwners.end() )
+    {
+      CallbackBase::Execute( *iter->animationFinishedCallback );
+    }
+  }
+  mNotifying = false;
+
+  mReleasedCallbacks.clear();
+}
+
+bool VectorAnimationManager::SharedTaskInfo::IsCompatible( const std::string& url, const VectorAnimationTask::AnimationData& data ) const
+{
+  return mSettings.width == data.width && mSettings.height == data.height && mUrl == url &&
+         mSettings.loopCount == data.loopCount && mSettings.stopBehavior == data.stopBehavior && mSettings.loopingMode == data.loopingMode &&
+         IsSamePlayRange( mSettings.playRange, data.playRange );
+}
+
+std::vector< VectorAnimationManager::SharedTaskInfo::Owner >::iterator VectorAnimationManager::SharedTaskInfo::FindOwner( const void* owner )
+{
+  return std::find_if( mOwners.begin(), mOwners.end(), [owner]( const Owner& item ) { return item.owner == owner; } );
+}
+
+bool VectorAnimationManager::SharedTaskInfo::IsPlaying() const
+{
+  return std::any_of( mOwners.begin(), mOwners.end(), []( const Owner& item ) { return item.playing; } );
+}
+
+bool VectorAnimationManager::SharedTaskInfo::IsSuspended() const
+{
+  return !mOwners.empty() && std::all_of( mOwners.begin(), mOwners.end(), []( const Owner& item ) { return item.suspended; } );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -20,11 +20,16 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/signals/callback.h>
+#include <dali/public-api/signals/connection-tracker.h>
 #include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/texture-set.h>
 #include <dali/integration-api/processor-interface.h>
 #include <memory>
+#include <string>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
 
 namespace Dali
 {
@@ -36,6 +41,7 @@ namespace Internal
 {
 
 class VectorAnimationThread;
+class VisualFactoryCache;
 
 /**
  * @brief Vector animation manager
@@ -75,6 +81,84 @@ public:
    */
   void UnregisterEventCallback( CallbackBase* callback );
 
+  /**
+   * @brief Acquires the task shared by all the visuals rasterizing the url at the given size with the same playback settings.
+   *
+   * The task is created if there is no compatible shared task yet.
+   * The playback settings are the play range, the loop count, the stop behavior and the looping mode.
+   * The rasterized frames are uploaded to the texture set of the shared task, so the renderer of every sharing visual should use it.
+   *
+   * @param[in] factoryCache The VisualFactoryCache object
+   * @param[in] url The url of the vector animation file
+   * @param[in] data The animation data of the visual, which has the size of the rasterized image and the playback settings
+   * @param[in] owner The visual which acquires the task
+   * @param[in] renderer The renderer of the visual. It is used to display the result while the visual is the first owner.
+   * @param[in] animationFinishedCallback The callback called when the shared animation is finished
+   * @param[out] textureSet The texture set the rasterized frames are uploaded to
+   * @return The shared task
+   * @note Ownership of the callback is passed onto this class.
+   */
+  VectorAnimationTaskPtr AcquireSharedTask( VisualFactoryCache& factoryCache, const std::string& url, const VectorAnimationTask::AnimationData& data,
+                                            const void* owner, Renderer renderer, CallbackBase* animationFinishedCallback, TextureSet& textureSet );
+
+  /**
+   * @brief Releases the shared task acquired by the owner.
+   *
+   * The task is finalized in the next event processing after it is released by all the owners.
+   * If the renderer of the owner displays the result, the renderer of the next owner displays it instead.
+   *
+   * @param[in] task The shared task
+   * @param[in] owner The visual which acquired the task
+   */
+  void ReleaseSharedTask( VectorAnimationTaskPtr task, const void* owner );
+
+  /**
+   * @brief Sends the animation data of an owner to the shared task.
+   *
+   * The size and the playback settings of a shared task can't be changed and the animation is not stopped or paused while any other owner is playing.
+   * The rasterization is suspended only when all the owners are suspended.
+   *
+   * @param[in] task The shared task
+   * @param[in] owner The visual which acquired the task
+   * @param[in] data The animation data
+   */
+  void SetSharedAnimationData( VectorAnimationTaskPtr task, const void* owner, const VectorAnimationTask::AnimationData& data );
+
+  /**
+   * @brief Checks whether the first frame of the shared task is uploaded.
+   *
+   * @param[in] task The shared task
+   * @return true if the first frame is uploaded
+   */
+  bool IsSharedTaskUploaded( VectorAnimationTaskPtr task ) const;
+
+  /**
+   * @brief Gets the renderer the shared task displays the result with.
+   *
+   * @param[in] task The shared task
+   * @return The renderer
+   */
+  Renderer GetSharedTaskRenderer( VectorAnimationTaskPtr task ) const;
+
+  /**
+   * @brief Checks whether the shared task still rasterizes the url at the size with the playback settings of the animation data.
+   *
+   * @param[in] task The shared task
+   * @param[in] url The url of the vector animation file
+   * @param[in] data The animation data
+   * @return true if the task is compatible
+   */
+  bool IsSharedTaskCompatible( VectorAnimationTaskPtr task, const std::string& url, const VectorAnimationTask::AnimationData& data ) const;
+
+  /**
+   * @brief Gets the shared task which rasterizes the url at the size with the playback settings of the animation data.
+   *
+   * @param[in] url The url of the vector animation file
+   * @param[in] data The animation data
+   * @return The shared task or an empty handle if there is no compatible shared task
+   */
+  VectorAnimationTaskPtr GetSharedTask( const std::string& url, const VectorAnimationTask::AnimationData& data ) const;
+
 protected: // Implementation of Processor
 
   /**
@@ -90,9 +174,101 @@ private:
   // Undefined
   VectorAnimationManager& operator=( const VectorAnimationManager& manager ) = delete;
 
+private:
+
+  /**
+   * @brief Information of a task shared by several visuals.
+   */
+  class SharedTaskInfo : public ConnectionTracker
+  {
+  public:
+
+    /**
+     * @brief A visual which acquired the shared task.
+     */
+    struct Owner
+    {
+      const void*                     owner;
+      Renderer                        renderer;  ///< The renderer of the owner. It is released with the owner
+      std::unique_ptr< CallbackBase > animationFinishedCallback;
+      bool                            playing;
+      bool                            suspended;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    SharedTaskInfo( VectorAnimationManager& manager, VectorAnimationTaskPtr task, const std::string& url, const VectorAnimationTask::AnimationData& data );
+
+    /**
+     * @brief Called when the texture upload is completed.
+     */
+    void OnUploadCompleted();
+
+    /**
+     * @brief Called when the shared animation is finished.
+     */
+    void OnAnimationFinished();
+
+    /**
+     * @brief Finds the owner.
+     * @return The iterator of the owner or the end of the owners if not found.
+     */
+    std::vector< Owner >::iterator FindOwner( const void* owner );
+
+    /**
+     * @brief Checks whether the task rasterizes the url at the size with the playback settings of the animation data.
+     */
+    bool IsCompatible( const std::string& url, const VectorAnimationTask::AnimationData& data ) const;
+
+    /**
+     * @brief Checks whether any owner is playing.
+     */
+    bool IsPlaying() const;
+
+    /**
+     * @brief Checks whether all the owners are suspended.
+     */
+    bool IsSuspended() const;
+
+  public:
+
+    VectorAnimationManager& mManager;
+    VectorAnimationTaskPtr  mTask;
+    std::string             mUrl;
+    TextureSet              mTextureSet;
+    std::vector< Owner >    mOwners;      ///< The renderer of the first owner displays the result
+    std::vector< std::unique_ptr< CallbackBase > > mReleasedCallbacks;  ///< The callbacks of the owners released while they are notified
+    VectorAnimationTask::AnimationData mSettings;  ///< The size and the playback settings
+    bool                    mUploaded;
+    bool                    mNotifying;
+  };
+
+  /**
+   * @brief Finds the information of the shared task.
+   * @return The iterator of the information or the end of the shared tasks if not found.
+   */
+  std::vector< std::unique_ptr< SharedTaskInfo > >::iterator FindSharedTask( const VectorAnimationTask* task );
+
+  /**
+   * @brief Finds the information of the shared task compatible with the animation data.
+   * @return The iterator of the information or the end of the shared tasks if not found.
+   */
+  std::vector< std::unique_ptr< SharedTaskInfo > >::iterator FindCompatibleSharedTask( const std::string& url, const VectorAnimationTask::AnimationData& data );
+
+  /**
+   * @brief Removes the shared task if no owner remains.
+   *
+   * The task is finalized and the information is deleted in the next event processing,
+   * since the animation finished callback of the task may be running now.
+   */
+  void RemoveSharedTaskIfUnused( SharedTaskInfo* info );
+
 private:
 
   std::vector< CallbackBase* >             mEventCallbacks;
+  std::vector< std::unique_ptr< SharedTaskInfo > > mSharedTasks;
+  std::vector< std::unique_ptr< SharedTaskInfo > > mUnusedSharedTasks;  ///< The tasks to finalize in the next event processing
   std::unique_ptr< VectorAnimationThread > mVectorAnimationThread;
   bool                                     mProcessorRegistered;
 };
@@ -22,6 +22,8 @@
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/math/math-utils.h>
+#include <algorithm>
+#include <limits>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
@@ -60,6 +62,8 @@ VectorAnimationTask::VectorAnimationTask( VisualFactoryCache& factoryCache, cons
   mStopBehavior( DevelImageVisual::StopBehavior::CURRENT_FRAME ),
   mLoopingMode( DevelImageVisual::LoopingMode::RESTART ),
   mNextFrameStartTime(),
+  mSuspendedTime(),
+  mSuspendedPlayingNanoSeconds( 0 ),
   mFrameDurationNanoSeconds( 0 ),
   mFrameRate( 60.0f ),
   mCurrentFrame( 0 ),
@@ -71,11 +75,13 @@ VectorAnimationTask::VectorAnimationTask( VisualFactoryCache& factoryCache, cons
   mAnimationDataIndex( 0 ),
   mLoopCount( LOOP_FOREVER ),
   mCurrentLoop( 0 ),
+  mSkippedFrameCount( 0u ),
   mForward( true ),
   mUpdateFrameNumber( false ),
   mNeedAnimationFinishedTrigger( true ),
   mAnimationDataUpdated( false ),
-  mDestroyTask( false )
+  mDestroyTask( false ),
+  mSuspended( false )
 {
   Initialize();
 }
@@ -146,6 +152,8 @@ void VectorAnimationTask::PlayAnimation()
 {
   if( mPlayState != PlayState::PLAYING )
   {
+    AccumulateSuspendedPlayingTime();
+
     mNeedAnimationFinishedTrigger = true;
     mUpdateFrameNumber = false;
     mPlayState = PlayState::PLAYING;
@@ -158,6 +166,8 @@ void VectorAnimationTask::StopAnimation()
 {
   if( mPlayState != PlayState::STOPPING )
   {
+    AccumulateSuspendedPlayingTime();
+
     mNeedAnimationFinishedTrigger = false;
     mPlayState = PlayState::STOPPING;
 
@@ -169,6 +179,8 @@ void VectorAnimationTask::PauseAnimation()
 {
   if( mPlayState == PlayState::PLAYING )
   {
+    AccumulateSuspendedPlayingTime();
+
     mPlayState = PlayState::PAUSED;
 
     DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::PauseAnimation: Pause [%p]\n", this );
@@ -300,6 +312,10 @@ void VectorAnimationTask::SetCurrentFrameNumber( uint32_t frameNumber )
     mCurrentFrame = frameNumber;
     mUpdateFrameNumber = false;
 
+    // The animation continues from the new frame, so the time it played while suspended before is not skipped
+    mSuspendedPlayingNanoSeconds = 0;
+    mSuspendedTime = std::chrono::system_clock::now();
+
     DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::SetCurrentFrameNumber: frame number = %d [%p]\n", mCurrentFrame, this );
   }
   else
@@ -313,6 +329,11 @@ uint32_t VectorAnimationTask::GetCurrentFrameNumber() const
   return mCurrentFrame;
 }
 
+uint32_t VectorAnimationTask::GetSkippedFrameCount() const
+{
+  return mSkippedFrameCount;
+}
+
 uint32_t VectorAnimationTask::GetTotalFrameNumber() const
 {
   return mTotalFrame;
@@ -323,6 +344,12 @@ void VectorAnimationTask::GetDefaultSize( uint32_t& width, uint32_t& height ) co
   mVectorRenderer.GetDefaultSize( width, height );
 }
 
+void VectorAnimationTask::GetSize( uint32_t& width, uint32_t& height ) const
+{
+  width = mWidth;
+  height = mHeight;
+}
+
 void VectorAnimationTask::SetStopBehavior( DevelImageVisual::StopBehavior::Type stopBehavior )
 {
   mStopBehavior = stopBehavior;
@@ -337,6 +364,124 @@ void VectorAnimationTask::SetLoopingMode( DevelImageVisual::LoopingMode::Type lo
   DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::SetLoopingMode: looping mode = %d [%p]\n", mLoopingMode, this );
 }
 
+void VectorAnimationTask::SetSuspended( bool suspended )
+{
+  if( mSuspended == suspended )
+  {
+    return;
+  }
+
+  if( suspended )
+  {
+    mSuspended = true;
+    mSuspendedPlayingNanoSeconds = 0;
+    mSuspendedTime = std::chrono::system_clock::now();
+  }
+  else
+  {
+    // Only the time the animation was playing is skipped, not the time it was paused or stopped
+    AccumulateSuspendedPlayingTime();
+    mSuspended = false;
+
+    if( mFrameDurationNanoSeconds > 0 )
+    {
+      SkipFrames( static_cast< uint64_t >( mSuspendedPlayingNanoSeconds / mFrameDurationNanoSeconds ) );
+    }
+    mSuspendedPlayingNanoSeconds = 0;
+  }
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::SetSuspended: suspended = %d, current frame = %d [%p]\n", suspended, mCurrentFrame, this );
+}
+
+void VectorAnimationTask::SkipFrames( uint64_t frameCount )
+{
+  if( frameCount == 0 || mEndFrame <= mStartFrame )
+  {
+    return;
+  }
+
+  const uint64_t frameLength = mEndFrame - mStartFrame;  // The number of frames to move from the start frame to the end frame
+  bool finished = false;
+
+  if( mLoopingMode == DevelImageVisual::LoopingMode::AUTO_REVERSE )
+  {
+    // A loop goes forwards and then backwards again.
+    const uint64_t loopLength = frameLength * 2;
+    uint64_t position = mForward ? mCurrentFrame - mStartFrame : loopLength - ( mCurrentFrame - mStartFrame );
+    position += frameCount;
+
+    uint64_t loops = position / loopLength;
+    if( mLoopCount >= 0 && static_cast< uint64_t >( mCurrentLoop ) + loops >= static_cast< uint64_t >( mLoopCount ) )
+    {
+      finished = true;
+    }
+    else
+    {
+      mCurrentLoop += static_cast< int32_t >( loops );
+      position %= loopLength;
+      mForward = position < frameLength;
+      mCurrentFrame = mForward ? mStartFrame + static_cast< uint32_t >( position ) : mStartFrame + static_cast< uint32_t >( loopLength - position );
+    }
+  }
+  else
+  {
+    const uint64_t loopLength = frameLength + 1;
+    uint64_t position = mCurrentFrame - mStartFrame + frameCount;
+
+    uint64_t loops = position / loopLength;
+    if( mLoopCount >= 0 && static_cast< uint64_t >( mCurrentLoop ) + loops >= static_cast< uint64_t >( mLoopCount ) )
+    {
+      finished = true;
+    }
+    else
+    {
+      mCurrentLoop += static_cast< int32_t >( loops );
+      mCurrentFrame = mStartFrame + static_cast< uint32_t >( position % loopLength );
+    }
+  }
+
+  if( finished )
+  {
+    // Let the next rasterization finish the animation at the last frame of the last loop
+    mCurrentLoop = mLoopCount > 0 ? mLoopCount - 1 : 0;
+    if( mLoopingMode == DevelImageVisual::LoopingMode::AUTO_REVERSE )
+    {
+      mCurrentFrame = mStartFrame;
+      mForward = false;
+    }
+    else
+    {
+      mCurrentFrame = mEndFrame;
+    }
+  }
+
+  // The current frame is the next frame to display
+  mUpdateFrameNumber = false;
+
+  // Saturate rather than wrap around after a very long suspension
+  const uint64_t skippedFrameCount = static_cast< uint64_t >( mSkippedFrameCount ) + frameCount;
+  mSkippedFrameCount = static_cast< uint32_t >( std::min< uint64_t >( skippedFrameCount, std::numeric_limits< uint32_t >::max() ) );
+}
+
+void VectorAnimationTask::AccumulateSuspendedPlayingTime()
+{
+  if( !mSuspended )
+  {
+    return;
+  }
+
+  const auto current = std::chrono::system_clock::now();
+  if( mPlayState == PlayState::PLAYING )
+  {
+    const auto elapsed = std::chrono::duration_cast< std::chrono::nanoseconds >( current - mSuspendedTime ).count();
+    if( elapsed > 0 )
+    {
+      mSuspendedPlayingNanoSeconds += elapsed;
+    }
+  }
+  mSuspendedTime = current;
+}
+
 void VectorAnimationTask::GetLayerInfo( Property::Map& map ) const
 {
   mVectorRenderer.GetLayerInfo( map );
@@ -382,6 +527,12 @@ bool VectorAnimationTask::Rasterize()
 
   ApplyAnimationData();
 
+  if( mSuspended && mPlayState != PlayState::STOPPING )
+  {
+    // The animation is not visible. It will be rasterized again when it is resumed.
+    return false;
+  }
+
   if( mPlayState == PlayState::PLAYING && mUpdateFrameNumber )
   {
     mCurrentFrame = mForward ? mCurrentFrame + 1 : mCurrentFrame - 1;
@@ -557,6 +708,11 @@ void VectorAnimationTask::ApplyAnimationData()
     index = mAnimationDataIndex;
   }
 
+  if( mAnimationData[index].resendFlag & VectorAnimationTask::RESEND_SUSPENDED )
+  {
+    SetSuspended( mAnimationData[index].suspended );
+  }
+
   if( mAnimationData[index].resendFlag & VectorAnimationTask::RESEND_LOOP_COUNT )
   {
     SetLoopCount( mAnimationData[index].loopCount );
@@ -24,6 +24,7 @@
 #include <dali/devel-api/threading/conditional-wait.h>
 #include <memory>
 #include <chrono>
+#include <atomic>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
@@ -62,7 +63,8 @@ public:
     RESEND_LOOPING_MODE  = 1 << 3,
     RESEND_CURRENT_FRAME = 1 << 4,
     RESEND_SIZE          = 1 << 5,
-    RESEND_PLAY_STATE    = 1 << 6
+    RESEND_PLAY_STATE    = 1 << 6,
+    RESEND_SUSPENDED     = 1 << 7
   };
 
   /**
@@ -79,7 +81,8 @@ public:
       currentFrame( 0 ),
       width( 0 ),
       height( 0 ),
-      loopCount( -1 )
+      loopCount( -1 ),
+      suspended( false )
     {
     }
 
@@ -94,6 +97,7 @@ public:
       width = rhs.width;
       height = rhs.height;
       loopCount = rhs.loopCount;
+      suspended = rhs.suspended;
       return *this;
     }
 
@@ -106,6 +110,7 @@ public:
     uint32_t                             width;
     uint32_t                             height;
     int32_t                              loopCount;
+    bool                                 suspended;
   };
 
   /**
@@ -164,12 +169,25 @@ public:
    */
   uint32_t GetTotalFrameNumber() const;
 
+  /**
+   * @brief Retrieves the number of frames skipped while the animation was suspended.
+   * @return The number of skipped frames
+   */
+  uint32_t GetSkippedFrameCount() const;
+
   /**
    * @brief Gets the default size of the file,.
    * @return The default size of the file
    */
   void GetDefaultSize( uint32_t& width, uint32_t& height ) const;
 
+  /**
+   * @brief Gets the size of the rasterized image.
+   * @param[out] width The width of the rasterized image
+   * @param[out] height The height of the rasterized image
+   */
+  void GetSize( uint32_t& width, uint32_t& height ) const;
+
   /**
    * @brief Gets the layer information of all the child layers.
    * @param[out] map The layer information
@@ -262,6 +280,29 @@ private:
    */
   void SetLoopingMode( DevelImageVisual::LoopingMode::Type loopingMode );
 
+  /**
+   * @brief Suspends or resumes the rasterization.
+   *
+   * The animation isn't rasterized while it is suspended.
+   * When it is resumed, it skips the frames which would have been displayed while it was playing in the meantime.
+   *
+   * @param[in] suspended Whether the rasterization is suspended
+   */
+  void SetSuspended( bool suspended );
+
+  /**
+   * @brief Adds the time the animation has been playing since the suspended time, and restarts it.
+   *
+   * Called before the play state changes while the animation is suspended.
+   */
+  void AccumulateSuspendedPlayingTime();
+
+  /**
+   * @brief Moves the current frame forward as if the given number of frames were rasterized.
+   * @param[in] frameCount The number of frames to skip
+   */
+  void SkipFrames( uint64_t frameCount );
+
   /**
    * @brief Gets the frame number when the animation is stopped according to the stop behavior.
    */
@@ -298,6 +339,8 @@ private:
   DevelImageVisual::StopBehavior::Type   mStopBehavior;
   DevelImageVisual::LoopingMode::Type    mLoopingMode;
   std::chrono::time_point< std::chrono::system_clock > mNextFrameStartTime;
+  std::chrono::time_point< std::chrono::system_clock > mSuspendedTime;  ///< Since when the playing time while suspended is not accumulated yet
+  int64_t                                mSuspendedPlayingNanoSeconds;  ///< The time the animation has been playing while suspended
   int64_t                                mFrameDurationNanoSeconds;
   float                                  mFrameRate;
   uint32_t                               mCurrentFrame;
@@ -309,11 +352,13 @@ private:
   uint32_t                               mAnimationDataIndex;
   int32_t                                mLoopCount;
   int32_t                                mCurrentLoop;
+  std::atomic< uint32_t >                mSkippedFrameCount;   ///< Saturated at the maximum value
   bool                                   mForward;
   bool                                   mUpdateFrameNumber;
   bool                                   mNeedAnimationFinishedTrigger;
   bool                                   mAnimationDataUpdated;
   bool                                   mDestroyTask;
+  bool                                   mSuspended;
 };
 
 } // namespace Internal
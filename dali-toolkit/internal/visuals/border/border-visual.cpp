@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/math/math-utils.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/visuals/border-visual-properties.h>
@@ -135,6 +136,10 @@ BorderVisual::BorderVisual( VisualFactoryCache& factoryCache )
 
 BorderVisual::~BorderVisual()
 {
+  if( IsOnScene() )
+  {
+    mFactoryCache.GetVisualBatchManager().RemoveVisual( *this );
+  }
 }
 
 void BorderVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -162,6 +167,8 @@ void BorderVisual::DoSetProperties( const Property::Map& propertyMap )
       }
     }
   }
+
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
 }
 
 void BorderVisual::DoSetProperty( Dali::Property::Index index,
@@ -207,12 +214,23 @@ void BorderVisual::DoSetOnScene( Actor& actor )
   }
   mBorderSizeIndex = mImpl->mRenderer.RegisterProperty( Toolkit::BorderVisual::Property::SIZE, SIZE_NAME, mBorderSize );
 
-  actor.AddRenderer( mImpl->mRenderer );
+  // Under a batch parent, the renderers of the batch parent draw the border, unless it is anti-aliased
+  if( mAntiAliasing || !mFactoryCache.GetVisualBatchManager().AddVisual( *this, actor ) )
+  {
+    actor.AddRenderer( mImpl->mRenderer );
+  }
 
   // Border Visual Generated and ready to display
   ResourceReady( Toolkit::Visual::ResourceStatus::READY );
 }
 
+void BorderVisual::DoSetOffScene( Actor& actor )
+{
+  mFactoryCache.GetVisualBatchManager().RemoveVisual( *this );
+
+  Visual::Base::DoSetOffScene( actor );
+}
+
 void BorderVisual::DoCreatePropertyMap( Property::Map& map ) const
 {
   map.Clear();
@@ -233,6 +251,49 @@ void BorderVisual::OnSetTransform()
   {
     mImpl->mTransform.RegisterUniforms( mImpl->mRenderer, Direction::LEFT_TO_RIGHT );
   }
+
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+}
+
+void BorderVisual::OnSetDepthIndex()
+{
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+}
+
+void BorderVisual::OnAnimateProperty( bool animate )
+{
+  // The renderers of the batch parent are not animated, so an animated visual draws itself with its own renderer
+  if( animate )
+  {
+    mFactoryCache.GetVisualBatchManager().ExcludeVisual( *this );
+  }
+  else
+  {
+    mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+  }
+}
+
+bool BorderVisual::GetBatchQuad( const Vector2& actorSize, VisualBatchQuad& quad ) const
+{
+  // The border is drawn inside the visual with the mix color applied
+  quad.color = Vector4( mBorderColor.r * mImpl->mMixColor.r, mBorderColor.g * mImpl->mMixColor.g, mBorderColor.b * mImpl->mMixColor.b, mBorderColor.a * mImpl->mMixColor.a );
+  if( mBorderSize <= 0.0f || EqualsZero( quad.color.a ) )
+  {
+    return false;
+  }
+
+  quad.size = mImpl->mTransform.GetVisualSize( actorSize );
+  quad.centre = mImpl->mTransform.GetVisualCentre( actorSize );
+  quad.cornerRadius = 0.0f;
+  quad.blurRadius = 0.0f;
+  quad.borderSize = mBorderSize;
+  quad.depthIndex = mImpl->mDepthIndex;
+  return true;
+}
+
+void BorderVisual::OnBatchParentRemoved( Actor& actor )
+{
+  actor.AddRenderer( mImpl->mRenderer );
 }
 
 void BorderVisual::InitializeRenderer()
@@ -24,6 +24,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-batch-manager.h>
 
 namespace Dali
 {
@@ -47,8 +48,10 @@ typedef IntrusivePtr< BorderVisual > BorderVisualPtr;
  * | borderColor     | VECTOR4     |
  * | borderSize      | FLOAT       |
  * | antiAliasing    | BOOLEAN     |
+ *
+ * Under a batch parent, a border without anti-aliasing is drawn by the renderers of the batch parent instead of its own renderer.
  */
-class BorderVisual : public Visual::Base
+class BorderVisual : public Visual::Base, public VisualBatchMember
 {
 public:
 
@@ -61,6 +64,18 @@ public:
    */
   static BorderVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+public: // from VisualBatchMember
+
+  /**
+   * @copydoc VisualBatchMember::GetBatchQuad
+   */
+  bool GetBatchQuad( const Vector2& actorSize, VisualBatchQuad& quad ) const override;
+
+  /**
+   * @copydoc VisualBatchMember::OnBatchParentRemoved
+   */
+  void OnBatchParentRemoved( Actor& actor ) override;
+
 protected:
 
   /**
@@ -85,6 +100,11 @@ protected:
    */
   void DoSetOnScene( Actor& actor ) override;
 
+  /**
+   * @copydoc Visual::Base::DoSetOffScene
+   */
+  void DoSetOffScene( Actor& actor ) override;
+
   /**
    * @copydoc Visual::Base::CreatePropertyMap
    */
@@ -100,6 +120,16 @@ protected:
    */
   void OnSetTransform() override;
 
+  /**
+   * @copydoc Visual::Base::OnSetDepthIndex
+   */
+  void OnSetDepthIndex() override;
+
+  /**
+   * @copydoc Visual::Base::OnAnimateProperty
+   */
+  void OnAnimateProperty( bool animate ) override;
+
 private:
 
   /**
@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/math/math-utils.h>
+#include <algorithm>
 
 //INTERNAL INCLUDES
 #include <dali-toolkit/public-api/visuals/color-visual-properties.h>
@@ -196,6 +198,10 @@ ColorVisual::ColorVisual( VisualFactoryCache& factoryCache )
 
 ColorVisual::~ColorVisual()
 {
+  if( IsOnScene() )
+  {
+    mFactoryCache.GetVisualBatchManager().RemoveVisual( *this );
+  }
 }
 
 void ColorVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -242,23 +248,32 @@ void ColorVisual::DoSetProperties( const Property::Map& propertyMap )
       DALI_LOG_ERROR( "ColorVisual:DoSetProperties:: BLUR_RADIUS property has incorrect type: %d\n", blurRadiusValue->GetType() );
     }
   }
+
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
 }
 
 void ColorVisual::DoSetOnScene( Actor& actor )
 {
   InitializeRenderer();
 
-  // Only add the renderer if it's not fully transparent
+  // Under a batch parent, the renderers of the batch parent draw the visual
   // We cannot avoid creating a renderer as it's used in the base class
-  if( mRenderIfTransparent || mImpl->mMixColor.a > 0.0f )
+  if( !mFactoryCache.GetVisualBatchManager().AddVisual( *this, actor ) )
   {
-    actor.AddRenderer( mImpl->mRenderer );
+    OnBatchParentRemoved( actor );
   }
 
   // Color Visual generated and ready to display
   ResourceReady( Toolkit::Visual::ResourceStatus::READY );
 }
 
+void ColorVisual::DoSetOffScene( Actor& actor )
+{
+  mFactoryCache.GetVisualBatchManager().RemoveVisual( *this );
+
+  Visual::Base::DoSetOffScene( actor );
+}
+
 void ColorVisual::DoCreatePropertyMap( Property::Map& map ) const
 {
   map.Clear();
@@ -280,6 +295,26 @@ void ColorVisual::OnSetTransform()
   {
     mImpl->mTransform.RegisterUniforms( mImpl->mRenderer, Direction::LEFT_TO_RIGHT );
   }
+
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+}
+
+void ColorVisual::OnSetDepthIndex()
+{
+  mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+}
+
+void ColorVisual::OnAnimateProperty( bool animate )
+{
+  // The renderers of the batch parent are not animated, so an animated visual draws itself with its own renderer
+  if( animate )
+  {
+    mFactoryCache.GetVisualBatchManager().ExcludeVisual( *this );
+  }
+  else
+  {
+    mFactoryCache.GetVisualBatchManager().MarkDirty( *this );
+  }
 }
 
 void ColorVisual::OnDoAction( const Property::Index actionId, const Property::Value& attributes )
@@ -299,6 +334,40 @@ void ColorVisual::OnDoAction( const Property::Index actionId, const Property::Va
   }
 }
 
+bool ColorVisual::GetBatchQuad( const Vector2& actorSize, VisualBatchQuad& quad ) const
+{
+  if( EqualsZero( mImpl->mMixColor.a ) )
+  {
+    return false;
+  }
+
+  quad.size = mImpl->mTransform.GetVisualSize( actorSize );
+  quad.centre = mImpl->mTransform.GetVisualCentre( actorSize );
+  quad.color = mImpl->mMixColor;
+  quad.blurRadius = mBlurRadius;
+  quad.cornerRadius = 0.0f;
+  quad.borderSize = 0.0f;
+  quad.depthIndex = mImpl->mDepthIndex;
+
+  // The blurred edges take precedence over the rounded corners, as in InitializeRenderer()
+  if( EqualsZero( mBlurRadius ) && IsRoundedCornerRequired() )
+  {
+    const float minSize = std::min( quad.size.width, quad.size.height );
+    quad.cornerRadius = std::min( Lerp( mImpl->mCornerRadiusPolicy, mImpl->mCornerRadius * minSize, mImpl->mCornerRadius ), minSize * 0.5f );
+  }
+
+  return true;
+}
+
+void ColorVisual::OnBatchParentRemoved( Actor& actor )
+{
+  // Only add the renderer if it's not fully transparent
+  if( mRenderIfTransparent || mImpl->mMixColor.a > 0.0f )
+  {
+    actor.AddRenderer( mImpl->mRenderer );
+  }
+}
+
 void ColorVisual::InitializeRenderer()
 {
   Geometry geometry = mFactoryCache.GetGeometry( VisualFactoryCache::QUAD_GEOMETRY );
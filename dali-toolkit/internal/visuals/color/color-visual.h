@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-batch-manager.h>
 
 namespace Dali
 {
@@ -44,8 +45,10 @@ typedef IntrusivePtr< ColorVisual > ColorVisualPtr;
  * | %Property Name  | Type        |
  * |-----------------|-------------|
  * | mixColor        | VECTOR4     |
+ *
+ * Under a batch parent, the visual is drawn by the renderers of the batch parent instead of its own renderer.
  */
-class ColorVisual: public Visual::Base
+class ColorVisual: public Visual::Base, public VisualBatchMember
 {
 public:
 
@@ -70,6 +73,18 @@ public:  // from Visual
    */
   void DoCreateInstancePropertyMap( Property::Map& map ) const override;
 
+public: // from VisualBatchMember
+
+  /**
+   * @copydoc VisualBatchMember::GetBatchQuad
+   */
+  bool GetBatchQuad( const Vector2& actorSize, VisualBatchQuad& quad ) const override;
+
+  /**
+   * @copydoc VisualBatchMember::OnBatchParentRemoved
+   */
+  void OnBatchParentRemoved( Actor& actor ) override;
+
 protected:
 
   /**
@@ -94,11 +109,26 @@ protected:
    */
   void DoSetOnScene( Actor& actor ) override;
 
+  /**
+   * @copydoc Visual::Base::DoSetOffScene
+   */
+  void DoSetOffScene( Actor& actor ) override;
+
   /**
    * @copydoc Visual::Base::OnSetTransform
    */
   void OnSetTransform() override;
 
+  /**
+   * @copydoc Visual::Base::OnSetDepthIndex
+   */
+  void OnSetDepthIndex() override;
+
+  /**
+   * @copydoc Visual::Base::OnAnimateProperty
+   */
+  void OnAnimateProperty( bool animate ) override;
+
   /**
    * @copydoc Visual::Base::OnDoAction
    */
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/gradient/gradient-atlas.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>    // std::stable_sort
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/sampler.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/gradient/gradient.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+// The width of the ramps ( each ramp is a 1-dimension texture with the height as 1 )
+const uint32_t RAMP_RESOLUTION( 128u );
+
+// The number of ramps in a page of the atlas
+const uint32_t ROWS_PER_PAGE( 64u );
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gGradientAtlasLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_GRADIENT_ATLAS" );
+#endif
+
+Dali::WrapMode::Type GetWrapMode( Toolkit::GradientVisual::SpreadMethod::Type spread )
+{
+  switch(spread)
+  {
+    case Toolkit::GradientVisual::SpreadMethod::REPEAT:
+    {
+      return Dali::WrapMode::REPEAT;
+    }
+    case Toolkit::GradientVisual::SpreadMethod::REFLECT:
+    {
+      return Dali::WrapMode::MIRRORED_REPEAT;
+    }
+    case Toolkit::GradientVisual::SpreadMethod::PAD:
+    default:
+    {
+      return Dali::WrapMode::CLAMP_TO_EDGE;
+    }
+  }
+}
+
+} // unnamed namespace
+
+GradientAtlas::GradientAtlas()
+: mRamps(),
+  mPages()
+{
+}
+
+GradientAtlas::~GradientAtlas()
+{
+}
+
+GradientAtlas::RampId GradientAtlas::Acquire( Gradient& gradient )
+{
+  // The stops are sorted the same way when the pixels are generated,
+  // a stable sort keeps the order of the stops at the same offset in the key.
+  Vector< Gradient::GradientStop > stops( gradient.GetStops() );
+  std::stable_sort( stops.Begin(), stops.End() );
+
+  RampKey key;
+  key.reserve( 1u + stops.Count() * 5u );
+  key.push_back( static_cast< float >( gradient.GetSpreadMethod() ) );
+  for( auto&& stop : stops )
+  {
+    key.push_back( stop.mOffset );
+    key.push_back( stop.mStopColor.r );
+    key.push_back( stop.mStopColor.g );
+    key.push_back( stop.mStopColor.b );
+    key.push_back( stop.mStopColor.a );
+  }
+
+  RampContainer::iterator iter = mRamps.find( key );
+  if( iter != mRamps.end() )
+  {
+    const RampId rampId = iter->second;
+    ++mPages[ ( rampId - 1u ) / ROWS_PER_PAGE ].referenceCounts[ ( rampId - 1u ) % ROWS_PER_PAGE ];
+    return rampId;
+  }
+
+  // Find a free row, or add a page if all of them are used
+  uint32_t pageIndex = 0u;
+  uint32_t row = 0u;
+  const uint32_t pageCount = static_cast< uint32_t >( mPages.size() );
+  for( ; pageIndex < pageCount; ++pageIndex )
+  {
+    Page& page = mPages[ pageIndex ];
+    if( !page.freeRows.empty() )
+    {
+      row = page.freeRows.back();
+      page.freeRows.pop_back();
+      break;
+    }
+    if( page.referenceCounts.size() < ROWS_PER_PAGE )
+    {
+      row = static_cast< uint32_t >( page.referenceCounts.size() );
+      page.referenceCounts.push_back( 0u );
+      page.ramps.push_back( mRamps.end() );
+      break;
+    }
+  }
+
+  if( pageIndex == pageCount )
+  {
+    DALI_LOG_INFO( gGradientAtlasLogFilter, Debug::General, "GradientAtlas::Acquire() Add page %u\n", pageIndex );
+
+    mPages.push_back( Page() );
+    Page& page = mPages.back();
+    page.texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, RAMP_RESOLUTION, ROWS_PER_PAGE );
+    page.referenceCounts.push_back( 0u );
+    page.ramps.push_back( mRamps.end() );
+  }
+
+  const RampId rampId = pageIndex * ROWS_PER_PAGE + row + 1u;
+  Page& page = mPages[ pageIndex ];
+  page.referenceCounts[ row ] = 1u;
+  page.ramps[ row ] = mRamps.insert( std::make_pair( key, rampId ) ).first;
+
+  const uint32_t bufferSize = RAMP_RESOLUTION * 4u;
+  unsigned char* pixels = new unsigned char[ bufferSize ];
+  gradient.GenerateLookupPixels( pixels, RAMP_RESOLUTION );
+  PixelData pixelData = PixelData::New( pixels, bufferSize, RAMP_RESOLUTION, 1u, Pixel::RGBA8888, PixelData::DELETE_ARRAY );
+  page.texture.Upload( pixelData, 0u, 0u, 0u, row, RAMP_RESOLUTION, 1u );
+
+  DALI_LOG_INFO( gGradientAtlasLogFilter, Debug::Verbose, "GradientAtlas::Acquire() New ramp %u on page %u row %u\n", rampId, pageIndex, row );
+
+  return rampId;
+}
+
+void GradientAtlas::Release( RampId rampId )
+{
+  if( rampId == INVALID_RAMP_ID )
+  {
+    return;
+  }
+
+  const uint32_t pageIndex = ( rampId - 1u ) / ROWS_PER_PAGE;
+  const uint32_t row = ( rampId - 1u ) % ROWS_PER_PAGE;
+  if( pageIndex < mPages.size() && row < mPages[ pageIndex ].referenceCounts.size() )
+  {
+    Page& page = mPages[ pageIndex ];
+    if( page.referenceCounts[ row ] > 0u && --page.referenceCounts[ row ] == 0u )
+    {
+      // Keep the pixels until the row is reused by another ramp
+      mRamps.erase( page.ramps[ row ] );
+      page.ramps[ row ] = mRamps.end();
+      page.freeRows.push_back( row );
+
+      DALI_LOG_INFO( gGradientAtlasLogFilter, Debug::Verbose, "GradientAtlas::Release() Free ramp %u on page %u row %u\n", rampId, pageIndex, row );
+    }
+  }
+}
+
+TextureSet GradientAtlas::GetTextureSet( RampId rampId, Toolkit::GradientVisual::SpreadMethod::Type spread )
+{
+  const uint32_t pageIndex = ( rampId - 1u ) / ROWS_PER_PAGE;
+  if( rampId == INVALID_RAMP_ID || pageIndex >= mPages.size() )
+  {
+    return TextureSet();
+  }
+
+  Page& page = mPages[ pageIndex ];
+  TextureSet& textureSet = page.textureSets[ spread ];
+  if( !textureSet )
+  {
+    Dali::WrapMode::Type wrap = GetWrapMode( spread );
+    Sampler sampler = Sampler::New();
+    sampler.SetWrapMode( wrap, wrap );
+
+    textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, page.texture );
+    textureSet.SetSampler( 0u, sampler );
+  }
+  return textureSet;
+}
+
+float GradientAtlas::GetTextureCoordinate( RampId rampId ) const
+{
+  const uint32_t row = ( rampId - 1u ) % ROWS_PER_PAGE;
+  return ( static_cast< float >( row ) + 0.5f ) / static_cast< float >( ROWS_PER_PAGE );
+}
+
+uint32_t GradientAtlas::GetPageCount() const
+{
+  return static_cast< uint32_t >( mPages.size() );
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,144 @@
+#ifndef DALI_TOOLKIT_INTERNAL_GRADIENT_ATLAS_H
+#define DALI_TOOLKIT_INTERNAL_GRADIENT_ATLAS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/rendering/texture-set.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/visuals/gradient-visual-properties.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class Gradient;
+
+/**
+ * The atlas of gradient lookup textures. Owned by VisualFactoryCache.
+ *
+ * Each lookup texture ( ramp ) is a row of an atlas page, so gradient visuals with different stops
+ * still share one texture binding. Identical ramps are reference counted and generated only once.
+ * The rows span the whole width of the page, so the texture wrap mode still implements the spread method.
+ */
+class GradientAtlas
+{
+public:
+
+  typedef uint32_t RampId;
+
+  enum
+  {
+    INVALID_RAMP_ID = 0 ///< invalid id, use to initialize ids
+  };
+
+  /**
+   * @brief Constructor
+   */
+  GradientAtlas();
+
+  /**
+   * @brief Destructor
+   */
+  ~GradientAtlas();
+
+  /**
+   * @brief Acquire the ramp of the gradient, generating it if no identical ramp is in the atlas.
+   *
+   * @param[in] gradient The gradient with the stops and the spread method of the ramp.
+   * @return The id of the ramp. Release() must be called once it is not used anymore.
+   */
+  RampId Acquire( Gradient& gradient );
+
+  /**
+   * @brief Release the ramp. Its row is reused once no visual uses it anymore.
+   *
+   * @param[in] rampId The id returned by Acquire().
+   */
+  void Release( RampId rampId );
+
+  /**
+   * @brief Get the texture set of the page containing the ramp.
+   *
+   * The texture set is shared by all the ramps of the page using the same spread method.
+   * @param[in] rampId The id returned by Acquire().
+   * @param[in] spread The spread method deciding the wrap mode of the sampler.
+   * @return The texture set, or an empty handle if the id is invalid.
+   */
+  TextureSet GetTextureSet( RampId rampId, Toolkit::GradientVisual::SpreadMethod::Type spread );
+
+  /**
+   * @brief Get the vertical texture coordinate of the row of the ramp.
+   *
+   * @param[in] rampId The id returned by Acquire().
+   * @return The texture coordinate of the center of the row.
+   */
+  float GetTextureCoordinate( RampId rampId ) const;
+
+  /**
+   * @brief Get the number of pages in the atlas.
+   * @return The number of pages.
+   */
+  uint32_t GetPageCount() const;
+
+private:
+
+  typedef std::vector< float > RampKey; ///< The spread method followed by the offset and color of every sorted stop
+  typedef std::map< RampKey, RampId > RampContainer;
+
+  /**
+   * A texture holding the rows of multiple ramps.
+   */
+  struct Page
+  {
+    Texture texture;
+    TextureSet textureSets[3];                  ///< The texture sets for each spread method, created on demand
+    std::vector< uint32_t > referenceCounts;    ///< The reference count of each used row
+    std::vector< RampContainer::iterator > ramps; ///< The ramp of each used row
+    std::vector< uint32_t > freeRows;           ///< The released rows below the used row count
+  };
+
+  // Undefined
+  GradientAtlas( const GradientAtlas& gradientAtlas );
+
+  // Undefined
+  GradientAtlas& operator=( const GradientAtlas& gradientAtlas );
+
+private:
+
+  RampContainer       mRamps;
+  std::vector< Page > mPages;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_GRADIENT_ATLAS_H
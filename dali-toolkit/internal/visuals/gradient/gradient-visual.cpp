@@ -32,6 +32,7 @@
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/internal/visuals/gradient/gradient-atlas.h>
 #include <dali-toolkit/internal/visuals/gradient/linear-gradient.h>
 #include <dali-toolkit/internal/visuals/gradient/radial-gradient.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
@@ -61,6 +62,7 @@ DALI_ENUM_TO_STRING_TABLE_END( SPREAD_METHOD )
 
 // uniform names
 const char * const UNIFORM_ALIGNMENT_MATRIX_NAME( "uAlignmentMatrix" );
+const char * const UNIFORM_LOOKUP_COORDINATE_NAME( "uLookupCoordinate" );
 
 // default offset value
 const unsigned int DEFAULT_OFFSET_MINIMUM = 0.0f;
@@ -238,32 +240,35 @@ const char* FRAGMENT_SHADER[] =
 // fragment shader for linear gradient
 DALI_COMPOSE_SHADER(
   uniform sampler2D sTexture;\n // sampler1D?
+  uniform mediump float uLookupCoordinate;\n
   uniform lowp vec4 uColor;\n
   uniform lowp vec3 mixColor;\n
   varying mediump vec2 vTexCoord;\n
   \n
   void main()\n
   {\n
-    gl_FragColor = texture2D( sTexture, vec2( vTexCoord.y, 0.5 ) ) * vec4(mixColor, 1.0) * uColor;\n
+    gl_FragColor = texture2D( sTexture, vec2( vTexCoord.y, uLookupCoordinate ) ) * vec4(mixColor, 1.0) * uColor;\n
   }\n
 ),
 
 // fragment shader for radial gradient
 DALI_COMPOSE_SHADER(
   uniform sampler2D sTexture;\n // sampler1D?
+  uniform mediump float uLookupCoordinate;\n
   uniform lowp vec4 uColor;\n
   uniform lowp vec3 mixColor;\n
   varying mediump vec2 vTexCoord;\n
   \n
   void main()\n
   {\n
-    gl_FragColor = texture2D( sTexture, vec2( length(vTexCoord), 0.5 ) ) * vec4(mixColor, 1.0) * uColor;\n
+    gl_FragColor = texture2D( sTexture, vec2( length(vTexCoord), uLookupCoordinate ) ) * vec4(mixColor, 1.0) * uColor;\n
   }\n
 ),
 
 // fragment shader for linear gradient with corner radius
 DALI_COMPOSE_SHADER(
   uniform sampler2D sTexture;\n // sampler1D?
+  uniform mediump float uLookupCoordinate;\n
   uniform lowp vec4 uColor;\n
   uniform lowp vec3 mixColor;\n
   varying mediump vec2 vTexCoord;\n
@@ -274,7 +279,7 @@ DALI_COMPOSE_SHADER(
   void main()\n
   {\n
     mediump float dist = length( max( abs( vPosition ), vRectSize ) - vRectSize ) - vCornerRadius;\n
-    gl_FragColor = texture2D( sTexture, vec2( vTexCoord.y, 0.5 ) ) * vec4(mixColor, 1.0) * uColor;\n
+    gl_FragColor = texture2D( sTexture, vec2( vTexCoord.y, uLookupCoordinate ) ) * vec4(mixColor, 1.0) * uColor;\n
     gl_FragColor *= 1.0 - smoothstep( -1.0, 1.0, dist );\n
   }\n
 ),
@@ -282,6 +287,7 @@ DALI_COMPOSE_SHADER(
 // fragment shader for radial gradient with corner radius
 DALI_COMPOSE_SHADER(
   uniform sampler2D sTexture;\n // sampler1D?
+  uniform mediump float uLookupCoordinate;\n
   uniform lowp vec4 uColor;\n
   uniform lowp vec3 mixColor;\n
   varying mediump vec2 vTexCoord;\n
@@ -292,32 +298,12 @@ DALI_COMPOSE_SHADER(
   void main()\n
   {\n
     mediump float dist = length( max( abs( vPosition ), vRectSize ) - vRectSize ) - vCornerRadius;\n
-    gl_FragColor = texture2D( sTexture, vec2( length(vTexCoord), 0.5 ) ) * vec4(mixColor, 1.0) * uColor;\n
+    gl_FragColor = texture2D( sTexture, vec2( length(vTexCoord), uLookupCoordinate ) ) * vec4(mixColor, 1.0) * uColor;\n
     gl_FragColor *= 1.0 - smoothstep( -1.0, 1.0, dist );\n
   }\n
 )
 };
 
-Dali::WrapMode::Type GetWrapMode( Toolkit::GradientVisual::SpreadMethod::Type spread )
-{
-  switch(spread)
-  {
-    case Toolkit::GradientVisual::SpreadMethod::REPEAT:
-    {
-      return Dali::WrapMode::REPEAT;
-    }
-    case Toolkit::GradientVisual::SpreadMethod::REFLECT:
-    {
-      return Dali::WrapMode::MIRRORED_REPEAT;
-    }
-    case Toolkit::GradientVisual::SpreadMethod::PAD:
-    default:
-    {
-      return Dali::WrapMode::CLAMP_TO_EDGE;
-    }
-  }
-}
-
 } // unnamed namespace
 
 GradientVisualPtr GradientVisual::New( VisualFactoryCache& factoryCache, const Property::Map& properties )
@@ -329,6 +315,7 @@ GradientVisualPtr GradientVisual::New( VisualFactoryCache& factoryCache, const P
 
 GradientVisual::GradientVisual( VisualFactoryCache& factoryCache )
 : Visual::Base( factoryCache, Visual::FittingMode::FILL, Toolkit::Visual::GRADIENT ),
+  mRampId( GradientAtlas::INVALID_RAMP_ID ),
   mGradientType( LINEAR ),
   mIsOpaque( true )
 {
@@ -337,6 +324,7 @@ GradientVisual::GradientVisual( VisualFactoryCache& factoryCache )
 
 GradientVisual::~GradientVisual()
 {
+  mFactoryCache.GetGradientAtlas().Release( mRampId );
 }
 
 void GradientVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -384,6 +372,16 @@ void GradientVisual::DoSetOnScene( Actor& actor )
   ResourceReady( Toolkit::Visual::ResourceStatus::READY );
 }
 
+void GradientVisual::DoSetOffScene( Actor& actor )
+{
+  actor.RemoveRenderer( mImpl->mRenderer );
+  mImpl->mRenderer.Reset();
+
+  // The row of the ramp can be reused once no other visual uses it
+  mFactoryCache.GetGradientAtlas().Release( mRampId );
+  mRampId = GradientAtlas::INVALID_RAMP_ID;
+}
+
 void GradientVisual::DoCreatePropertyMap( Property::Map& map ) const
 {
   map.Clear();
@@ -446,14 +444,13 @@ void GradientVisual::InitializeRenderer()
     mFactoryCache.SaveShader( shaderType, shader );
   }
 
-  //Set up the texture set
-  TextureSet textureSet = TextureSet::New();
-  Dali::Texture lookupTexture = mGradient->GenerateLookupTexture();
-  textureSet.SetTexture( 0u, lookupTexture );
-  Dali::WrapMode::Type wrap = GetWrapMode( mGradient->GetSpreadMethod() );
-  Sampler sampler = Sampler::New();
-  sampler.SetWrapMode(  wrap, wrap  );
-  textureSet.SetSampler( 0u, sampler );
+  // The lookup texture is a row of the gradient atlas, shared with the other gradient visuals
+  GradientAtlas& gradientAtlas = mFactoryCache.GetGradientAtlas();
+  GradientAtlas::RampId rampId = gradientAtlas.Acquire( *mGradient );
+  gradientAtlas.Release( mRampId );
+  mRampId = rampId;
+
+  TextureSet textureSet = gradientAtlas.GetTextureSet( mRampId, mGradient->GetSpreadMethod() );
 
   mImpl->mRenderer = Renderer::New( geometry, shader );
   mImpl->mRenderer.SetTextures( textureSet );
@@ -465,6 +462,7 @@ void GradientVisual::InitializeRenderer()
   }
 
   mImpl->mRenderer.RegisterProperty( UNIFORM_ALIGNMENT_MATRIX_NAME, mGradientTransform );
+  mImpl->mRenderer.RegisterProperty( UNIFORM_LOOKUP_COORDINATE_NAME, gradientAtlas.GetTextureCoordinate( mRampId ) );
 
   //Register transform properties
   mImpl->mTransform.RegisterUniforms( mImpl->mRenderer, Direction::LEFT_TO_RIGHT );
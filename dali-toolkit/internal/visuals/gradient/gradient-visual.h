@@ -134,6 +134,11 @@ protected:
    */
   void DoSetOnScene( Actor& actor ) override;
 
+  /**
+   * @copydoc Visual::Base::DoSetOffScene
+   */
+  void DoSetOffScene( Actor& actor ) override;
+
 private:
 
   /**
@@ -167,6 +172,7 @@ private:
 
   Matrix3 mGradientTransform;
   IntrusivePtr<Gradient> mGradient;
+  uint32_t mRampId; ///< The row of the lookup texture in the gradient atlas
   Type mGradientType;
   bool mIsOpaque; ///< Set to false if any of the stop colors are not opaque
 };
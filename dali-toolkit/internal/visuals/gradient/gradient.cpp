@@ -17,15 +17,9 @@
 
 #include "gradient.h"
 
-#include <algorithm>    // std::sort
+#include <algorithm>    // std::stable_sort
 #include <dali/public-api/math/vector4.h>
 
-namespace
-{
-// The maximum width of the lookup texture ( it is a 1-dimension texture with the height as 1 )
-const unsigned int MAXIMUM_TEXTURE_RESOLUTION(128u);
-}
-
 namespace Dali
 {
 
@@ -88,9 +82,9 @@ const Matrix3& Gradient::GetAlignmentTransform() const
  *  If the stops have not covered the whole zero to one range,
  *  the REPEAT spread behaves different from the two others in the lookup texture generation.
  */
-Dali::Texture Gradient::GenerateLookupTexture()
+void Gradient::GenerateLookupPixels( unsigned char* pixels, unsigned int resolution )
 {
-  std::sort( mGradientStops.Begin(), mGradientStops.End() );
+  std::stable_sort( mGradientStops.Begin(), mGradientStops.End() );
 
   unsigned int numStops = mGradientStops.Count();
 
@@ -132,12 +126,6 @@ Dali::Texture Gradient::GenerateLookupTexture()
   /**
    * Generate the pixels with the color transit from one stop to next.
    */
-  unsigned int resolution = EstimateTextureResolution();
-
-  unsigned int bufferSize = resolution * 4u;
-  unsigned char* pixels = new unsigned char[ bufferSize ];
-  PixelData pixelData = PixelData::New( pixels, bufferSize, resolution, 1u, Pixel::RGBA8888, PixelData::DELETE_ARRAY );
-
   int segmentStart = 0;
   int segmentEnd = 0;
   int k = 0;
@@ -153,7 +141,7 @@ Dali::Texture Gradient::GenerateLookupTexture()
 
     for( int j = segmentStart; j<segmentEnd; j++ )
     {
-      float ratio = static_cast<float>(j-segmentStart)/(segmentWidth - 1);
+      float ratio = segmentWidth > 1.f ? static_cast<float>(j-segmentStart)/(segmentWidth - 1) : 0.f;
       Vector4 currentColor = mGradientStops[i].mStopColor * (1.f-ratio) + mGradientStops[i+1].mStopColor * ratio;
       pixels[k*4] = static_cast<unsigned char>( 255.f * Clamp( currentColor.r, 0.f, 1.f ) );
       pixels[k*4+1] = static_cast<unsigned char>( 255.f * Clamp( currentColor.g, 0.f, 1.f ) );
@@ -164,9 +152,6 @@ Dali::Texture Gradient::GenerateLookupTexture()
     segmentStart = segmentEnd;
   }
 
-  Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, resolution, 1u );
-  texture.Upload( pixelData );
-
   // remove the stops added temporarily for generating the pixels, as the spread method might get changed later
   if( tempLastStop )
   {
@@ -176,27 +161,6 @@ Dali::Texture Gradient::GenerateLookupTexture()
   {
     mGradientStops.Erase( mGradientStops.Begin());
   }
-
-  return texture;
-}
-
-unsigned int Gradient::EstimateTextureResolution()
-{
-  float minInterval = 1.0;
-  for( unsigned int i=0, numStops = mGradientStops.Count(); i<numStops-1u; i++ )
-  {
-    float interval = mGradientStops[i+1].mOffset - mGradientStops[i].mOffset;
-    minInterval = interval > minInterval ? minInterval:interval;
-  }
-  // Use at least three pixels for each segment between two stops
-  unsigned int resolution = static_cast<int>(3.f/(minInterval+Math::MACHINE_EPSILON_100)+0.5f);
-  // Clamp the resolution to handle the overlapping stops
-  if( resolution > MAXIMUM_TEXTURE_RESOLUTION )
-  {
-    return MAXIMUM_TEXTURE_RESOLUTION;
-  }
-
-  return resolution;
 }
 
 } // namespace Internal
@@ -22,7 +22,6 @@
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/math/matrix3.h>
 #include <dali/public-api/object/ref-object.h>
-#include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/visuals/gradient-visual-properties.h>
@@ -113,18 +112,13 @@ public:
   const Matrix3& GetAlignmentTransform() const;
 
   /**
-   * Generate the lookup texture with the gradient stops.
-   * @return The lookup texture which transit smoothly between stops.
-   */
-  Dali::Texture GenerateLookupTexture();
-
-private:
-
-  /**
-   * Estimate the resolution of the lookup texture.
-   * Note: Only call this function after the gradient stops are sorted in order.
+   * Generate the lookup pixels with the gradient stops.
+   * The stops are sorted in order by this call.
+   *
+   * @param[out] pixels The RGBA8888 buffer of resolution pixels to fill with the colors which transit smoothly between stops.
+   * @param[in] resolution The number of pixels to generate.
    */
-  unsigned int EstimateTextureResolution();
+  void GenerateLookupPixels( unsigned char* pixels, unsigned int resolution );
 
 protected:
 
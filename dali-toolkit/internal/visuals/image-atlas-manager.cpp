@@ -38,7 +38,8 @@ const uint32_t MAX_ITEM_AREA( MAX_ITEM_SIZE*MAX_ITEM_SIZE  );
 }
 
 ImageAtlasManager::ImageAtlasManager()
-: mBrokenImageUrl( "" )
+: mBrokenImageUrl( "" ),
+  mPackingPolicy( Toolkit::ImageAtlas::FIRST_FIT )
 {
 }
 
@@ -134,6 +135,36 @@ void ImageAtlasManager::SetBrokenImage( const std::string& brokenImageUrl )
   }
 }
 
+void ImageAtlasManager::SetPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy )
+{
+  mPackingPolicy = policy;
+  for( AtlasContainer::iterator iter = mAtlasList.begin(); iter != mAtlasList.end(); ++iter )
+  {
+    (*iter).SetPackingPolicy( policy );
+  }
+}
+
+uint32_t ImageAtlasManager::GetAtlasCount() const
+{
+  return static_cast<uint32_t>( mAtlasList.size() );
+}
+
+float ImageAtlasManager::GetOccupancyRate() const
+{
+  if( mAtlasList.empty() )
+  {
+    return 0.f;
+  }
+
+  // All the atlases have the same size
+  float occupancyRate = 0.f;
+  for( AtlasContainer::const_iterator iter = mAtlasList.begin(); iter != mAtlasList.end(); ++iter )
+  {
+    occupancyRate += (*iter).GetOccupancyRate();
+  }
+  return occupancyRate / static_cast<float>( mAtlasList.size() );
+}
+
 void ImageAtlasManager::CreateNewAtlas()
 {
   Toolkit::ImageAtlas newAtlas = Toolkit::ImageAtlas::New( DEFAULT_ATLAS_SIZE, DEFAULT_ATLAS_SIZE  );
@@ -141,6 +172,7 @@ void ImageAtlasManager::CreateNewAtlas()
   {
     newAtlas.SetBrokenImage( mBrokenImageUrl );
   }
+  newAtlas.SetPackingPolicy( mPackingPolicy );
   mAtlasList.push_back( newAtlas );
   TextureSet textureSet = TextureSet::New();
   textureSet.SetTexture( 0u, newAtlas.GetAtlas() );
@@ -106,6 +106,28 @@ public:
    */
   Shader GetShader() const;
 
+  /**
+   * @brief Set the policy choosing the free area where the next images are packed, in all the atlases.
+   *
+   * @param[in] policy The packing policy.
+   */
+  void SetPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy );
+
+  /**
+   * @brief Query the number of atlases created.
+   *
+   * @return The number of atlases.
+   */
+  uint32_t GetAtlasCount() const;
+
+  /**
+   * @brief Query what percentage of space is occupied in all the atlases together.
+   *
+   * A low rate with several atlases means the atlases are fragmented.
+   * @return The occupancy rate of the atlases, 0 if no atlas is created.
+   */
+  float GetOccupancyRate() const;
+
 private:
 
   /**
@@ -138,6 +160,7 @@ private:
   AtlasContainer    mAtlasList;
   TextureSetContainer mTextureSetList;
   std::string       mBrokenImageUrl;
+  Toolkit::ImageAtlas::PackingPolicy mPackingPolicy;
 
 };
 
@@ -19,6 +19,7 @@
 #include "mesh-visual.h"
 
 // EXTERNAL INCLUDES
+#include <sstream>
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -341,6 +342,20 @@ const char* NORMAL_MAP_FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
   }\n
 );
 
+/**
+ * The geometry shared between the mesh visuals loading the same files with the same options,
+ * along with what was read from the files to create it.
+ */
+struct MeshGeometry : public VisualFactoryCache::CachedGeometry
+{
+  std::string diffuseTextureUrl;
+  std::string normalTextureUrl;
+  std::string glossTextureUrl;
+  Vector3 sceneCenter;
+  Vector3 sceneSize;
+  Toolkit::MeshVisual::ShadingMode::Value shadingMode; ///< The shading mode supported by the files
+};
+
 } // unnamed namespace
 
 MeshVisualPtr MeshVisual::New( VisualFactoryCache& factoryCache, const Property::Map& properties )
@@ -361,6 +376,7 @@ MeshVisual::MeshVisual( VisualFactoryCache& factoryCache )
 
 MeshVisual::~MeshVisual()
 {
+  mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
 }
 
 void MeshVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -519,28 +535,61 @@ void MeshVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
 
 void MeshVisual::InitializeRenderer()
 {
-  //Try to load the geometry from the file.
-  if( !LoadGeometry() )
+  //The visuals loading the same files with the same options share the geometry, the files are only parsed once.
+  std::ostringstream key;
+  key << "mesh:" << mObjectUrl << '\n' << mMaterialUrl << '\n' << mShadingMode << ':' << mUseTexture << ':' << mUseSoftNormals;
+
+  VisualFactoryCache::CachedGeometryPtr cachedGeometry = mFactoryCache.GetCachedGeometry( key.str() );
+  if( cachedGeometry )
   {
-    SupplyEmptyGeometry();
-    return;
+    const MeshGeometry* meshGeometry = static_cast< MeshGeometry* >( cachedGeometry.Get() );
+    mGeometry = meshGeometry->geometry;
+    mDiffuseTextureUrl = meshGeometry->diffuseTextureUrl;
+    mNormalTextureUrl = meshGeometry->normalTextureUrl;
+    mGlossTextureUrl = meshGeometry->glossTextureUrl;
+    mSceneCenter = meshGeometry->sceneCenter;
+    mSceneSize = meshGeometry->sceneSize;
+    mShadingMode = meshGeometry->shadingMode;
+    mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
+    mCachedGeometry = cachedGeometry;
   }
-
-  //If a texture is used by the obj file, load the supplied material file.
-  if( mObjLoader.IsTexturePresent() && !mMaterialUrl.empty() )
+  else
   {
-    if( !LoadMaterial() )
+    //Try to load the geometry from the file.
+    if( !LoadGeometry() )
     {
       SupplyEmptyGeometry();
       return;
     }
-  }
 
-  //Now that the required parts are loaded, create the geometry for the object.
-  if( !CreateGeometry() )
-  {
-    SupplyEmptyGeometry();
-    return;
+    //If a texture is used by the obj file, load the supplied material file.
+    if( mObjLoader.IsTexturePresent() && !mMaterialUrl.empty() )
+    {
+      if( !LoadMaterial() )
+      {
+        SupplyEmptyGeometry();
+        return;
+      }
+    }
+
+    //Now that the required parts are loaded, create the geometry for the object.
+    if( !CreateGeometry() )
+    {
+      SupplyEmptyGeometry();
+      return;
+    }
+
+    MeshGeometry* meshGeometry = new MeshGeometry();
+    meshGeometry->geometry = mGeometry;
+    meshGeometry->diffuseTextureUrl = mDiffuseTextureUrl;
+    meshGeometry->normalTextureUrl = mNormalTextureUrl;
+    meshGeometry->glossTextureUrl = mGlossTextureUrl;
+    meshGeometry->sceneCenter = mSceneCenter;
+    meshGeometry->sceneSize = mSceneSize;
+    meshGeometry->shadingMode = mShadingMode;
+    mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
+    mCachedGeometry = meshGeometry;
+    mFactoryCache.SaveCachedGeometry( key.str(), mCachedGeometry );
   }
 
   CreateShader();
@@ -183,6 +183,7 @@ private:
 
   Shader mShader;
   Geometry mGeometry;
+  VisualFactoryCache::CachedGeometryPtr mCachedGeometry; ///< Keeps the geometry shared with the other visuals in the cache
   TextureSet mTextureSet;
 
   ObjLoader mObjLoader;
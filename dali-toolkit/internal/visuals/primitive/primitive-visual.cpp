@@ -19,6 +19,7 @@
 #include "primitive-visual.h"
 
 // EXTERNAL INCLUDES
+#include <sstream>
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/public-api/common/constants.h>
@@ -160,6 +161,14 @@ const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
   }\n
 );
 
+/**
+ * The geometry shared between the primitive visuals with the same shape properties.
+ */
+struct PrimitiveGeometry : public VisualFactoryCache::CachedGeometry
+{
+  Vector3 objectDimensions; ///< Dimensions of shape, scaled to be between 0.0 and 1.0.
+};
+
 } // unnamed namespace
 
 PrimitiveVisualPtr PrimitiveVisual::New( VisualFactoryCache& factoryCache, const Property::Map& properties )
@@ -187,6 +196,7 @@ PrimitiveVisual::PrimitiveVisual( VisualFactoryCache& factoryCache )
 
 PrimitiveVisual::~PrimitiveVisual()
 {
+  mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
 }
 
 void PrimitiveVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -484,6 +494,24 @@ void PrimitiveVisual::CreateShader()
 
 void PrimitiveVisual::CreateGeometry()
 {
+  // The visuals with the same shape properties share the geometry
+  std::ostringstream key;
+  key.precision( 9 );
+  key << "primitive:" << mPrimitiveType << ':' << mSlices << ':' << mStacks << ':'
+      << mScaleTopRadius << ':' << mScaleBottomRadius << ':' << mScaleHeight << ':' << mScaleRadius << ':'
+      << mScaleDimensions.x << ':' << mScaleDimensions.y << ':' << mScaleDimensions.z << ':'
+      << mBevelPercentage << ':' << mBevelSmoothness;
+
+  VisualFactoryCache::CachedGeometryPtr cachedGeometry = mFactoryCache.GetCachedGeometry( key.str() );
+  if( cachedGeometry )
+  {
+    mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
+    mCachedGeometry = cachedGeometry;
+    mGeometry = cachedGeometry->geometry;
+    mObjectDimensions = static_cast< PrimitiveGeometry* >( cachedGeometry.Get() )->objectDimensions;
+    return;
+  }
+
   Dali::Vector<Vertex> vertices;
   Dali::Vector<unsigned short> indices;
 
@@ -543,6 +571,13 @@ void PrimitiveVisual::CreateGeometry()
 
   //Indices for triangle formulation
   mGeometry.SetIndexBuffer( &indices[0], indices.Size() );
+
+  PrimitiveGeometry* primitiveGeometry = new PrimitiveGeometry();
+  primitiveGeometry->geometry = mGeometry;
+  primitiveGeometry->objectDimensions = mObjectDimensions;
+  mFactoryCache.ReleaseCachedGeometry( mCachedGeometry );
+  mCachedGeometry = primitiveGeometry;
+  mFactoryCache.SaveCachedGeometry( key.str(), mCachedGeometry );
 }
 
 void PrimitiveVisual::CreateSphere( Vector<Vertex>& vertices, Vector<unsigned short>& indices, int slices, int stacks )
@@ -324,6 +324,7 @@ private:
 private:
   Shader mShader;
   Geometry mGeometry;
+  VisualFactoryCache::CachedGeometryPtr mCachedGeometry; ///< Keeps the geometry shared with the other visuals in the cache
 
   Vector3 mObjectDimensions;     //Dimensions of shape, scaled to be between 0.0 and 1.0.
 
@@ -19,8 +19,10 @@
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
 // EXTERNAL HEADERS
+#include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <vector>
 #include <dali/public-api/math/vector4.h>
 #include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -28,8 +30,10 @@
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/rendering/geometry.h>
+#include <dali/public-api/rendering/texture.h>
 
 // INTERNAL HEADERS
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/image-loader/image-atlas-impl.h>
 #include <dali-toolkit/public-api/image-loader/sync-image-loader.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
@@ -64,6 +68,16 @@ size_t GetNumberOfRemoteLoaderThreads()
   return GetNumberOfThreads(NUMBER_OF_REMOTE_LOADER_THREADS_ENV, DEFAULT_NUMBER_OF_REMOTE_LOADER_THREADS);
 }
 
+constexpr auto ANIMATED_IMAGE_FRAME_CACHE_SIZE_ENV = "DALI_ANIMATED_IMAGE_FRAME_CACHE_SIZE";
+
+size_t GetAnimatedImageFrameCacheBudget()
+{
+  // The budget is given in kilobytes per url. Frame retention is disabled by default.
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto budgetString = GetEnvironmentVariable( ANIMATED_IMAGE_FRAME_CACHE_SIZE_ENV );
+  return budgetString ? std::strtoul( budgetString, nullptr, 10 ) * 1024u : 0u;
+}
+
 } // namespace
 
 namespace Dali
@@ -115,6 +129,13 @@ void PreMultiply( Devel::PixelBuffer pixelBuffer, TextureManager::MultiplyOnLoad
   }
 }
 
+size_t GetTextureMemorySize( const TextureSet& textureSet )
+{
+  // The pixel format of an uploaded texture is not available, so assume the worst case of 4 bytes per pixel.
+  Texture texture = textureSet ? textureSet.GetTexture( 0u ) : Texture();
+  return texture ? static_cast< size_t >( texture.GetWidth() ) * texture.GetHeight() * 4u : 0u;
+}
+
 } // Anonymous namespace
 
 TextureManager::MaskingData::MaskingData()
@@ -132,6 +153,8 @@ TextureManager::TextureManager()
   mLifecycleObservers(),
   mLoadQueue(),
   mBrokenImageUrl(""),
+  mRetainedFrames(),
+  mFrameCacheBudget( GetAnimatedImageFrameCacheBudget() ),
   mCurrentTextureId( 0 ),
   mQueueLoadFlag(false)
 {
@@ -452,6 +475,8 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   Dali::AnimatedImageLoading      animatedImageLoading,
   uint32_t                        frameIndex )
 {
+  DALI_TOOLKIT_PROFILE_SCOPE( "TextureManager::RequestLoad" );
+
   // First check if the requested Texture is cached.
   bool isAnimatedImage = ( animatedImageLoading ) ? true : false;
   const TextureHash textureHash = GenerateHash( url.GetUrl(), desiredSize, fittingMode, samplingMode, useAtlas,
@@ -465,7 +490,12 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   // Check if the requested Texture exists in the cache.
   if( cacheIndex != INVALID_CACHE_INDEX )
   {
-    if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
+    if( mTextureInfoContainer[ cacheIndex ].retained )
+    {
+      // The frame cache holds the only reference of this frame; hand it over to the new user.
+      ReleaseRetainedAnimatedImageFrame( mTextureInfoContainer[ cacheIndex ] );
+    }
+    else if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
     {
       // Mark this texture being used by another client resource. Forced reload would replace the current texture
       // without the need for incrementing the reference count.
@@ -571,6 +601,7 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
 
 void TextureManager::Remove( const TextureManager::TextureId textureId, TextureUploadObserver* observer )
 {
+  std::string retainedFrameUrl;
   int textureInfoIndex = GetCacheIndexFromId( textureId );
   if( textureInfoIndex != INVALID_INDEX )
   {
@@ -588,8 +619,13 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
       textureInfo.referenceCount = 0;
       bool removeTextureInfo = false;
 
+      // Uploaded animated image frames may be kept for the next visual showing the same frame.
+      if( textureInfo.loadState == UPLOADED && RetainAnimatedImageFrame( textureInfo ) )
+      {
+        retainedFrameUrl = textureInfo.url.GetUrl();
+      }
       // If loaded, we can remove the TextureInfo and the Atlas (if atlased).
-      if( textureInfo.loadState == UPLOADED )
+      else if( textureInfo.loadState == UPLOADED )
       {
         if( textureInfo.atlas )
         {
@@ -629,6 +665,11 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
         }
       }
     }
+
+    if( !retainedFrameUrl.empty() )
+    {
+      TrimRetainedAnimatedImageFrames( retainedFrameUrl );
+    }
   }
 }
 
@@ -1390,6 +1431,104 @@ Geometry TextureManager::GetRenderGeometry(TextureId textureId, uint32_t& frontE
          Geometry();
 }
 
+void TextureManager::SetAnimatedImageFrameCacheBudget( size_t budget )
+{
+  mFrameCacheBudget = budget;
+
+  std::vector< std::string > urls;
+  urls.reserve( mRetainedFrames.size() );
+  for( auto&& retainedFrames : mRetainedFrames )
+  {
+    urls.push_back( retainedFrames.first );
+  }
+
+  for( auto&& url : urls )
+  {
+    TrimRetainedAnimatedImageFrames( url );
+  }
+}
+
+bool TextureManager::RetainAnimatedImageFrame( TextureInfo& textureInfo )
+{
+  if( !textureInfo.animatedImageLoading || textureInfo.atlas )
+  {
+    return false;
+  }
+
+  const size_t frameSize = GetTextureMemorySize( textureInfo.textureSet );
+  if( frameSize == 0u || frameSize > mFrameCacheBudget )
+  {
+    return false;
+  }
+
+  RetainedFrames& retainedFrames = mRetainedFrames[ textureInfo.url.GetUrl() ];
+  retainedFrames.textureIds.push_back( textureInfo.textureId );
+  retainedFrames.size += frameSize;
+
+  textureInfo.referenceCount = 1;
+  textureInfo.retained = true;
+
+  DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::RetainAnimatedImageFrame( url=%s frame=%u ) retained:%zu bytes:%zu\n",
+                 textureInfo.url.GetUrl().c_str(), textureInfo.frameIndex, retainedFrames.textureIds.size(), retainedFrames.size );
+  return true;
+}
+
+void TextureManager::ReleaseRetainedAnimatedImageFrame( TextureInfo& textureInfo )
+{
+  textureInfo.retained = false;
+
+  auto iter = mRetainedFrames.find( textureInfo.url.GetUrl() );
+  if( iter != mRetainedFrames.end() )
+  {
+    RetainedFrames& retainedFrames = iter->second;
+    auto idIter = std::find( retainedFrames.textureIds.begin(), retainedFrames.textureIds.end(), textureInfo.textureId );
+    if( idIter != retainedFrames.textureIds.end() )
+    {
+      retainedFrames.textureIds.erase( idIter );
+      retainedFrames.size -= std::min( retainedFrames.size, GetTextureMemorySize( textureInfo.textureSet ) );
+    }
+
+    if( retainedFrames.textureIds.empty() )
+    {
+      mRetainedFrames.erase( iter );
+    }
+  }
+}
+
+void TextureManager::TrimRetainedAnimatedImageFrames( const std::string& url )
+{
+  auto iter = mRetainedFrames.find( url );
+  if( iter == mRetainedFrames.end() )
+  {
+    return;
+  }
+
+  RetainedFrames& retainedFrames = iter->second;
+  while( retainedFrames.size > mFrameCacheBudget && !retainedFrames.textureIds.empty() )
+  {
+    const TextureId textureId = retainedFrames.textureIds.front();
+    retainedFrames.textureIds.pop_front();
+
+    int cacheIndex = GetCacheIndexFromId( textureId );
+    if( cacheIndex != INVALID_CACHE_INDEX )
+    {
+      TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
+      retainedFrames.size -= std::min( retainedFrames.size, GetTextureMemorySize( textureInfo.textureSet ) );
+
+      DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::TrimRetainedAnimatedImageFrames( url=%s ) Drop frame=%u\n",
+                     url.c_str(), textureInfo.frameIndex );
+
+      // Retained frames are never atlased and have no other users, so the TextureInfo can go directly.
+      mTextureInfoContainer.erase( mTextureInfoContainer.begin() + cacheIndex );
+    }
+  }
+
+  if( retainedFrames.textureIds.empty() )
+  {
+    mRetainedFrames.erase( iter );
+  }
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
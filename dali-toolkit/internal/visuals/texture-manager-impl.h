@@ -22,6 +22,7 @@
 #include <functional>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
@@ -436,6 +437,16 @@ public:
    */
   Geometry GetRenderGeometry(TextureId textureId, uint32_t& frontElements, uint32_t& backElements );
 
+  /**
+   * @brief Sets the memory budget for decoded animated image frames that are kept after their last user removed them.
+   *
+   * Retained frames are shared by every visual showing the same animated image, so revisiting a frame
+   * (looping, seeking or another visual with the same url) does not decode it again.
+   * The budget applies to each url separately; the least recently released frames are dropped first.
+   * @param[in] budget The budget in bytes per url. 0 disables frame retention.
+   */
+  void SetAnimatedImageFrameCacheBudget( size_t budget );
+
 private:
 
   /**
@@ -541,7 +552,8 @@ private:
       cropToMask( cropToMask ),
       orientationCorrection( true ),
       preMultiplyOnLoad( preMultiplyOnLoad ),
-      preMultiplied( false )
+      preMultiplied( false ),
+      retained( false )
     {
     }
 
@@ -576,6 +588,7 @@ private:
     bool orientationCorrection:1;  ///< true if the image should be rotated to match exif orientation data
     bool preMultiplyOnLoad:1;      ///< true if the image's color should be multiplied by it's alpha
     bool preMultiplied:1;          ///< true if the image's color was multiplied by it's alpha
+    bool retained:1;               ///< true if the texture is only kept alive by the animated image frame cache
   };
 
   /**
@@ -721,6 +734,26 @@ private:
    */
   void NotifyObservers( TextureInfo& textureInfo, bool success );
 
+  /**
+   * @brief Keeps an animated image frame cached after its last user has removed it.
+   * The frame cache takes over the last reference of the texture.
+   * @param[in] textureInfo The struct associated with the uploaded frame
+   * @return true if the frame is retained, false if it should be removed
+   */
+  bool RetainAnimatedImageFrame( TextureInfo& textureInfo );
+
+  /**
+   * @brief Hands a retained frame back to a user; the reference held by the frame cache becomes the user's reference.
+   * @param[in] textureInfo The struct associated with the retained frame
+   */
+  void ReleaseRetainedAnimatedImageFrame( TextureInfo& textureInfo );
+
+  /**
+   * @brief Drops the least recently retained frames of the given url until they fit within the budget.
+   * @param[in] url The url of the animated image
+   */
+  void TrimRetainedAnimatedImageFrames( const std::string& url );
+
   /**
    * @brief Generates a new, unique TextureId
    * @return A unique TextureId
@@ -878,6 +911,15 @@ private:
     TextureSet textureSet;
   };
 
+  /**
+   * @brief The frames of one animated image kept by the frame cache, oldest first.
+   */
+  struct RetainedFrames
+  {
+    std::deque< TextureId > textureIds; ///< Retained frames, in release order
+    size_t                  size;       ///< Total memory used by the retained frames, in bytes
+  };
+
 private:
 
   /**
@@ -906,6 +948,8 @@ private:  // Member Variables:
   Dali::Vector<LifecycleObserver*>              mLifecycleObservers;   ///< Lifecycle observers of texture manager
   Dali::Vector<LoadQueueElement>                mLoadQueue;            ///< Queue of textures to load after NotifyObservers
   std::string                                   mBrokenImageUrl;       ///< Broken image url
+  std::unordered_map< std::string, RetainedFrames > mRetainedFrames;   ///< Animated image frames retained per url
+  size_t                                        mFrameCacheBudget;     ///< Memory budget per url for retained animated image frames
   TextureId                                     mCurrentTextureId;     ///< The current value used for the unique Texture Id generation
   bool                                          mQueueLoadFlag;        ///< Flag that causes Load Textures to be queued.
 };
@@ -380,6 +380,17 @@ Property::Map TransitionData::GetAnimatorAt( size_t index )
   return map;
 }
 
+const TransitionData::Plan* TransitionData::FindPlan( std::size_t visualsSignature ) const
+{
+  auto iter = mPlans.find( visualsSignature );
+  return iter != mPlans.end() ? &iter->second : nullptr;
+}
+
+const TransitionData::Plan& TransitionData::AddPlan( std::size_t visualsSignature, Plan&& plan ) const
+{
+  return mPlans[ visualsSignature ] = std::move( plan );
+}
+
 } // namespace Internal
 } // namespace Toolkit
 } // namespace Dali
@@ -20,8 +20,12 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/animation/alpha-function.h>
+#include <dali/public-api/animation/time-period.h>
 #include <dali/public-api/object/property-key.h>
 #include <dali/devel-api/common/owner-container.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/transition-data.h>
@@ -74,6 +78,23 @@ public:
   typedef Dali::OwnerContainer< Animator* > AnimatorList;
   typedef AnimatorList::Iterator Iterator;
 
+  /**
+   * @brief An animator with its target resolved for a set of registered visuals.
+   */
+  struct PlanStep
+  {
+    Animator*           animator;       ///< The animator, owned by the transition data
+    int                 visualPosition; ///< The position of the target in the registered visuals of the control, or -1 if the target is an actor
+    Property::Index     propertyIndex;  ///< The index of the property of the target actor, or Property::INVALID_INDEX if it is looked up by key
+    Dali::AlphaFunction alphaFunction;  ///< The alpha function of the animator
+    Dali::TimePeriod    timePeriod;     ///< The time period of the animator
+  };
+
+  /**
+   * @brief The animators of the transition resolved for a set of registered visuals, in the order they were added.
+   */
+  typedef std::vector< PlanStep > Plan;
+
 public:
   /**
    * @copydoc Dali::Transition::New()
@@ -105,6 +126,25 @@ public:
    */
   Property::Map GetAnimatorAt( size_t index );
 
+  /**
+   * @brief Finds the plan compiled for a set of registered visuals.
+   *
+   * The plans are compiled by the controls the first time the transition is created for their visuals,
+   * so the controls of a type, which register the same visuals, do not look up the targets by name again.
+   * @param[in] visualsSignature The signature of the indices and names of the registered visuals
+   * @return The plan, or nullptr if no plan has been compiled for the visuals
+   */
+  const Plan* FindPlan( std::size_t visualsSignature ) const;
+
+  /**
+   * @brief Stores the plan compiled for a set of registered visuals.
+   *
+   * @param[in] visualsSignature The signature of the indices and names of the registered visuals
+   * @param[in] plan The plan
+   * @return The stored plan
+   */
+  const Plan& AddPlan( std::size_t visualsSignature, Plan&& plan ) const;
+
 private: // Implementation
   /**
    * Ref counted object - Only allow construction via New().
@@ -144,6 +184,7 @@ private: // Unimplemented methods
 
 private: // Data members
   AnimatorList mAnimators; ///< A vector of individual property transitions from which to generate a Dali::Animation.
+  mutable std::unordered_map< std::size_t, Plan > mPlans; ///< The plans compiled by signature of the registered visuals, a cache which does not change the transition
 };
 
 } // namespace Internal
@@ -393,6 +393,17 @@ Vector2 Internal::Visual::Base::Impl::Transform::GetVisualSize( const Vector2& c
                   Lerp( mOffsetSizeMode.w, mSize.y * controlSize.y, mSize.y ) ) + mExtraSize;
 }
 
+Vector2 Internal::Visual::Base::Impl::Transform::GetVisualCentre( const Vector2& controlSize )
+{
+  // The same as the vertex shaders: ( anchorPoint * visualSize ) + ( ( visualOffset + origin ) * uSize )
+  const Vector2 offset( Lerp( mOffsetSizeMode.x, mOffset.x * controlSize.x, mOffset.x ),
+                        Lerp( mOffsetSizeMode.y, mOffset.y * controlSize.y, mOffset.y ) );
+  const Vector2 anchorPoint = Vector2( 0.5f, 0.5f ) - PointToVector2( mAnchorPoint, Toolkit::Direction::LEFT_TO_RIGHT );
+  const Vector2 origin = PointToVector2( mOrigin, Toolkit::Direction::LEFT_TO_RIGHT ) - Vector2( 0.5f, 0.5f );
+
+  return ( anchorPoint * GetVisualSize( controlSize ) ) + offset + ( origin * controlSize );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
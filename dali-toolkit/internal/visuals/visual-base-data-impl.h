@@ -110,6 +110,12 @@ struct Base::Impl
      */
     Vector2 GetVisualSize( const Vector2& controlSize );
 
+    /**
+     * Convert the control size and the transform attributes into the position
+     * of the centre of the visual, relative to the centre of the control.
+     */
+    Vector2 GetVisualCentre( const Vector2& controlSize );
+
     Vector2 mOffset;
     Vector2 mSize;
     Vector2 mExtraSize;
@@ -29,6 +29,7 @@
 #include <dali-toolkit/public-api/visuals/primitive-visual-properties.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/helpers/property-helper.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
@@ -302,6 +303,8 @@ void Visual::Base::SetDepthIndex( int index )
   {
     mImpl->mRenderer.SetProperty( Renderer::Property::DEPTH_INDEX, mImpl->mDepthIndex );
   }
+
+  OnSetDepthIndex();
 }
 
 int Visual::Base::GetDepthIndex() const
@@ -313,6 +316,8 @@ void Visual::Base::SetOnScene( Actor& actor )
 {
   if( !IsOnScene() )
   {
+    DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE( "Visual::Base::SetOnScene", actor );
+
     // To display the actor correctly, renderer should not be added to actor until all required resources are ready.
     // Thus the calling of actor.AddRenderer() should happen inside derived class as base class does not know the exact timing.
     DoSetOnScene( actor );
@@ -434,6 +439,16 @@ void Visual::Base::OnDoAction( const Property::Index actionId, const Property::V
   // May be overriden by derived class
 }
 
+void Visual::Base::OnSetDepthIndex()
+{
+  // May be overriden by derived class
+}
+
+void Visual::Base::OnAnimateProperty( bool animate )
+{
+  // May be overriden by derived class
+}
+
 void Visual::Base::RegisterMixColor()
 {
   // Only register if not already registered.
@@ -587,6 +602,8 @@ Property::Index Visual::Base::GetPropertyIndex( Property::Key key )
 void Visual::Base::SetupTransition(
   Dali::Animation& transition,
   Internal::TransitionData::Animator& animator,
+  const Dali::AlphaFunction& alphaFunction,
+  const Dali::TimePeriod& timePeriod,
   Property::Index index,
   Property::Value& initialValue,
   Property::Value& targetValue )
@@ -613,9 +630,8 @@ void Visual::Base::SetupTransition(
 
         transition.AnimateTo( Property( mImpl->mRenderer, index ),
                               targetValue,
-                              animator.alphaFunction,
-                              TimePeriod( animator.timePeriodDelay,
-                                          animator.timePeriodDuration ) );
+                              alphaFunction,
+                              timePeriod );
       }
     }
   }
@@ -624,6 +640,15 @@ void Visual::Base::SetupTransition(
 void Visual::Base::AnimateProperty(
   Dali::Animation& transition,
   Internal::TransitionData::Animator& animator )
+{
+  AnimateProperty( transition, animator, animator.alphaFunction, TimePeriod( animator.timePeriodDelay, animator.timePeriodDuration ) );
+}
+
+void Visual::Base::AnimateProperty(
+  Dali::Animation& transition,
+  Internal::TransitionData::Animator& animator,
+  const Dali::AlphaFunction& alphaFunction,
+  const Dali::TimePeriod& timePeriod )
 {
 #if defined(DEBUG_ENABLED)
   {
@@ -633,14 +658,10 @@ void Visual::Base::AnimateProperty(
   }
 #endif
 
-  Property::Map map;
-  DoCreatePropertyMap( map );
-  Property::Value* valuePtr = map.Find( Toolkit::Visual::Property::TYPE );
-  int visualType = -1;
-  if( valuePtr )
-  {
-    valuePtr->Get( visualType );
-  }
+  OnAnimateProperty( animator.animate );
+
+  // The type is known from the construction, so the property map of the visual is not created for every animator
+  const Toolkit::Visual::Type visualType = mImpl->mType;
 
   if( animator.propertyKey == Toolkit::Visual::Property::MIX_COLOR ||
       animator.propertyKey == MIX_COLOR ||
@@ -649,22 +670,24 @@ void Visual::Base::AnimateProperty(
       ( visualType == Toolkit::Visual::PRIMITIVE &&
         animator.propertyKey == PrimitiveVisual::Property::MIX_COLOR ) )
   {
-    AnimateMixColorProperty( transition, animator );
+    AnimateMixColorProperty( transition, animator, alphaFunction, timePeriod );
   }
   else if(animator.propertyKey == Toolkit::Visual::Property::OPACITY ||
           animator.propertyKey == OPACITY )
   {
-    AnimateOpacityProperty( transition, animator );
+    AnimateOpacityProperty( transition, animator, alphaFunction, timePeriod );
   }
   else if( mImpl->mRenderer )
   {
-    AnimateRendererProperty( transition, animator );
+    AnimateRendererProperty( transition, animator, alphaFunction, timePeriod );
   }
 }
 
 void Visual::Base::AnimateOpacityProperty(
   Dali::Animation& transition,
-  Internal::TransitionData::Animator& animator )
+  Internal::TransitionData::Animator& animator,
+  const Dali::AlphaFunction& alphaFunction,
+  const Dali::TimePeriod& timePeriod )
 {
   bool isOpaque = mImpl->mMixColor.a >= 1.0f;
 
@@ -680,13 +703,15 @@ void Visual::Base::AnimateOpacityProperty(
     mImpl->mMixColor.a = targetOpacity;
   }
 
-  SetupTransition( transition, animator, DevelRenderer::Property::OPACITY, animator.initialValue, animator.targetValue );
+  SetupTransition( transition, animator, alphaFunction, timePeriod, DevelRenderer::Property::OPACITY, animator.initialValue, animator.targetValue );
   SetupBlendMode( transition, isOpaque, animator.animate );
 }
 
 void Visual::Base::AnimateRendererProperty(
   Dali::Animation& transition,
-  Internal::TransitionData::Animator& animator )
+  Internal::TransitionData::Animator& animator,
+  const Dali::AlphaFunction& alphaFunction,
+  const Dali::TimePeriod& timePeriod )
 {
   Property::Index index = GetPropertyIndex( animator.propertyKey );
   if( index != Property::INVALID_INDEX )
@@ -708,13 +733,15 @@ void Visual::Base::AnimateRendererProperty(
       mImpl->mTransform.UpdatePropertyMap( map );
     }
 
-    SetupTransition( transition, animator, index, animator.initialValue, animator.targetValue );
+    SetupTransition( transition, animator, alphaFunction, timePeriod, index, animator.initialValue, animator.targetValue );
   }
 }
 
 void Visual::Base::AnimateMixColorProperty(
   Dali::Animation& transition,
-  Internal::TransitionData::Animator& animator )
+  Internal::TransitionData::Animator& animator,
+  const Dali::AlphaFunction& alphaFunction,
+  const Dali::TimePeriod& timePeriod )
 {
   Property::Index index = mImpl->mMixColorIndex;
   bool animateOpacity = false;
@@ -757,10 +784,10 @@ void Visual::Base::AnimateMixColorProperty(
       targetMixColor = Vector3(mixColor);
     }
 
-    SetupTransition( transition, animator, index, initialMixColor, targetMixColor );
+    SetupTransition( transition, animator, alphaFunction, timePeriod, index, initialMixColor, targetMixColor );
     if( animateOpacity )
     {
-      SetupTransition( transition, animator, DevelRenderer::Property::OPACITY, initialOpacity, targetOpacity );
+      SetupTransition( transition, animator, alphaFunction, timePeriod, DevelRenderer::Property::OPACITY, initialOpacity, targetOpacity );
       SetupBlendMode( transition, isOpaque, animator.animate );
     }
   }
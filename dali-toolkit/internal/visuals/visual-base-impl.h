@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/animation/animation.h>
+#include <dali/public-api/animation/time-period.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/object/base-object.h>
@@ -226,6 +227,17 @@ public:
   void AnimateProperty( Dali::Animation& transition,
                         Internal::TransitionData::Animator& animator );
 
+  /**
+   * @copydoc AnimateProperty( Dali::Animation&, Internal::TransitionData::Animator& )
+   *
+   * @param[in] alphaFunction The alpha function of the animator, compiled with the transition plan
+   * @param[in] timePeriod The time period of the animator, compiled with the transition plan
+   */
+  void AnimateProperty( Dali::Animation& transition,
+                        Internal::TransitionData::Animator& animator,
+                        const Dali::AlphaFunction& alphaFunction,
+                        const Dali::TimePeriod& timePeriod );
+
   /**
    * @brief Add an observer to watch for when the Visuals have events to notify
    * Currently only supports a single observer
@@ -350,6 +362,18 @@ protected:
    */
   virtual void OnDoAction( const Property::Index actionId, const Property::Value& attributes );
 
+  /**
+   * @brief Called by SetDepthIndex() after the depth index has changed.
+   */
+  virtual void OnSetDepthIndex();
+
+  /**
+   * @brief Called by AnimateProperty() before a property of the visual is set or animated by a transition.
+   *
+   * @param[in] animate Whether the property is animated, rather than set to its target value
+   */
+  virtual void OnAnimateProperty( bool animate );
+
 protected:
 
   /**
@@ -390,12 +414,16 @@ private:
    *
    * @param[in] transition The transition to use or set up.
    * @param[in] animator The animation data to use
+   * @param[in] alphaFunction The alpha function to animate with
+   * @param[in] timePeriod The time period to animate in
    * @param[in] index The property index on the renderer to animate
    * @param[in] initialValue The optional initial value
    * @param[in] targetValue The target value to use
    */
   void SetupTransition( Dali::Animation& transition,
                         Internal::TransitionData::Animator& animator,
+                        const Dali::AlphaFunction& alphaFunction,
+                        const Dali::TimePeriod& timePeriod,
                         Property::Index index,
                         Property::Value& initialValue,
                         Property::Value& targetValue );
@@ -408,18 +436,26 @@ private:
    *
    * @param[in] transition The transition to use or set up.
    * @param[in] animator The animation data to use
+   * @param[in] alphaFunction The alpha function to animate with
+   * @param[in] timePeriod The time period to animate in
    */
   void AnimateOpacityProperty( Dali::Animation& transition,
-                               Internal::TransitionData::Animator& animator );
+                               Internal::TransitionData::Animator& animator,
+                               const Dali::AlphaFunction& alphaFunction,
+                               const Dali::TimePeriod& timePeriod );
 
   /**
    * Animate the renderer property - no special handling
    *
    * @param[in] transition The transition to use or set up.
    * @param[in] animator The animation data to use
+   * @param[in] alphaFunction The alpha function to animate with
+   * @param[in] timePeriod The time period to animate in
    */
   void AnimateRendererProperty( Dali::Animation& transition,
-                                Internal::TransitionData::Animator& animator );
+                                Internal::TransitionData::Animator& animator,
+                                const Dali::AlphaFunction& alphaFunction,
+                                const Dali::TimePeriod& timePeriod );
 
   /**
    * Animate the mix color property.
@@ -431,9 +467,13 @@ private:
    *
    * @param[in] transition The transition to use or set up.
    * @param[in] animator The animation data to use
+   * @param[in] alphaFunction The alpha function to animate with
+   * @param[in] timePeriod The time period to animate in
    */
   void AnimateMixColorProperty( Dali::Animation& transition,
-                                Internal::TransitionData::Animator& animator );
+                                Internal::TransitionData::Animator& animator,
+                                const Dali::AlphaFunction& alphaFunction,
+                                const Dali::TimePeriod& timePeriod );
 
   /**
    * Set up the right blend mode if the opacity is being animated.
@@ -0,0 +1,741 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-batch-manager.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/public-api/actors/layer.h>
+#include <dali/public-api/common/constants.h>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/object/property-conditions.h>
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/rendering/geometry.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+// The vertices of a renderer are indexed with unsigned shorts
+const size_t MAX_QUADS_PER_RENDERER = ( std::numeric_limits< unsigned short >::max() + 1u ) / 4u;
+
+// The changes of the tracked actors which rebuild the batch
+const float POSITION_STEP = 1.0f;
+const float COLOR_STEP = 1.0f / 255.0f;
+const float SCALE_STEP = 0.001f;
+
+const char* VERTEX_SHADER = DALI_COMPOSE_SHADER(
+  attribute mediump vec2 aPosition;\n
+  attribute mediump vec2 aLocalPosition;\n
+  attribute mediump vec2 aHalfSize;\n
+  attribute lowp vec4 aColor;\n
+  attribute mediump vec4 aShape;\n
+  uniform highp mat4 uMvpMatrix;\n
+  varying mediump vec2 vLocalPosition;\n
+  varying mediump vec2 vHalfSize;\n
+  varying lowp vec4 vColor;\n
+  varying mediump vec4 vShape;\n
+  \n
+  void main()\n
+  {\n
+    vLocalPosition = aLocalPosition;\n
+    vHalfSize = aHalfSize;\n
+    vColor = aColor;\n
+    vShape = aShape;\n
+    gl_Position = uMvpMatrix * vec4( aPosition, 0.0, 1.0 );\n
+  }\n
+);
+
+// vShape: x is the corner radius, y is the blur radius, z is the border size
+// and w is 1 if the visual inherits the color of the batch parent or 0 if it only inherits its alpha
+const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+  varying mediump vec2 vLocalPosition;\n
+  varying mediump vec2 vHalfSize;\n
+  varying lowp vec4 vColor;\n
+  varying mediump vec4 vShape;\n
+  uniform lowp vec4 uColor;\n
+  \n
+  void main()\n
+  {\n
+    mediump vec2 edge = abs( vLocalPosition ) - vHalfSize;\n
+    mediump float blurRadius = max( vShape.y, 0.001 );\n
+    mediump vec2 blur = 1.0 - smoothstep( -blurRadius, blurRadius, edge );\n
+    mediump vec2 corner = edge + vShape.x;\n
+    mediump float dist = length( max( corner, 0.0 ) ) - vShape.x;\n
+    lowp float alpha = blur.x * blur.y * mix( 1.0, 1.0 - smoothstep( -1.0, 1.0, dist ), step( 0.001, vShape.x ) );\n
+    alpha *= 1.0 - step( 0.001, vShape.z ) * step( max( edge.x, edge.y ), -vShape.z );\n
+    gl_FragColor = vColor * vec4( mix( vec3( 1.0 ), uColor.rgb, vShape.w ), uColor.a );\n
+    gl_FragColor.a *= alpha;\n
+  }\n
+);
+
+struct BatchVertex
+{
+  Vector2 position;      ///< The position in the batch parent
+  Vector2 localPosition; ///< The position relative to the centre of the visual
+  Vector2 halfSize;      ///< The half size of the visual, without the blurred edges
+  Vector4 color;
+  Vector4 shape;         ///< The corner radius, the blur radius, the border size and whether the color of the batch parent is inherited
+};
+
+struct BatchQuad
+{
+  VisualBatchQuad quad;
+  Vector2         position;    ///< The position of the actor in the batch parent
+  Vector4         color;       ///< The color inherited from the actors between the member and the batch parent
+  bool            inheritsRgb; ///< Whether the color of the batch parent is inherited, rather than its alpha only
+};
+
+/**
+ * @brief Where the quad of a member is drawn.
+ */
+enum class Placement
+{
+  BATCHED,    ///< The batch parent draws the quad
+  HIDDEN,     ///< The actor or any of its parents under the batch parent is hidden
+  UNBATCHABLE ///< The batch parent cannot draw the quad as the member would, so the member draws itself
+};
+
+/**
+ * @brief Accumulates the position and the color of the actor relative to the batch parent.
+ *
+ * @param[in] parent The batch parent
+ * @param[in] actor The actor of the member
+ * @param[in] current Whether to use the current values of the position, color, scale, orientation and visibility, which reflect
+ *                    the animations, rather than the event side values, which the actors put on the scene in this frame have not
+ *                    been updated with yet
+ * @param[out] quad The position and the color of the quad
+ * @return Where the quad is drawn
+ */
+Placement GetPlacementInParent( Actor parent, Actor actor, bool current, BatchQuad& quad )
+{
+  const Vector2 half( 0.5f, 0.5f );
+
+  quad.position = Vector2::ZERO;
+  quad.color = Color::WHITE;
+  quad.inheritsRgb = true;
+
+  Placement placement = Placement::BATCHED;
+  while( actor && actor != parent )
+  {
+    const bool visible = current ? actor.GetCurrentProperty< bool >( Actor::Property::VISIBLE ) : actor.GetProperty< bool >( Actor::Property::VISIBLE );
+    if( !visible )
+    {
+      return Placement::HIDDEN;
+    }
+
+    Actor actorParent = actor.GetParent();
+    if( !actorParent )
+    {
+      return Placement::HIDDEN;
+    }
+
+    // The batch renderers are drawn untransformed, unclipped and with the color of the batch parent
+    const Vector3 scale = current ? actor.GetCurrentProperty< Vector3 >( Actor::Property::SCALE ) : actor.GetProperty< Vector3 >( Actor::Property::SCALE );
+    const Quaternion orientation = current ? actor.GetCurrentProperty< Quaternion >( Actor::Property::ORIENTATION ) : actor.GetProperty< Quaternion >( Actor::Property::ORIENTATION );
+    const ColorMode colorMode = static_cast< ColorMode >( actor.GetProperty< int >( Actor::Property::COLOR_MODE ) );
+    if( !Equals( scale.x, 1.0f ) || !Equals( scale.y, 1.0f ) ||
+        orientation != Quaternion::IDENTITY ||
+        actor.GetProperty< int >( Actor::Property::CLIPPING_MODE ) != ClippingMode::DISABLED ||
+        actor.GetProperty< int >( Actor::Property::DRAW_MODE ) != DrawMode::NORMAL ||
+        ( colorMode != USE_OWN_MULTIPLY_PARENT_ALPHA && colorMode != USE_OWN_MULTIPLY_PARENT_COLOR ) ||
+        Layer::DownCast( actor ) )
+    {
+      // Keep looking for a hidden parent, as a hidden member draws nothing either way
+      placement = Placement::UNBATCHABLE;
+    }
+
+    const Vector2 size( actor.GetProperty< Vector3 >( Actor::Property::SIZE ) );
+    const Vector2 parentSize( actorParent.GetProperty< Vector3 >( Actor::Property::SIZE ) );
+    const Vector2 parentOrigin( actor.GetProperty< Vector3 >( Actor::Property::PARENT_ORIGIN ) );
+    const Vector2 anchorPoint( actor.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT ) );
+    const Vector2 actorPosition( current ? actor.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ) : actor.GetProperty< Vector3 >( Actor::Property::POSITION ) );
+
+    quad.position += actorPosition + ( ( parentOrigin - half ) * parentSize ) + ( ( half - anchorPoint ) * size );
+
+    // The color of an actor only multiplies the RGB of its descendants while they multiply the color of their parents
+    const Vector4 color = current ? actor.GetCurrentProperty< Vector4 >( Actor::Property::COLOR ) : actor.GetProperty< Vector4 >( Actor::Property::COLOR );
+    if( quad.inheritsRgb )
+    {
+      quad.color *= color;
+    }
+    else
+    {
+      quad.color.a *= color.a;
+    }
+    quad.inheritsRgb = quad.inheritsRgb && ( colorMode == USE_OWN_MULTIPLY_PARENT_COLOR );
+
+    actor = actorParent;
+  }
+
+  return ( actor == parent ) ? placement : Placement::HIDDEN;
+}
+
+/**
+ * @brief Hashes what decides the draw order under the batch parent: the actors, their visibility and the depth indices of their renderers.
+ *
+ * @param[in] parent The batch parent
+ * @return The hash
+ */
+std::size_t GetDrawOrderHash( Actor parent )
+{
+  std::size_t hash = 0u;
+  std::vector< Actor > actors( 1u, parent );
+  while( !actors.empty() )
+  {
+    Actor actor = actors.back();
+    actors.pop_back();
+
+    const bool visible = actor.GetProperty< bool >( Actor::Property::VISIBLE );
+    hash = hash * 31u + static_cast< std::size_t >( actor.GetProperty< int >( Actor::Property::ID ) );
+    hash = hash * 31u + ( visible ? 1u : 0u );
+    if( !visible )
+    {
+      continue;
+    }
+
+    const uint32_t rendererCount = actor.GetRendererCount();
+    hash = hash * 31u + rendererCount;
+    for( uint32_t i = 0u; i < rendererCount; ++i )
+    {
+      hash = hash * 31u + static_cast< std::size_t >( actor.GetRendererAt( i ).GetProperty< int >( Renderer::Property::DEPTH_INDEX ) );
+    }
+
+    for( uint32_t i = actor.GetChildCount(); i > 0u; --i )
+    {
+      actors.push_back( actor.GetChildAt( i - 1u ) );
+    }
+  }
+  return hash;
+}
+
+void AddQuad( const BatchQuad& batchQuad, std::vector< BatchVertex >& vertices )
+{
+  const VisualBatchQuad& quad = batchQuad.quad;
+  const Vector2 halfSize = quad.size * 0.5f;
+  const Vector2 extent = halfSize + Vector2( quad.blurRadius, quad.blurRadius );
+  const Vector2 centre = batchQuad.position + quad.centre;
+  const Vector4 color = quad.color * batchQuad.color;
+  const Vector4 shape( quad.cornerRadius, quad.blurRadius, quad.borderSize, batchQuad.inheritsRgb ? 1.0f : 0.0f );
+
+  const Vector2 corners[] = { Vector2( -extent.x, -extent.y ), Vector2( extent.x, -extent.y ), Vector2( -extent.x, extent.y ), Vector2( extent.x, extent.y ) };
+  for( const Vector2& corner : corners )
+  {
+    vertices.push_back( { centre + corner, corner, halfSize, color, shape } );
+  }
+}
+
+} // unnamed namespace
+
+VisualBatchManager::VisualBatchManager()
+: mBatches(),
+  mMemberBatches(),
+  mShader(),
+  mProcessorRegistered( false )
+{
+}
+
+VisualBatchManager::~VisualBatchManager()
+{
+  if( mProcessorRegistered && Adaptor::IsAvailable() )
+  {
+    Adaptor::Get().UnregisterProcessor( *this );
+  }
+}
+
+void VisualBatchManager::AddBatchParent( Actor actor )
+{
+  for( auto&& batch : mBatches )
+  {
+    if( batch->parent.GetHandle() == actor )
+    {
+      return;
+    }
+  }
+
+  std::unique_ptr< Batch > batch( new Batch() );
+  batch->parent = WeakHandle< Actor >( actor );
+  batch->drawOrderHash = 0u;
+  batch->dirty = false;
+  mBatches.push_back( std::move( batch ) );
+
+  // Process() checks the draw order under the batch parents
+  if( !mProcessorRegistered && Adaptor::IsAvailable() )
+  {
+    Adaptor::Get().RegisterProcessor( *this );
+    mProcessorRegistered = true;
+  }
+}
+
+void VisualBatchManager::RemoveBatchParent( Actor actor )
+{
+  auto iter = std::find_if( mBatches.begin(), mBatches.end(), [&actor]( const std::unique_ptr< Batch >& batch ) { return batch->parent.GetHandle() == actor; } );
+  if( iter != mBatches.end() )
+  {
+    std::unique_ptr< Batch > batch = std::move( *iter );
+    mBatches.erase( iter );
+
+    for( auto&& chunk : batch->chunks )
+    {
+      actor.RemoveRenderer( chunk.renderer );
+    }
+
+    for( auto&& trackedActor : batch->trackedActors )
+    {
+      Actor handle = trackedActor.second.actor.GetHandle();
+      if( handle )
+      {
+        for( auto&& notification : trackedActor.second.notifications )
+        {
+          handle.RemovePropertyNotification( notification );
+        }
+      }
+    }
+
+    for( auto&& member : batch->members )
+    {
+      mMemberBatches.erase( member.visual );
+
+      Actor memberActor = member.actor.GetHandle();
+      if( memberActor )
+      {
+        member.visual->OnBatchParentRemoved( memberActor );
+      }
+    }
+  }
+
+  if( mBatches.empty() && mProcessorRegistered && Adaptor::IsAvailable() )
+  {
+    Adaptor::Get().UnregisterProcessor( *this );
+    mProcessorRegistered = false;
+  }
+}
+
+bool VisualBatchManager::AddVisual( VisualBatchMember& visual, Actor actor )
+{
+  if( mBatches.empty() )
+  {
+    return false;
+  }
+
+  Batch* batch = FindBatch( actor );
+  if( !batch )
+  {
+    return false;
+  }
+
+  RemoveVisual( visual );
+
+  batch->members.push_back( { &visual, WeakHandle< Actor >( actor ), std::vector< uint32_t >(), false } );
+  TrackActors( *batch, batch->members.back() );
+  mMemberBatches[ &visual ] = batch;
+  MarkDirty( *batch );
+  return true;
+}
+
+void VisualBatchManager::RemoveVisual( VisualBatchMember& visual )
+{
+  auto iter = mMemberBatches.find( &visual );
+  if( iter != mMemberBatches.end() )
+  {
+    Batch& batch = *iter->second;
+    mMemberBatches.erase( iter );
+
+    // Keep the order of the other members, as they are drawn in that order
+    auto memberIter = std::find_if( batch.members.begin(), batch.members.end(), [&visual]( const Member& member ) { return member.visual == &visual; } );
+    UntrackActors( batch, *memberIter );
+    batch.members.erase( memberIter );
+    MarkDirty( batch );
+  }
+}
+
+void VisualBatchManager::MarkDirty( VisualBatchMember& visual )
+{
+  auto iter = mMemberBatches.find( &visual );
+  if( iter != mMemberBatches.end() )
+  {
+    MarkDirty( *iter->second );
+  }
+}
+
+void VisualBatchManager::ExcludeVisual( VisualBatchMember& visual )
+{
+  auto iter = mMemberBatches.find( &visual );
+  if( iter != mMemberBatches.end() )
+  {
+    const Batch& batch = *iter->second;
+    auto memberIter = std::find_if( batch.members.begin(), batch.members.end(), [&visual]( const Member& member ) { return member.visual == &visual; } );
+    Actor actor = memberIter->actor.GetHandle();
+
+    RemoveVisual( visual );
+
+    if( actor )
+    {
+      visual.OnBatchParentRemoved( actor );
+    }
+  }
+}
+
+void VisualBatchManager::Process()
+{
+  for( auto&& batch : mBatches )
+  {
+    // A renderer added, a sibling raised or an actor shown under the batch parent may change which members can be batched
+    Actor parent = batch->parent.GetHandle();
+    if( batch->dirty || ( parent && GetDrawOrderHash( parent ) != batch->drawOrderHash ) )
+    {
+      UpdateBatch( *batch );
+    }
+  }
+
+  if( mBatches.empty() )
+  {
+    Adaptor::Get().UnregisterProcessor( *this );
+    mProcessorRegistered = false;
+  }
+}
+
+VisualBatchManager::Batch* VisualBatchManager::FindBatch( Actor actor )
+{
+  for( ; actor; actor = actor.GetParent() )
+  {
+    for( auto&& batch : mBatches )
+    {
+      if( batch->parent.GetHandle() == actor )
+      {
+        return batch.get();
+      }
+    }
+  }
+  return nullptr;
+}
+
+void VisualBatchManager::MarkDirty( Batch& batch )
+{
+  batch.dirty = true;
+
+  if( !mProcessorRegistered && Adaptor::IsAvailable() )
+  {
+    Adaptor::Get().RegisterProcessor( *this );
+    mProcessorRegistered = true;
+  }
+}
+
+void VisualBatchManager::TrackActors( Batch& batch, Member& member )
+{
+  Actor parent = batch.parent.GetHandle();
+  for( Actor actor = member.actor.GetHandle(); actor && actor != parent; actor = actor.GetParent() )
+  {
+    const uint32_t id = static_cast< uint32_t >( actor.GetProperty< int >( Actor::Property::ID ) );
+    member.trackedActorIds.push_back( id );
+
+    auto iter = batch.trackedActors.find( id );
+    if( iter != batch.trackedActors.end() )
+    {
+      ++iter->second.referenceCount;
+      continue;
+    }
+
+    // The conditions start from the event side values, which the first layout of the member uses
+    TrackedActor& trackedActor = batch.trackedActors[ id ];
+    trackedActor.actor = WeakHandle< Actor >( actor );
+    trackedActor.referenceCount = 1u;
+
+    const Vector3 position = actor.GetProperty< Vector3 >( Actor::Property::POSITION );
+    trackedActor.notifications.push_back( actor.AddPropertyNotification( Actor::Property::POSITION, 0, StepCondition( POSITION_STEP, position.x ) ) );
+    trackedActor.notifications.push_back( actor.AddPropertyNotification( Actor::Property::POSITION, 1, StepCondition( POSITION_STEP, position.y ) ) );
+
+    const Vector4 color = actor.GetProperty< Vector4 >( Actor::Property::COLOR );
+    for( int component = 0; component < 4; ++component )
+    {
+      trackedActor.notifications.push_back( actor.AddPropertyNotification( Actor::Property::COLOR, component, StepCondition( COLOR_STEP, color[ component ] ) ) );
+    }
+
+    // A scaled actor takes its members out of the batch, e.g. a pressed button
+    const Vector3 scale = actor.GetProperty< Vector3 >( Actor::Property::SCALE );
+    trackedActor.notifications.push_back( actor.AddPropertyNotification( Actor::Property::SCALE, 0, StepCondition( SCALE_STEP, scale.x ) ) );
+    trackedActor.notifications.push_back( actor.AddPropertyNotification( Actor::Property::SCALE, 1, StepCondition( SCALE_STEP, scale.y ) ) );
+
+    PropertyNotification visibleNotification = actor.AddPropertyNotification( Actor::Property::VISIBLE, LessThanCondition( 0.5f ) );
+    visibleNotification.SetNotifyMode( PropertyNotification::NOTIFY_ON_CHANGED );
+    trackedActor.notifications.push_back( visibleNotification );
+
+    for( auto&& notification : trackedActor.notifications )
+    {
+      notification.NotifySignal().Connect( this, &VisualBatchManager::OnTrackedActorChanged );
+    }
+  }
+}
+
+void VisualBatchManager::UntrackActors( Batch& batch, const Member& member )
+{
+  for( uint32_t id : member.trackedActorIds )
+  {
+    auto iter = batch.trackedActors.find( id );
+    if( iter != batch.trackedActors.end() && --iter->second.referenceCount == 0u )
+    {
+      Actor actor = iter->second.actor.GetHandle();
+      if( actor )
+      {
+        for( auto&& notification : iter->second.notifications )
+        {
+          actor.RemovePropertyNotification( notification );
+        }
+      }
+      batch.trackedActors.erase( iter );
+    }
+  }
+}
+
+void VisualBatchManager::OnTrackedActorChanged( PropertyNotification& source )
+{
+  Actor actor = Actor::DownCast( source.GetTarget() );
+  if( actor )
+  {
+    const uint32_t id = static_cast< uint32_t >( actor.GetProperty< int >( Actor::Property::ID ) );
+    for( auto&& batch : mBatches )
+    {
+      if( batch->trackedActors.find( id ) != batch->trackedActors.end() )
+      {
+        MarkDirty( *batch );
+        break;
+      }
+    }
+  }
+}
+
+void VisualBatchManager::UpdateBatch( Batch& batch )
+{
+  batch.dirty = false;
+
+  Actor parent = batch.parent.GetHandle();
+  if( !parent )
+  {
+    return;
+  }
+
+  // A renderer or the quad of a member on an actor
+  struct DrawItem
+  {
+    int       depthIndex;
+    Member*   member;    ///< The member, or nullptr for a renderer which is not batched
+    BatchQuad batchQuad;
+    bool      batchable;
+  };
+
+  std::unordered_map< uint32_t, std::vector< Member* > > actorMembers;
+  for( auto&& member : batch.members )
+  {
+    Actor actor = member.actor.GetHandle();
+    if( actor )
+    {
+      actorMembers[ static_cast< uint32_t >( actor.GetProperty< int >( Actor::Property::ID ) ) ].push_back( &member );
+    }
+  }
+
+  // The batch renderers are drawn with the batch parent, before its descendants and with its renderers sorted by depth index,
+  // so a member is batched only while no renderer which is not batched is drawn between the batch parent and the member.
+  // The renderers of the batch parent drawn before the first batched quad are the exception, as the batch renderers follow them.
+  std::vector< BatchQuad > quads;
+  std::vector< VisualBatchMember* > unbatchableVisuals;
+  bool started = false;
+  bool closed = false;
+  int lastParentDepthIndex = std::numeric_limits< int >::min();
+  int batchDepthIndex = 0;
+
+  std::vector< DrawItem > items;
+  std::vector< Actor > actors( 1u, parent );
+  while( !actors.empty() )
+  {
+    Actor actor = actors.back();
+    actors.pop_back();
+
+    // A hidden actor draws nothing, nor do its children
+    if( actor != parent && !actor.GetProperty< bool >( Actor::Property::VISIBLE ) )
+    {
+      continue;
+    }
+
+    items.clear();
+    const uint32_t rendererCount = actor.GetRendererCount();
+    for( uint32_t i = 0u; i < rendererCount; ++i )
+    {
+      Renderer renderer = actor.GetRendererAt( i );
+      if( actor != parent || std::none_of( batch.chunks.begin(), batch.chunks.end(), [&renderer]( const Chunk& chunk ) { return chunk.renderer == renderer; } ) )
+      {
+        items.push_back( { renderer.GetProperty< int >( Renderer::Property::DEPTH_INDEX ), nullptr, BatchQuad(), false } );
+      }
+    }
+
+    auto membersIter = actorMembers.find( static_cast< uint32_t >( actor.GetProperty< int >( Actor::Property::ID ) ) );
+    if( membersIter != actorMembers.end() )
+    {
+      const Vector2 actorSize( actor.GetProperty< Vector3 >( Actor::Property::SIZE ) );
+      for( Member* member : membersIter->second )
+      {
+        // The actors put on the scene in this frame have not been updated yet, so their first layout uses the event side values
+        const bool current = member->laidOut;
+        member->laidOut = true;
+
+        DrawItem item{ 0, member, BatchQuad(), false };
+        const Placement placement = GetPlacementInParent( parent, actor, current, item.batchQuad );
+        if( placement != Placement::HIDDEN && member->visual->GetBatchQuad( actorSize, item.batchQuad.quad ) )
+        {
+          item.depthIndex = item.batchQuad.quad.depthIndex;
+          item.batchable = ( placement == Placement::BATCHED );
+          items.push_back( item );
+        }
+      }
+    }
+
+    // The renderers of an actor are drawn by depth index, the order of equal ones is unknown so the renderers come first
+    std::stable_sort( items.begin(), items.end(), []( const DrawItem& lhs, const DrawItem& rhs )
+    {
+      return ( lhs.depthIndex < rhs.depthIndex ) || ( lhs.depthIndex == rhs.depthIndex && !lhs.member && rhs.member );
+    } );
+
+    for( auto&& item : items )
+    {
+      if( item.batchable && !closed && ( started || actor != parent || item.depthIndex > lastParentDepthIndex ) )
+      {
+        if( !started )
+        {
+          started = true;
+          batchDepthIndex = std::max( item.depthIndex, lastParentDepthIndex + 1 );
+        }
+        quads.push_back( item.batchQuad );
+        continue;
+      }
+
+      // A member which cannot be batched draws itself at its own place
+      if( item.member )
+      {
+        unbatchableVisuals.push_back( item.member->visual );
+      }
+
+      if( actor == parent && !started )
+      {
+        lastParentDepthIndex = item.depthIndex;
+      }
+      else
+      {
+        closed = true;
+      }
+    }
+
+    for( uint32_t i = actor.GetChildCount(); i > 0u; --i )
+    {
+      actors.push_back( actor.GetChildAt( i - 1u ) );
+    }
+  }
+
+  for( VisualBatchMember* visual : unbatchableVisuals )
+  {
+    auto memberIter = std::find_if( batch.members.begin(), batch.members.end(), [visual]( const Member& member ) { return member.visual == visual; } );
+    Actor actor = memberIter->actor.GetHandle();
+
+    UntrackActors( batch, *memberIter );
+    batch.members.erase( memberIter );
+    mMemberBatches.erase( visual );
+
+    visual->OnBatchParentRemoved( actor );
+  }
+
+  std::vector< BatchVertex > vertices;
+  std::vector< unsigned short > indices;
+  size_t chunkCount = 0u;
+
+  for( auto iter = quads.begin(); iter != quads.end(); )
+  {
+    vertices.clear();
+    indices.clear();
+    for( ; iter != quads.end() && vertices.size() < MAX_QUADS_PER_RENDERER * 4u; ++iter )
+    {
+      const unsigned short first = static_cast< unsigned short >( vertices.size() );
+      AddQuad( *iter, vertices );
+
+      const unsigned short quadIndices[] = { first, static_cast< unsigned short >( first + 1u ), static_cast< unsigned short >( first + 2u ),
+                                             static_cast< unsigned short >( first + 2u ), static_cast< unsigned short >( first + 1u ), static_cast< unsigned short >( first + 3u ) };
+      indices.insert( indices.end(), std::begin( quadIndices ), std::end( quadIndices ) );
+    }
+
+    // Reuse the renderers of the previous update
+    if( chunkCount == batch.chunks.size() )
+    {
+      Property::Map vertexFormat;
+      vertexFormat[ "aPosition" ] = Property::VECTOR2;
+      vertexFormat[ "aLocalPosition" ] = Property::VECTOR2;
+      vertexFormat[ "aHalfSize" ] = Property::VECTOR2;
+      vertexFormat[ "aColor" ] = Property::VECTOR4;
+      vertexFormat[ "aShape" ] = Property::VECTOR4;
+
+      Chunk chunk;
+      chunk.vertexBuffer = VertexBuffer::New( vertexFormat );
+
+      Geometry geometry = Geometry::New();
+      geometry.AddVertexBuffer( chunk.vertexBuffer );
+
+      chunk.renderer = Renderer::New( geometry, GetShader() );
+      chunk.renderer.SetProperty( Renderer::Property::BLEND_MODE, BlendMode::ON );
+      parent.AddRenderer( chunk.renderer );
+
+      batch.chunks.push_back( chunk );
+    }
+
+    Chunk& chunk = batch.chunks[ chunkCount++ ];
+    chunk.vertexBuffer.SetData( &vertices[0], vertices.size() );
+    chunk.renderer.GetGeometry().SetIndexBuffer( &indices[0], indices.size() );
+    // The renderers of an actor with the same depth index are drawn in the order they were added
+    chunk.renderer.SetProperty( Renderer::Property::DEPTH_INDEX, batchDepthIndex );
+  }
+
+  for( size_t i = chunkCount; i < batch.chunks.size(); ++i )
+  {
+    parent.RemoveRenderer( batch.chunks[i].renderer );
+  }
+  batch.chunks.resize( chunkCount );
+
+  batch.drawOrderHash = GetDrawOrderHash( parent );
+}
+
+Shader VisualBatchManager::GetShader()
+{
+  if( !mShader )
+  {
+    mShader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+  }
+  return mShader;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,297 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_BATCH_MANAGER_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_BATCH_MANAGER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/property-notification.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/shader.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <dali/integration-api/processor-interface.h>
+#include <memory>
+#include <unordered_map>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The quad a batched visual is drawn with.
+ */
+struct VisualBatchQuad
+{
+  Vector2 centre;       ///< The centre of the visual, relative to the centre of its actor
+  Vector2 size;         ///< The size of the visual
+  Vector4 color;        ///< The color of the visual, the opacity included
+  float   cornerRadius; ///< The corner radius in pixels
+  float   blurRadius;   ///< The blur radius of the edges in pixels
+  float   borderSize;   ///< The size of the border in pixels, or zero to fill the quad
+  int     depthIndex;   ///< The depth index of the visual
+};
+
+/**
+ * @brief Interface of the visuals which can be drawn by the renderers of a batch parent.
+ */
+class VisualBatchMember
+{
+public:
+
+  /**
+   * @brief Retrieves the quad the visual is drawn with.
+   *
+   * @param[in] actorSize The size of the actor the visual is on
+   * @param[out] quad The quad of the visual
+   * @return false if the visual draws nothing
+   */
+  virtual bool GetBatchQuad( const Vector2& actorSize, VisualBatchQuad& quad ) const = 0;
+
+  /**
+   * @brief Called when the batch parent is removed while the visual is still on the scene.
+   *
+   * The visual should add its own renderer to the actor again.
+   * @param[in] actor The actor the visual is on
+   */
+  virtual void OnBatchParentRemoved( Actor& actor ) = 0;
+
+protected:
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~VisualBatchMember() = default;
+};
+
+/**
+ * @brief Draws the simple visuals of the descendants of a batch parent with a few renderers on the batch parent.
+ *
+ * A control becomes a batch parent with DevelControl::Property::BATCH_PARENT. A color or border visual put on the
+ * scene under a batch parent does not add its renderer to its actor, but registers itself here instead.
+ * The quads of the members are written to vertex buffers in the draw order of their actors, with the color, the corner
+ * radius, the blur radius and the border size per vertex, so they are drawn with the same shader.
+ * The vertex buffers are rebuilt in Process() when a member has been added, removed or changed, or when the actors,
+ * the visibility or the renderers under the batch parent have changed. The latter is checked in every Process(),
+ * so the manager stays registered as a processor while there are batch parents.
+ *
+ * A member is only batched when this draws the same result as its own renderer would:
+ * - No renderer which is not batched is drawn between the batch parent and the member, e.g. the content of the batch
+ *   parent or of an earlier sibling, as the quads are drawn by the batch parent before its descendants.
+ * - The actors between the member and the batch parent, the actor of the member included, are not scaled, rotated
+ *   or clipping, are not layers, and inherit the color of their parents or its alpha.
+ * Otherwise the member is taken out of the batch and draws itself until it is put on the scene again.
+ *
+ * The position, color, scale and visibility of the actors between a member and its batch parent, the actor of the
+ * member included, are watched with property notifications, so moving, recoloring, hiding or animating them rebuilds
+ * the batch with their current values, one frame later. The orientation cannot be watched, so rotating an actor is
+ * only reflected when the batch is rebuilt. A member whose visual properties are animated is taken out of the batch
+ * and draws itself until it is put on the scene again.
+ */
+class VisualBatchManager : public Integration::Processor, public ConnectionTracker
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  VisualBatchManager();
+
+  /**
+   * @brief Destructor.
+   */
+  ~VisualBatchManager() override;
+
+  /**
+   * @brief Makes the actor a batch parent.
+   *
+   * The visuals put on the scene under the actor from now on are batched.
+   * @param[in] actor The batch parent
+   */
+  void AddBatchParent( Actor actor );
+
+  /**
+   * @brief Removes a batch parent.
+   *
+   * The members which are still on the scene add their own renderers again.
+   * @param[in] actor The batch parent
+   */
+  void RemoveBatchParent( Actor actor );
+
+  /**
+   * @brief Adds a visual to the batch of the nearest batch parent of the actor, the actor itself included.
+   *
+   * @param[in] visual The visual
+   * @param[in] actor The actor the visual is on
+   * @return true if the visual is batched, false if there is no batch parent and the visual should add its own renderer
+   */
+  bool AddVisual( VisualBatchMember& visual, Actor actor );
+
+  /**
+   * @brief Removes a visual from its batch, if any.
+   *
+   * @param[in] visual The visual
+   */
+  void RemoveVisual( VisualBatchMember& visual );
+
+  /**
+   * @brief Requests the batch of the visual, if any, to be rebuilt.
+   *
+   * @param[in] visual The visual which has changed
+   */
+  void MarkDirty( VisualBatchMember& visual );
+
+  /**
+   * @brief Removes a visual from its batch, if any, and makes it add its own renderer to its actor.
+   *
+   * Used when the visual is animated, as the renderers of the batch parent cannot reflect its animations.
+   * @param[in] visual The visual
+   */
+  void ExcludeVisual( VisualBatchMember& visual );
+
+protected: // Implementation of Processor
+
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process() override;
+
+private:
+
+  // Undefined
+  VisualBatchManager( const VisualBatchManager& manager ) = delete;
+
+  // Undefined
+  VisualBatchManager& operator=( const VisualBatchManager& manager ) = delete;
+
+private:
+
+  /**
+   * @brief A visual drawn by a batch.
+   */
+  struct Member
+  {
+    VisualBatchMember*      visual;
+    WeakHandle< Actor >     actor;
+    std::vector< uint32_t > trackedActorIds; ///< The actors between the visual and the batch parent, the actor of the visual first
+    bool                    laidOut;         ///< Whether the quad has been laid out once, with the event side properties
+  };
+
+  /**
+   * @brief An actor whose position, color, scale and visibility are watched for the members under it.
+   */
+  struct TrackedActor
+  {
+    WeakHandle< Actor >                 actor;
+    std::vector< PropertyNotification > notifications;
+    uint32_t                            referenceCount; ///< The number of members under the actor
+  };
+
+  /**
+   * @brief A renderer drawing as many quads as its indices can address.
+   */
+  struct Chunk
+  {
+    Renderer     renderer;
+    VertexBuffer vertexBuffer;
+  };
+
+  /**
+   * @brief The visuals under a batch parent.
+   */
+  struct Batch
+  {
+    WeakHandle< Actor >   parent;
+    std::vector< Member > members;  ///< In the order they were put on the scene
+    std::vector< Chunk >  chunks;
+    std::unordered_map< uint32_t, TrackedActor > trackedActors; ///< By actor ID
+    std::size_t           drawOrderHash; ///< The hash of the actors and the renderers under the batch parent when it was built
+    bool                  dirty;
+  };
+
+  /**
+   * @brief Finds the batch of the nearest batch parent of the actor.
+   * @param[in] actor The actor
+   * @return The batch or nullptr if the actor is not under a batch parent
+   */
+  Batch* FindBatch( Actor actor );
+
+  /**
+   * @brief Requests the batch to be rebuilt in the next Process().
+   * @param[in] batch The batch
+   */
+  void MarkDirty( Batch& batch );
+
+  /**
+   * @brief Watches the actors between the actor of a member and the batch parent.
+   * @param[in] batch The batch of the member
+   * @param[in,out] member The member
+   */
+  void TrackActors( Batch& batch, Member& member );
+
+  /**
+   * @brief Stops watching the actors of a member which are not shared with other members.
+   * @param[in] batch The batch of the member
+   * @param[in] member The member
+   */
+  void UntrackActors( Batch& batch, const Member& member );
+
+  /**
+   * @brief Called when the position, color, scale or visibility of a tracked actor has changed.
+   * @param[in] source The notification of the change
+   */
+  void OnTrackedActorChanged( PropertyNotification& source );
+
+  /**
+   * @brief Writes the quads of the members to the vertex buffers of the batch.
+   *
+   * The members which cannot be batched without changing what is drawn are taken out of the batch.
+   * @param[in] batch The batch
+   */
+  void UpdateBatch( Batch& batch );
+
+  /**
+   * @brief Gets the shader of the batch renderers.
+   * @return The shader
+   */
+  Shader GetShader();
+
+private:
+
+  std::vector< std::unique_ptr< Batch > >                mBatches;
+  std::unordered_map< const VisualBatchMember*, Batch* > mMemberBatches;
+  Shader                                                 mShader;
+  bool                                                   mProcessorRegistered;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_BATCH_MANAGER_H
@@ -23,9 +23,11 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
+#include <dali-toolkit/internal/visuals/gradient/gradient-atlas.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-manager.h>
+#include <dali-toolkit/internal/visuals/visual-batch-manager.h>
 
 namespace Dali
 {
@@ -39,6 +41,8 @@ namespace Internal
 VisualFactoryCache::VisualFactoryCache( bool preMultiplyOnLoad )
 : mSvgRasterizeThread( NULL ),
   mVectorAnimationManager(),
+  mGradientAtlas(),
+  mVisualBatchManager(),
   mBrokenImageUrl(""),
   mPreMultiplyOnLoad( preMultiplyOnLoad )
 {
@@ -74,6 +78,38 @@ void VisualFactoryCache::SaveShader( ShaderType type, Shader shader )
   mShader[type] = shader;
 }
 
+VisualFactoryCache::CachedGeometryPtr VisualFactoryCache::GetCachedGeometry( const std::string& key )
+{
+  auto iter = mCachedGeometries.find( key );
+  if( iter != mCachedGeometries.end() )
+  {
+    return iter->second;
+  }
+  return CachedGeometryPtr();
+}
+
+void VisualFactoryCache::SaveCachedGeometry( const std::string& key, CachedGeometryPtr geometry )
+{
+  geometry->key = key;
+  mCachedGeometries[ key ] = geometry;
+}
+
+void VisualFactoryCache::ReleaseCachedGeometry( CachedGeometryPtr& geometry )
+{
+  if( geometry )
+  {
+    const std::string key = geometry->key;
+    geometry.Reset();
+
+    // Drop the geometry if only the cache still refers to it
+    auto iter = mCachedGeometries.find( key );
+    if( ( iter != mCachedGeometries.end() ) && ( iter->second->ReferenceCount() == 1 ) )
+    {
+      mCachedGeometries.erase( iter );
+    }
+  }
+}
+
 Geometry VisualFactoryCache::CreateQuadGeometry()
 {
   const float halfWidth = 0.5f;
@@ -140,6 +176,24 @@ VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
   return *mVectorAnimationManager;
 }
 
+GradientAtlas& VisualFactoryCache::GetGradientAtlas()
+{
+  if( !mGradientAtlas )
+  {
+    mGradientAtlas = std::unique_ptr< GradientAtlas >( new GradientAtlas() );
+  }
+  return *mGradientAtlas;
+}
+
+VisualBatchManager& VisualFactoryCache::GetVisualBatchManager()
+{
+  if( !mVisualBatchManager )
+  {
+    mVisualBatchManager = std::unique_ptr< VisualBatchManager >( new VisualBatchManager() );
+  }
+  return *mVisualBatchManager;
+}
+
 void VisualFactoryCache::ApplyRasterizedSVGToSampler()
 {
   while( RasterizingTaskPtr task = mSvgRasterizeThread->NextCompletedTask() )
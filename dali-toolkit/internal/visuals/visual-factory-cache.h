@@ -18,6 +18,8 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
+#include <unordered_map>
 #include <dali/public-api/math/uint-16-pair.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/geometry.h>
@@ -38,6 +40,8 @@ namespace Toolkit
 
 namespace Internal
 {
+class GradientAtlas;
+class VisualBatchManager;
 class ImageAtlasManager;
 class NPatchLoader;
 class TextureManager;
@@ -114,6 +118,18 @@ public:
     GEOMETRY_TYPE_MAX = WIREFRAME_GEOMETRY
   };
 
+  /**
+   * Geometry shared between the visuals created with the same parameters.
+   * Visuals derive from it to keep the data computed along with the geometry.
+   */
+  struct CachedGeometry : public RefObject
+  {
+    Geometry geometry;
+    std::string key; ///< The key the geometry is cached with
+  };
+
+  typedef IntrusivePtr< CachedGeometry > CachedGeometryPtr;
+
 public:
 
   /**
@@ -154,6 +170,28 @@ public:
    */
   void SaveShader( ShaderType type, Shader shader );
 
+  /**
+   * Request the geometry cached with the given key.
+   * @param[in] key The key describing the parameters the geometry was created with.
+   * @return The cached geometry if it exists in the cache. Otherwise, an empty pointer is returned.
+   */
+  CachedGeometryPtr GetCachedGeometry( const std::string& key );
+
+  /**
+   * Cache the geometry with the given key.
+   * The geometry stays in the cache until the last visual using it releases it ( see ReleaseCachedGeometry ).
+   * @param[in] key The key describing the parameters the geometry was created with.
+   * @param[in] geometry The geometry for caching.
+   */
+  void SaveCachedGeometry( const std::string& key, CachedGeometryPtr geometry );
+
+  /**
+   * Release the reference of a visual to a cached geometry.
+   * The geometry is dropped from the cache if no other visual uses it, so its buffers are freed.
+   * @param[in,out] geometry The reference of the visual, which is reset.
+   */
+  void ReleaseCachedGeometry( CachedGeometryPtr& geometry );
+
   /*
    * Greate the quad geometry.
    * Quad geometry is shared by multiple kind of Renderer, so implement it in the factory-cache.
@@ -220,6 +258,18 @@ public:
    */
   VectorAnimationManager& GetVectorAnimationManager();
 
+  /**
+   * Get the atlas of the gradient lookup textures.
+   * @return A reference to the gradient atlas.
+   */
+  GradientAtlas& GetGradientAtlas();
+
+  /**
+   * Get the manager of the batched visuals.
+   * @return A reference to the visual batch manager.
+   */
+  VisualBatchManager& GetVisualBatchManager();
+
 private: // for svg rasterization thread
 
   /**
@@ -242,6 +292,7 @@ protected:
 private:
   Geometry mGeometry[GEOMETRY_TYPE_MAX+1];
   Shader mShader[SHADER_TYPE_MAX+1];
+  std::unordered_map< std::string, CachedGeometryPtr > mCachedGeometries;
 
   ImageAtlasManagerPtr                      mAtlasManager;
   TextureManager                            mTextureManager;
@@ -249,6 +300,8 @@ private:
   Texture                                   mBrokenImageTexture;
   SvgRasterizeThread*                       mSvgRasterizeThread;
   std::unique_ptr< VectorAnimationManager > mVectorAnimationManager;
+  std::unique_ptr< GradientAtlas >          mGradientAtlas;
+  std::unique_ptr< VisualBatchManager >     mVisualBatchManager;
   std::string                               mBrokenImageUrl;
   bool                                      mPreMultiplyOnLoad;
 };
@@ -45,6 +45,7 @@
 #include <dali-toolkit/internal/visuals/arc/arc-visual.h>
 #include <dali-toolkit/internal/visuals/wireframe/wireframe-visual.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/visuals/visual-template-impl.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
@@ -110,8 +111,6 @@ void VisualFactory::OnStyleChangedSignal( Toolkit::StyleManager styleManager, St
 
 Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& propertyMap )
 {
-  Visual::BasePtr visualPtr;
-
   Property::Value* typeValue = propertyMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
   Toolkit::DevelVisual::Type visualType = Toolkit::DevelVisual::IMAGE; // Default to IMAGE type.
   if( typeValue )
@@ -119,6 +118,106 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
     Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType );
   }
 
+  VisualUrl visualUrl;
+  const VisualUrl* visualUrlPtr = nullptr;
+  const Property::Array* urlArray = nullptr;
+  switch( visualType )
+  {
+    case Toolkit::Visual::IMAGE:
+    case Toolkit::Visual::N_PATCH:
+    case Toolkit::Visual::SVG:
+    case Toolkit::Visual::ANIMATED_IMAGE:
+    case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
+    {
+      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
+      if( imageURLValue )
+      {
+        std::string imageUrl;
+        if( imageURLValue->Get( imageUrl ) )
+        {
+          visualUrl = VisualUrl( imageUrl );
+          visualUrlPtr = &visualUrl;
+        }
+        else
+        {
+          urlArray = imageURLValue->GetArray();
+        }
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return Toolkit::Visual::Base( DoCreateVisual( visualType, visualUrlPtr, urlArray, propertyMap ).Get() );
+}
+
+Toolkit::VisualTemplate VisualFactory::Compile( const Property::Map& propertyMap )
+{
+  VisualTemplatePtr visualTemplate = VisualTemplate::New( propertyMap );
+  return Toolkit::VisualTemplate( visualTemplate.Get() );
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual( const Toolkit::VisualTemplate& visualTemplate )
+{
+  const VisualTemplate& impl = GetImplementation( visualTemplate );
+  return Toolkit::Visual::Base( DoCreateVisual( impl.GetVisualType(), impl.GetVisualUrl(), impl.GetUrlArray(), impl.GetPropertyMap() ).Get() );
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual( const std::string& url, ImageDimensions size )
+{
+  Visual::BasePtr visualPtr;
+
+  if( !url.empty() )
+  {
+    // first resolve url type to know which visual to create
+    VisualUrl visualUrl( url );
+    switch( visualUrl.GetType() )
+    {
+      case VisualUrl::N_PATCH:
+      {
+        visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl );
+        break;
+      }
+      case VisualUrl::SVG:
+      {
+        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl );
+        break;
+      }
+      case VisualUrl::GIF:
+      case VisualUrl::WEBP:
+      {
+        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl );
+        break;
+      }
+      case VisualUrl::JSON:
+      {
+        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), visualUrl );
+        break;
+      }
+      case VisualUrl::REGULAR_IMAGE:
+      {
+        visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, size );
+        break;
+      }
+    }
+  }
+
+  if( mDebugEnabled )
+  {
+    //Create a WireframeVisual if we have debug enabled
+    visualPtr = WireframeVisual::New( GetFactoryCache(), visualPtr );
+  }
+
+  return Toolkit::Visual::Base( visualPtr.Get() );
+}
+
+Visual::BasePtr VisualFactory::DoCreateVisual( Toolkit::DevelVisual::Type visualType, const VisualUrl* visualUrl, const Property::Array* urlArray, const Property::Map& propertyMap )
+{
+  Visual::BasePtr visualPtr;
+
   switch( visualType )
   {
     case Toolkit::Visual::BORDER:
@@ -141,55 +240,44 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::Visual::IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue )
+      if( visualUrl )
       {
-        if( imageURLValue->Get( imageUrl ) )
+        if( visualUrl->IsValid() )
         {
-          if( !imageUrl.empty() )
+          switch( visualUrl->GetType() )
           {
-            VisualUrl visualUrl( imageUrl );
-
-            switch( visualUrl.GetType() )
+            case VisualUrl::N_PATCH:
             {
-              case VisualUrl::N_PATCH:
-              {
-                visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::SVG:
-              {
-                visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::GIF:
-              case VisualUrl::WEBP:
-              {
-                visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::JSON:
-              {
-                visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), imageUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::REGULAR_IMAGE:
-              {
-                visualPtr = ImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
+              visualPtr = NPatchVisual::New( GetFactoryCache(), *visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::SVG:
+            {
+              visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::GIF:
+            case VisualUrl::WEBP:
+            {
+              visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::JSON:
+            {
+              visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), *visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::REGULAR_IMAGE:
+            {
+              visualPtr = ImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, propertyMap );
+              break;
             }
           }
         }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if( array )
-          {
-            visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
-          }
-        }
+      }
+      else if( urlArray )
+      {
+        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *urlArray, propertyMap );
       }
       break;
     }
@@ -220,44 +308,31 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::Visual::N_PATCH:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( visualUrl )
       {
-        visualPtr = NPatchVisual::New( GetFactoryCache(), imageUrl, propertyMap );
+        visualPtr = NPatchVisual::New( GetFactoryCache(), *visualUrl, propertyMap );
       }
       break;
     }
 
     case Toolkit::Visual::SVG:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( visualUrl )
       {
-        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap );
+        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, propertyMap );
       }
       break;
     }
 
     case Toolkit::Visual::ANIMATED_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue )
+      if( visualUrl )
       {
-        if( imageURLValue->Get( imageUrl ) )
-        {
-          visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap );
-        }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if( array )
-          {
-            visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
-          }
-        }
+        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *visualUrl, propertyMap );
+      }
+      else if( urlArray )
+      {
+        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *urlArray, propertyMap );
       }
       break;
     }
@@ -270,11 +345,9 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( visualUrl )
       {
-        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), imageUrl, propertyMap );
+        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), *visualUrl, propertyMap );
       }
       break;
     }
@@ -292,12 +365,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
                                                                             VISUAL_TYPE_TABLE_COUNT ),
                  ( visualType == Toolkit::DevelVisual::IMAGE ) ? "url:" : "",
                  ( visualType == Toolkit::DevelVisual::IMAGE ) ?
-                             ( ([&] (){
-                                        // Return URL if present in PropertyMap else return "not found message"
-                                        Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-                                        return ( imageURLValue ) ? imageURLValue->Get<std::string>().c_str() : "url not found in PropertyMap";
-                                      })()
-                             )
+                             ( ( visualUrl ) ? visualUrl->GetUrl().c_str() : "url not found in PropertyMap" )
                              : "" );
 
   if( !visualPtr )
@@ -311,55 +379,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
     visualPtr = WireframeVisual::New(GetFactoryCache(), visualPtr, propertyMap );
   }
 
-  return Toolkit::Visual::Base( visualPtr.Get() );
-}
-
-Toolkit::Visual::Base VisualFactory::CreateVisual( const std::string& url, ImageDimensions size )
-{
-  Visual::BasePtr visualPtr;
-
-  if( !url.empty() )
-  {
-    // first resolve url type to know which visual to create
-    VisualUrl visualUrl( url );
-    switch( visualUrl.GetType() )
-    {
-      case VisualUrl::N_PATCH:
-      {
-        visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl );
-        break;
-      }
-      case VisualUrl::SVG:
-      {
-        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl );
-        break;
-      }
-      case VisualUrl::GIF:
-      case VisualUrl::WEBP:
-      {
-        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl );
-        break;
-      }
-      case VisualUrl::JSON:
-      {
-        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), visualUrl );
-        break;
-      }
-      case VisualUrl::REGULAR_IMAGE:
-      {
-        visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, size );
-        break;
-      }
-    }
-  }
-
-  if( mDebugEnabled )
-  {
-    //Create a WireframeVisual if we have debug enabled
-    visualPtr = WireframeVisual::New( GetFactoryCache(), visualPtr );
-  }
-
-  return Toolkit::Visual::Base( visualPtr.Get() );
+  return visualPtr;
 }
 
 void VisualFactory::SetPreMultiplyOnLoad( bool preMultiply )
@@ -376,6 +396,21 @@ bool VisualFactory::GetPreMultiplyOnLoad() const
   return mPreMultiplyOnLoad;
 }
 
+void VisualFactory::SetAtlasPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy )
+{
+  GetFactoryCache().GetAtlasManager()->SetPackingPolicy( policy );
+}
+
+uint32_t VisualFactory::GetAtlasCount() const
+{
+  return mFactoryCache ? mFactoryCache->GetAtlasManager()->GetAtlasCount() : 0u;
+}
+
+float VisualFactory::GetAtlasOccupancyRate() const
+{
+  return mFactoryCache ? mFactoryCache->GetAtlasManager()->GetOccupancyRate() : 0.f;
+}
+
 Internal::TextureManager& VisualFactory::GetTextureManager()
 {
   return GetFactoryCache().GetTextureManager();
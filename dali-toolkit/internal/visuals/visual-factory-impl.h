@@ -23,6 +23,8 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-template.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
 #include <dali-toolkit/devel-api/styling/style-manager-devel.h>
@@ -38,6 +40,7 @@ namespace Internal
 
 class VisualFactoryCache;
 class ImageVisualShaderFactory;
+class VisualUrl;
 
 /**
  * @copydoc Toolkit::VisualFactory
@@ -66,6 +69,16 @@ public:
    */
   Toolkit::Visual::Base CreateVisual( const Property::Map& propertyMap );
 
+  /**
+   * @copydoc Toolkit::VisualFactory::Compile( const Property::Map& )
+   */
+  Toolkit::VisualTemplate Compile( const Property::Map& propertyMap );
+
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const VisualTemplate& )
+   */
+  Toolkit::Visual::Base CreateVisual( const Toolkit::VisualTemplate& visualTemplate );
+
   /**
    * @copydoc Toolkit::VisualFactory::CreateVisual( const std::string&, ImageDimensions )
    */
@@ -81,6 +94,21 @@ public:
    */
   bool GetPreMultiplyOnLoad() const;
 
+  /**
+   * @copydoc Toolkit::VisualFactory::SetAtlasPackingPolicy()
+   */
+  void SetAtlasPackingPolicy( Toolkit::ImageAtlas::PackingPolicy policy );
+
+  /**
+   * @copydoc Toolkit::VisualFactory::GetAtlasCount()
+   */
+  uint32_t GetAtlasCount() const;
+
+  /**
+   * @copydoc Toolkit::VisualFactory::GetAtlasOccupancyRate()
+   */
+  float GetAtlasOccupancyRate() const;
+
   /**
    * @return the reference to texture manager
    */
@@ -94,6 +122,17 @@ protected:
   ~VisualFactory() override;
 
 private:
+  /**
+   * @brief Create the visual of the resolved visual type.
+   *
+   * @param[in] visualType The visual type
+   * @param[in] visualUrl The url of the image visual types, or nullptr if the map has no url string
+   * @param[in] urlArray The urls of the animated image visual types, or nullptr if the map has no url array
+   * @param[in] propertyMap The properties of the visual
+   * @return The visual, or an empty pointer if the properties are not valid
+   */
+  Visual::BasePtr DoCreateVisual( Toolkit::DevelVisual::Type visualType, const VisualUrl* visualUrl, const Property::Array* urlArray, const Property::Map& propertyMap );
+
   /**
    * Get the factory cache, creating it if necessary.
    */
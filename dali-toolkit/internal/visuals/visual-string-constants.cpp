@@ -113,6 +113,8 @@ const char * const CURRENT_FRAME_NUMBER_NAME( "currentFrameNumber" );
 const char * const TOTAL_FRAME_NUMBER_NAME( "totalFrameNumber" );
 const char * const STOP_BEHAVIOR_NAME( "stopBehavior" );
 const char * const LOOPING_MODE_NAME( "loopingMode" );
+const char * const SHARED_RASTERIZATION_NAME( "sharedRasterization" );
+const char * const SKIPPED_FRAME_COUNT_NAME( "skippedFrameCount" );
 const char * const IMAGE_ATLASING( "atlasing" );
 const char * const SYNCHRONOUS_LOADING( "synchronousLoading" );
 const char * const IMAGE_FITTING_MODE( "fittingMode" );
@@ -97,6 +97,8 @@ extern const char * const CURRENT_FRAME_NUMBER_NAME;
 extern const char * const TOTAL_FRAME_NUMBER_NAME;
 extern const char * const STOP_BEHAVIOR_NAME;
 extern const char * const LOOPING_MODE_NAME;
+extern const char * const SHARED_RASTERIZATION_NAME;
+extern const char * const SKIPPED_FRAME_COUNT_NAME;
 extern const char * const IMAGE_ATLASING;
 extern const char * const SYNCHRONOUS_LOADING;
 extern const char * const IMAGE_FITTING_MODE;
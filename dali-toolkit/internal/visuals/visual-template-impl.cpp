@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-template-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/scripting/scripting.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visuals/color-visual-properties-devel.h>
+#include <dali-toolkit/public-api/visuals/border-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/color-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/gradient-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+
+namespace
+{
+
+/**
+ * The name and the index of a property
+ */
+struct PropertyName
+{
+  const char* name;
+  Property::Index index;
+};
+
+// The properties read by Visual::Base::SetProperties()
+const PropertyName VISUAL_PROPERTY_NAMES[] =
+{
+  { VISUAL_TYPE,          Toolkit::Visual::Property::TYPE },
+  { CUSTOM_SHADER,        Toolkit::Visual::Property::SHADER },
+  { TRANSFORM,            Toolkit::Visual::Property::TRANSFORM },
+  { PREMULTIPLIED_ALPHA,  Toolkit::Visual::Property::PREMULTIPLIED_ALPHA },
+  { MIX_COLOR,            Toolkit::Visual::Property::MIX_COLOR },
+  { OPACITY,              Toolkit::Visual::Property::OPACITY },
+  { VISUAL_FITTING_MODE,  Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE },
+  { CORNER_RADIUS,        Toolkit::DevelVisual::Property::CORNER_RADIUS },
+  { CORNER_RADIUS_POLICY, Toolkit::DevelVisual::Property::CORNER_RADIUS_POLICY }
+};
+const unsigned int VISUAL_PROPERTY_NAMES_COUNT = sizeof( VISUAL_PROPERTY_NAMES ) / sizeof( VISUAL_PROPERTY_NAMES[0] );
+
+// The color visual reads the mix color itself, after the base class
+const PropertyName COLOR_VISUAL_PROPERTY_NAMES[] =
+{
+  { MIX_COLOR,                  Toolkit::ColorVisual::Property::MIX_COLOR },
+  { RENDER_IF_TRANSPARENT_NAME, Toolkit::DevelColorVisual::Property::RENDER_IF_TRANSPARENT },
+  { BLUR_RADIUS_NAME,           Toolkit::DevelColorVisual::Property::BLUR_RADIUS }
+};
+const unsigned int COLOR_VISUAL_PROPERTY_NAMES_COUNT = sizeof( COLOR_VISUAL_PROPERTY_NAMES ) / sizeof( COLOR_VISUAL_PROPERTY_NAMES[0] );
+
+const PropertyName BORDER_VISUAL_PROPERTY_NAMES[] =
+{
+  { COLOR_NAME,    Toolkit::BorderVisual::Property::COLOR },
+  { SIZE_NAME,     Toolkit::BorderVisual::Property::SIZE },
+  { ANTI_ALIASING, Toolkit::BorderVisual::Property::ANTI_ALIASING }
+};
+const unsigned int BORDER_VISUAL_PROPERTY_NAMES_COUNT = sizeof( BORDER_VISUAL_PROPERTY_NAMES ) / sizeof( BORDER_VISUAL_PROPERTY_NAMES[0] );
+
+const PropertyName GRADIENT_VISUAL_PROPERTY_NAMES[] =
+{
+  { START_POSITION_NAME, Toolkit::GradientVisual::Property::START_POSITION },
+  { END_POSITION_NAME,   Toolkit::GradientVisual::Property::END_POSITION },
+  { CENTER_NAME,         Toolkit::GradientVisual::Property::CENTER },
+  { RADIUS_NAME,         Toolkit::GradientVisual::Property::RADIUS },
+  { STOP_OFFSET_NAME,    Toolkit::GradientVisual::Property::STOP_OFFSET },
+  { STOP_COLOR_NAME,     Toolkit::GradientVisual::Property::STOP_COLOR },
+  { UNITS_NAME,          Toolkit::GradientVisual::Property::UNITS },
+  { SPREAD_METHOD_NAME,  Toolkit::GradientVisual::Property::SPREAD_METHOD }
+};
+const unsigned int GRADIENT_VISUAL_PROPERTY_NAMES_COUNT = sizeof( GRADIENT_VISUAL_PROPERTY_NAMES ) / sizeof( GRADIENT_VISUAL_PROPERTY_NAMES[0] );
+
+// The properties read by ImageVisual::DoSetProperties(), only used for the urls of regular images
+const PropertyName IMAGE_VISUAL_PROPERTY_NAMES[] =
+{
+  { IMAGE_URL_NAME,              Toolkit::ImageVisual::Property::URL },
+  { IMAGE_FITTING_MODE,          Toolkit::ImageVisual::Property::FITTING_MODE },
+  { IMAGE_SAMPLING_MODE,         Toolkit::ImageVisual::Property::SAMPLING_MODE },
+  { IMAGE_DESIRED_WIDTH,         Toolkit::ImageVisual::Property::DESIRED_WIDTH },
+  { IMAGE_DESIRED_HEIGHT,        Toolkit::ImageVisual::Property::DESIRED_HEIGHT },
+  { PIXEL_AREA_UNIFORM_NAME,     Toolkit::ImageVisual::Property::PIXEL_AREA },
+  { IMAGE_WRAP_MODE_U,           Toolkit::ImageVisual::Property::WRAP_MODE_U },
+  { IMAGE_WRAP_MODE_V,           Toolkit::ImageVisual::Property::WRAP_MODE_V },
+  { SYNCHRONOUS_LOADING,         Toolkit::ImageVisual::Property::SYNCHRONOUS_LOADING },
+  { IMAGE_ATLASING,              Toolkit::ImageVisual::Property::ATLASING },
+  { ALPHA_MASK_URL,              Toolkit::ImageVisual::Property::ALPHA_MASK_URL },
+  { MASK_CONTENT_SCALE_NAME,     Toolkit::ImageVisual::Property::MASK_CONTENT_SCALE },
+  { CROP_TO_MASK_NAME,           Toolkit::ImageVisual::Property::CROP_TO_MASK },
+  { LOAD_POLICY_NAME,            Toolkit::ImageVisual::Property::LOAD_POLICY },
+  { RELEASE_POLICY_NAME,         Toolkit::ImageVisual::Property::RELEASE_POLICY },
+  { ORIENTATION_CORRECTION_NAME, Toolkit::ImageVisual::Property::ORIENTATION_CORRECTION }
+};
+const unsigned int IMAGE_VISUAL_PROPERTY_NAMES_COUNT = sizeof( IMAGE_VISUAL_PROPERTY_NAMES ) / sizeof( IMAGE_VISUAL_PROPERTY_NAMES[0] );
+
+bool FindPropertyIndex( const PropertyName* table, unsigned int count, const std::string& name, Property::Index& index )
+{
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    if( name == table[i].name )
+    {
+      index = table[i].index;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+VisualTemplatePtr VisualTemplate::New( const Property::Map& propertyMap )
+{
+  VisualTemplatePtr visualTemplate = new VisualTemplate();
+  visualTemplate->Initialize( propertyMap );
+  return visualTemplate;
+}
+
+VisualTemplate::VisualTemplate()
+: mPropertyMap(),
+  mUrlArray(),
+  mVisualUrl(),
+  mVisualType( Toolkit::DevelVisual::IMAGE ),
+  mHasUrl( false ),
+  mHasUrlArray( false )
+{
+}
+
+VisualTemplate::~VisualTemplate()
+{
+}
+
+void VisualTemplate::Initialize( const Property::Map& propertyMap )
+{
+  Property::Value* typeValue = propertyMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
+  if( typeValue )
+  {
+    Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, mVisualType );
+  }
+
+  switch( mVisualType )
+  {
+    case Toolkit::Visual::IMAGE:
+    case Toolkit::Visual::N_PATCH:
+    case Toolkit::Visual::SVG:
+    case Toolkit::Visual::ANIMATED_IMAGE:
+    case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
+    {
+      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
+      if( imageURLValue )
+      {
+        std::string imageUrl;
+        if( imageURLValue->Get( imageUrl ) )
+        {
+          mVisualUrl = VisualUrl( imageUrl );
+          mHasUrl = true;
+        }
+        else
+        {
+          Property::Array* array = imageURLValue->GetArray();
+          if( array )
+          {
+            mUrlArray = *array;
+            mHasUrlArray = true;
+          }
+        }
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  // The names of the visual type are looked up before the names of the base class
+  const PropertyName* names = nullptr;
+  unsigned int namesCount = 0u;
+  switch( mVisualType )
+  {
+    case Toolkit::Visual::COLOR:
+    {
+      names = COLOR_VISUAL_PROPERTY_NAMES;
+      namesCount = COLOR_VISUAL_PROPERTY_NAMES_COUNT;
+      break;
+    }
+    case Toolkit::Visual::BORDER:
+    {
+      names = BORDER_VISUAL_PROPERTY_NAMES;
+      namesCount = BORDER_VISUAL_PROPERTY_NAMES_COUNT;
+      break;
+    }
+    case Toolkit::Visual::GRADIENT:
+    {
+      names = GRADIENT_VISUAL_PROPERTY_NAMES;
+      namesCount = GRADIENT_VISUAL_PROPERTY_NAMES_COUNT;
+      break;
+    }
+    case Toolkit::Visual::IMAGE:
+    {
+      if( mHasUrl && mVisualUrl.GetType() == VisualUrl::REGULAR_IMAGE )
+      {
+        names = IMAGE_VISUAL_PROPERTY_NAMES;
+        namesCount = IMAGE_VISUAL_PROPERTY_NAMES_COUNT;
+      }
+      break;
+    }
+    default:
+    {
+      // The other visuals keep their string keys
+      break;
+    }
+  }
+
+  // The string keys are iterated first, so an index key still overrides the string key of the same property
+  for( Property::Map::SizeType i = 0; i < propertyMap.Count(); ++i )
+  {
+    const KeyValuePair& pair = propertyMap.GetKeyValue( i );
+    if( pair.first.type == Property::Key::INDEX )
+    {
+      mPropertyMap[ pair.first.indexKey ] = pair.second;
+    }
+    else
+    {
+      Property::Index index = Property::INVALID_INDEX;
+      if( FindPropertyIndex( names, namesCount, pair.first.stringKey, index ) ||
+          FindPropertyIndex( VISUAL_PROPERTY_NAMES, VISUAL_PROPERTY_NAMES_COUNT, pair.first.stringKey, index ) )
+      {
+        mPropertyMap[ index ] = pair.second;
+      }
+      else
+      {
+        mPropertyMap[ pair.first.stringKey ] = pair.second;
+      }
+    }
+  }
+
+  mPropertyMap[ Toolkit::Visual::Property::TYPE ] = static_cast< int >( mVisualType );
+}
+
+Toolkit::DevelVisual::Type VisualTemplate::GetVisualType() const
+{
+  return mVisualType;
+}
+
+const VisualUrl* VisualTemplate::GetVisualUrl() const
+{
+  return mHasUrl ? &mVisualUrl : nullptr;
+}
+
+const Property::Array* VisualTemplate::GetUrlArray() const
+{
+  return mHasUrlArray ? &mUrlArray : nullptr;
+}
+
+const Property::Map& VisualTemplate::GetPropertyMap() const
+{
+  return mPropertyMap;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,134 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_TEMPLATE_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_TEMPLATE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/property-array.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visual-factory/visual-template.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+
+class VisualTemplate;
+typedef IntrusivePtr<VisualTemplate> VisualTemplatePtr;
+
+/**
+ * VisualTemplate holds a property map of a visual with its visual type and url already resolved.
+ *
+ * The string keys known by the visual type are converted to index keys, so Property::Map::Find( index, name )
+ * finds them without comparing strings.
+ */
+class VisualTemplate : public BaseObject
+{
+public:
+
+  /**
+   * @brief Compile the property map of a visual.
+   *
+   * @param[in] propertyMap The map as passed to VisualFactory::CreateVisual()
+   * @return The template
+   */
+  static VisualTemplatePtr New( const Property::Map& propertyMap );
+
+  /**
+   * @brief Get the resolved visual type.
+   * @return The visual type
+   */
+  Toolkit::DevelVisual::Type GetVisualType() const;
+
+  /**
+   * @brief Get the url of the image visual types.
+   * @return The resolved url, or nullptr if the map has no url string
+   */
+  const VisualUrl* GetVisualUrl() const;
+
+  /**
+   * @brief Get the url array of the animated image visual types.
+   * @return The array of urls, or nullptr if the map has no url array
+   */
+  const Property::Array* GetUrlArray() const;
+
+  /**
+   * @copydoc Toolkit::VisualTemplate::GetPropertyMap()
+   */
+  const Property::Map& GetPropertyMap() const;
+
+private: // Implementation
+
+  /**
+   * Ref counted object - Only allow construction via New().
+   */
+  VisualTemplate();
+
+  /**
+   * Second stage initialization
+   */
+  void Initialize( const Property::Map& propertyMap );
+
+protected:
+
+  /**
+   *  A ref counted object may only be deleted by calling Unreference
+   */
+  ~VisualTemplate() override;
+
+private: // Unimplemented methods
+  VisualTemplate( const VisualTemplate& );
+  VisualTemplate& operator=( const VisualTemplate& );
+
+private: // Data members
+  Property::Map              mPropertyMap;   ///< The properties, keyed by index where possible
+  Property::Array            mUrlArray;      ///< The urls of an animated image
+  VisualUrl                  mVisualUrl;     ///< The resolved url of an image
+  Toolkit::DevelVisual::Type mVisualType;    ///< The resolved visual type
+  bool                       mHasUrl:1;      ///< Whether the map has a url string
+  bool                       mHasUrlArray:1; ///< Whether the map has a url array
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::VisualTemplate& GetImplementation( Dali::Toolkit::VisualTemplate& handle )
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualTemplate handle is empty");
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::VisualTemplate&>(object);
+}
+
+inline const Internal::VisualTemplate& GetImplementation( const Dali::Toolkit::VisualTemplate& handle )
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualTemplate handle is empty");
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::VisualTemplate&>(object);
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_TEMPLATE_H
@@ -36,6 +36,7 @@
 #include <dali-toolkit/devel-api/visuals/color-visual-actions-devel.h>
 #include <dali-toolkit/devel-api/visuals/color-visual-properties-devel.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/helpers/profiler.h>
 #include <dali-toolkit/internal/styling/style-manager-impl.h>
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
@@ -548,6 +549,8 @@ void Control::OnSceneConnection(int depth)
 
   Actor self(Self());
 
+  mImpl->OnSceneConnection();
+
   for(RegisteredVisualContainer::Iterator iter = mImpl->mVisuals.Begin(); iter != mImpl->mVisuals.End(); iter++)
   {
     // Check whether the visual is empty and enabled
@@ -621,6 +624,8 @@ bool Control::OnKeyEvent(const KeyEvent& event)
 
 void Control::OnRelayout(const Vector2& size, RelayoutContainer& container)
 {
+  DALI_TOOLKIT_PROFILE_SCOPE_WITH_HANDLE("Control::OnRelayout", Self());
+
   for(unsigned int i = 0, numChildren = Self().GetChildCount(); i < numChildren; ++i)
   {
     Actor   child = Self().GetChildAt(i);